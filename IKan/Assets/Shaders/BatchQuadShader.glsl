@@ -9,12 +9,18 @@
 #type vertex
 #version 330 core
 
-layout(location = 0) in vec3  a_Position;
-layout(location = 1) in vec4  a_Color;
-layout(location = 2) in vec2  a_TexCoord;
-layout(location = 3) in float a_TexIndex;
-layout(location = 4) in float a_TilingFactor;
-layout(location = 5) in int   a_ObjectID;
+// Per vertex corner of quad
+layout(location = 0) in vec2  a_Corner;
+
+// Per instance data of quad
+layout(location = 1) in vec3  a_AxisX;
+layout(location = 2) in vec3  a_AxisY;
+layout(location = 3) in vec3  a_Position;
+layout(location = 4) in vec4  a_Color;
+layout(location = 5) in int   a_Texture;
+layout(location = 6) in int   a_TextureScale;
+layout(location = 7) in float a_TilingFactor;
+layout(location = 8) in int   a_ObjectID;
 
 uniform mat4 u_ViewProjection;
 
@@ -23,19 +29,27 @@ out VS_OUT
   vec4  Color;
   vec2  TexCoord;
   float TexIndex;
+  float TexLayer;
+  vec2  TexScale;
   float TilingFactor;
   float ObjectID;
 } vs_out;
 
 void main()
 {
+  // Texture slot is stored in lower 16 bits and texture array layer in upper 16 bits (0xFFFF for no layer)
+  int layer = (a_Texture >> 16) & 0xFFFF;
+  
   vs_out.Color         = a_Color;
-  vs_out.TexCoord      = a_TexCoord;
-  vs_out.TexIndex      = a_TexIndex;
+  vs_out.TexCoord      = vec2(a_Corner.x + 0.5, 0.5 - a_Corner.y);
+  vs_out.TexIndex      = float(a_Texture & 0xFFFF);
+  vs_out.TexLayer      = layer == 0xFFFF ? -1.0 : float(layer);
+  vs_out.TexScale      = vec2(a_TextureScale & 0xFFFF, (a_TextureScale >> 16) & 0xFFFF) / 65535.0;
   vs_out.TilingFactor  = a_TilingFactor;
   vs_out.ObjectID      = a_ObjectID;
   
-  gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+  vec3 position = a_Position + a_AxisX * a_Corner.x + a_AxisY * a_Corner.y;
+  gl_Position = u_ViewProjection * vec4(position, 1.0);
 }
 
 // Fragment Shader
@@ -49,33 +63,61 @@ in VS_OUT
   vec4  Color;
   vec2  TexCoord;
   float TexIndex;
+  float TexLayer;
+  vec2  TexScale;
   float TilingFactor;
   float ObjectID;
 } fs_in;
 
-uniform sampler2D u_Textures[16];
+uniform sampler2D u_Textures[8];
+uniform sampler2DArray u_TextureArrays[8];
+
+// Image is stored at origin of layer. Coordinates are repeated inside image and kept half texel away from its edges,
+// so that filter does not read the unused part of layer
+vec4 SampleLayer(sampler2DArray textureArray, vec2 texCoord, float layer, vec2 scale)
+{
+  if (scale == vec2(1.0))
+  {
+    return texture(textureArray, vec3(texCoord, layer));
+  }
+  vec2 halfTexel = 0.5 / vec2(textureSize(textureArray, 0).xy);
+  vec2 layerCoord = clamp(fract(texCoord) * scale, halfTexel, scale - halfTexel);
+  return texture(textureArray, vec3(layerCoord, layer));
+}
 
 void main()
 {
   vec4 texColor = fs_in.Color;
-  switch(int(fs_in.TexIndex))
+  vec2 texCoord = fs_in.TexCoord * fs_in.TilingFactor;
+  
+  // Images are rendered from layer of texture array, other textures from texture slots
+  if (fs_in.TexLayer < 0.0)
+  {
+    switch(int(fs_in.TexIndex))
+    {
+      case 0: texColor *= texture(u_Textures[0], texCoord); break;
+      case 1: texColor *= texture(u_Textures[1], texCoord); break;
+      case 2: texColor *= texture(u_Textures[2], texCoord); break;
+      case 3: texColor *= texture(u_Textures[3], texCoord); break;
+      case 4: texColor *= texture(u_Textures[4], texCoord); break;
+      case 5: texColor *= texture(u_Textures[5], texCoord); break;
+      case 6: texColor *= texture(u_Textures[6], texCoord); break;
+      case 7: texColor *= texture(u_Textures[7], texCoord); break;
+    }
+  }
+  else
   {
-    case 0: texColor *= texture(u_Textures[0], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 1: texColor *= texture(u_Textures[1], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 2: texColor *= texture(u_Textures[2], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 3: texColor *= texture(u_Textures[3], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 4: texColor *= texture(u_Textures[4], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 5: texColor *= texture(u_Textures[5], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 6: texColor *= texture(u_Textures[6], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 7: texColor *= texture(u_Textures[7], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 8: texColor *= texture(u_Textures[8], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 9: texColor *= texture(u_Textures[9], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 10: texColor *= texture(u_Textures[10], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 11: texColor *= texture(u_Textures[11], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 12: texColor *= texture(u_Textures[12], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 13: texColor *= texture(u_Textures[13], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 14: texColor *= texture(u_Textures[14], fs_in.TexCoord * fs_in.TilingFactor); break;
-    case 15: texColor *= texture(u_Textures[15], fs_in.TexCoord * fs_in.TilingFactor); break;
+    switch(int(fs_in.TexIndex))
+    {
+      case 0: texColor *= SampleLayer(u_TextureArrays[0], texCoord, fs_in.TexLayer, fs_in.TexScale); break;
+      case 1: texColor *= SampleLayer(u_TextureArrays[1], texCoord, fs_in.TexLayer, fs_in.TexScale); break;
+      case 2: texColor *= SampleLayer(u_TextureArrays[2], texCoord, fs_in.TexLayer, fs_in.TexScale); break;
+      case 3: texColor *= SampleLayer(u_TextureArrays[3], texCoord, fs_in.TexLayer, fs_in.TexScale); break;
+      case 4: texColor *= SampleLayer(u_TextureArrays[4], texCoord, fs_in.TexLayer, fs_in.TexScale); break;
+      case 5: texColor *= SampleLayer(u_TextureArrays[5], texCoord, fs_in.TexLayer, fs_in.TexScale); break;
+      case 6: texColor *= SampleLayer(u_TextureArrays[6], texCoord, fs_in.TexLayer, fs_in.TexScale); break;
+      case 7: texColor *= SampleLayer(u_TextureArrays[7], texCoord, fs_in.TexLayer, fs_in.TexScale); break;
+    }
   }
   
   if(texColor.a < 0.1)
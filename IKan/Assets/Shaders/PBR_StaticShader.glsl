@@ -10,10 +10,11 @@
 
 #version 330 core
 layout (location = 0) in vec3 a_Position;
-layout (location = 1) in vec3 a_Normal;
+layout (location = 1) in vec2 a_Normal;   // Octahedral encoded
 layout (location = 2) in vec2 a_TexCoord;
-layout (location = 3) in vec3 a_Tangent;
-layout (location = 4) in vec3 a_Binormal;
+layout (location = 3) in vec2 a_Tangent;  // Octahedral encoded
+layout (location = 4) in vec2 a_Binormal; // Octahedral encoded
+layout (location = 5) in mat4 a_InstanceTransform;
 
 out VS_OUT
 {
@@ -28,19 +29,34 @@ out VS_OUT
 }vs_out;
 
 uniform mat4 u_ViewProjection;
-uniform mat4 u_Transform;
-uniform mat3 u_NormalMatrix;
 uniform vec3 u_CameraPosition;
 
+// Decodes the unit vector from octahedral mapping
+vec3 OctahedralDecode(vec2 f)
+{
+  vec3 n = vec3(f.x, f.y, 1.0 - abs(f.x) - abs(f.y));
+  float t = max(-n.z, 0.0);
+  n.x += n.x >= 0.0 ? -t : t;
+  n.y += n.y >= 0.0 ? -t : t;
+  return normalize(n);
+}
+
 void main()
 {
-  vs_out.WorldPosition = vec3(u_Transform * vec4(a_Position, 1.0));;
+  // Cofactor of model matrix is inverse transpose scaled by determinant. Vectors are normalized later, so only sign of
+  // determinant is applied, which flips the vectors back for mirrored (negative scale) instances
+  mat3 model = mat3(a_InstanceTransform);
+  mat3 cofactor = mat3(cross(model[1], model[2]), cross(model[2], model[0]), cross(model[0], model[1]));
+  float modelDeterminant = dot(model[0], cofactor[0]);
+  mat3 normalMatrix = modelDeterminant < 0.0 ? -cofactor : cofactor;
+
+  vs_out.WorldPosition = vec3(a_InstanceTransform * vec4(a_Position, 1.0));
   vs_out.CameraPosition = u_CameraPosition;
   vs_out.TexCoord = vec2(a_TexCoord.x, 1-a_TexCoord.y);
-  vs_out.WorldNormals = u_NormalMatrix * a_Normal;
+  vs_out.WorldNormals = normalMatrix * OctahedralDecode(a_Normal);
 
-  vs_out.Tangent = u_NormalMatrix * a_Tangent;
-  vs_out.Binormal = u_NormalMatrix * a_Binormal;
+  vs_out.Tangent = normalMatrix * OctahedralDecode(a_Tangent);
+  vs_out.Binormal = normalMatrix * OctahedralDecode(a_Binormal);
 
   vec3 N  = normalize(vs_out.WorldNormals);
   vec3 T  = normalize(vs_out.Binormal);
@@ -49,7 +65,7 @@ void main()
   vs_out.TBN = mat3(T, B, N);
   vs_out.TangentViewPos = vs_out.TBN * u_CameraPosition;
 
-  gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0);
+  gl_Position = u_ViewProjection * a_InstanceTransform * vec4(a_Position, 1.0);
 }
 
 // Fragment Shader
@@ -46,11 +46,14 @@ uniform sampler2D u_Textures[16];
 
 void main()
 {
-  vec4 sampled = vec4(1.0, 1.0, 1.0, texture(u_Textures[int(v_TexIndex)], v_TexCoords).r);
+  // Glyph is stored as signed distance field, edge is at 0.5. Smoothing width is one screen pixel at any scale
+  float distance = texture(u_Textures[int(v_TexIndex)], v_TexCoords).r;
+  float smoothing = fwidth(distance) * 0.5;
+  float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
   
-  if(sampled.a < 0.1)
+  if(alpha < 0.1)
     discard;
 
-  o_Color = v_Color * sampled;
+  o_Color = vec4(v_Color.rgb, v_Color.a * alpha);
   o_IDBuffer = int(v_ObjectID);
 }
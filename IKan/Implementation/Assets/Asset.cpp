@@ -14,6 +14,15 @@ namespace IKan
     return AssetType::Invalid;
   }
   
+  uint64_t Asset::GetCPUMemorySize() const
+  {
+    return 0;
+  }
+  uint64_t Asset::GetGPUMemorySize() const
+  {
+    return 0;
+  }
+  
   bool Asset::IsValid() const
   {
     return ((flags & (uint16_t)AssetFlag::Missing) | (flags & (uint16_t)AssetFlag::Invalid)) == 0;
@@ -0,0 +1,87 @@
+//
+//  AssetDependencyGraph.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "AssetDependencyGraph.hpp"
+
+#include <unordered_set>
+
+namespace IKan
+{
+  static const std::vector<AssetHandle> NullDependencies;
+
+  bool AssetDependencyGraph::Set(AssetHandle handle, std::vector<AssetHandle> dependencies)
+  {
+    // Store each dependency once, in sorted order so that unchanged dependencies are detected
+    std::sort(dependencies.begin(), dependencies.end());
+    dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+    dependencies.erase(std::remove_if(dependencies.begin(), dependencies.end(), [handle](AssetHandle dependency) {
+      return dependency == 0 or dependency == handle;
+    }), dependencies.end());
+
+    if (dependencies.empty())
+    {
+      return m_dependencies.erase(handle) > 0;
+    }
+
+    std::vector<AssetHandle>& storedDependencies = m_dependencies[handle];
+    if (storedDependencies == dependencies)
+    {
+      return false;
+    }
+    storedDependencies = std::move(dependencies);
+    return true;
+  }
+
+  const std::vector<AssetHandle>& AssetDependencyGraph::Get(AssetHandle handle) const
+  {
+    if (auto it = m_dependencies.find(handle); it != m_dependencies.end())
+    {
+      return it->second;
+    }
+    return NullDependencies;
+  }
+
+  std::vector<AssetHandle> AssetDependencyGraph::GetClosure(AssetHandle handle) const
+  {
+    std::vector<AssetHandle> closure;
+    std::unordered_set<AssetHandle> visited {handle};
+
+    // Depth first traversal. Asset is added once all of its dependencies are added. Visited set breaks the cycles
+    std::vector<std::pair<AssetHandle, size_t /* Next dependency index */>> stack {{handle, 0}};
+    while (!stack.empty())
+    {
+      auto& [current, dependencyIdx] = stack.back();
+      const std::vector<AssetHandle>& dependencies = Get(current);
+      if (dependencyIdx < dependencies.size())
+      {
+        AssetHandle dependency = dependencies[dependencyIdx++];
+        if (visited.insert(dependency).second)
+        {
+          stack.emplace_back(dependency, 0);
+        }
+        continue;
+      }
+
+      if (current != handle)
+      {
+        closure.push_back(current);
+      }
+      stack.pop_back();
+    }
+    return closure;
+  }
+
+  void AssetDependencyGraph::Remove(AssetHandle handle)
+  {
+    m_dependencies.erase(handle);
+  }
+
+  void AssetDependencyGraph::Clear()
+  {
+    m_dependencies.clear();
+  }
+} // namespace IKan
@@ -52,11 +52,13 @@ namespace IKan
   bool AssetImporter::TryLoadData(const AssetMetadata& metadata, Ref<Asset>& asset)
   {
     IK_PROFILE();
-    if (s_serializers.find(metadata.type) == s_serializers.end())
+    // Note: Called from worker threads by async loading, so serializer map is only read here
+    auto serializerIt = s_serializers.find(metadata.type);
+    if (serializerIt == s_serializers.end())
     {
       IK_LOG_WARN(LogModule::Asset, "There's currently no importer for assets of type {0}", metadata.filePath.stem().string());
       return false;
     }
-    return s_serializers[metadata.type]->TryLoadData(metadata, asset);
+    return serializerIt->second->TryLoadData(metadata, asset);
   }
 } // namespace IKan
@@ -10,11 +10,48 @@
 #include <yaml-cpp/yaml.h>
 
 #include "Project/Project.hpp"
+#include "Core/JobSystem.hpp"
+#include "Core/CoreAssetPath.hpp"
+#include "Renderer/Renderer.hpp"
+#include "Renderer/Mesh.hpp"
+#include "Renderer/Graphics/Texture.hpp"
 
 namespace IKan
 {
   static AssetMetadata NullMetadata;
   
+  namespace AssetManagerUtils
+  {
+    /// This function returns true if asset type can be loaded on worker thread. Such assets only create renderer
+    /// resources while loading and never load other assets
+    /// - Parameter type: asset type
+    static bool IsAsyncLoadSupported(AssetType type)
+    {
+#if RENDER_COMMAND_QUEUE_ENABLED
+      return type == AssetType::Image or type == AssetType::Mesh;
+#else
+      // Renderer commands are executed on submission, so renderer resources can not be created on worker thread
+      return false;
+#endif
+    }
+    
+    /// Number of entries processed by each job at startup
+    static constexpr uint32_t StartupJobSize = 512;
+    
+    /// This function executes the 'job' for ranges of [0, count) on job system
+    /// - Parameters:
+    ///   - count: number of entries
+    ///   - job: job function with range [begin, end)
+    static void ParallelForRange(size_t count, const std::function<void(size_t, size_t)>& job)
+    {
+      const uint32_t jobCount = static_cast<uint32_t>((count + StartupJobSize - 1) / StartupJobSize);
+      JobSystem::ParallelFor(jobCount, [count, &job](uint32_t jobIdx) {
+        const size_t begin = static_cast<size_t>(jobIdx) * StartupJobSize;
+        job(begin, std::min(count, begin + StartupJobSize));
+      });
+    }
+  } // namespace AssetManagerUtils
+  
   void AssetManager::Initialize()
   {
     IK_PROFILE()
@@ -22,15 +59,23 @@ namespace IKan
     
     // Clear previous registry
     s_assetRegistry.Clear();
+    s_dependencyGraph.Clear();
     
     // Intialize asset importers
     AssetImporter::Initialize();
     
+    // Scan the asset directory once. Registry load and reload both use the scanned files
+    Timer timer;
+    const AssetDirectoryScan scan = ScanAssetDirectory();
+    
     // Loads the asset reguistry file path (If present) and update the registry data in manager
-    LoadAssetRegistry();
+    LoadAssetRegistry(scan);
+    
+    // Reload the assets. Import the scanned files and write the asset data in registry file
+    ReloadAssets(scan);
     
-    // Reload the assets. Process the directory recursively and write the asset data in registry file
-    ReloadAssets();
+    IK_LOG_INFO(LogModule::Asset, "Asset Manager is ready in {0:.2f} ms ({1} files, {2} assets)", timer.ElapsedMiliSeconds(),
+                scan.files.size(), s_assetRegistry.Count());
   }
   
   void AssetManager::Shutdown()
@@ -38,6 +83,24 @@ namespace IKan
     IK_PROFILE();
     IK_LOG_INFO(LogModule::Asset, "Shutting down current Asset Manager");
     
+    // Wait for the worker threads. Loaded assets are dropped as they are never used. Their recorded commands are
+    // discarded to release the decoded data waiting to be uploaded
+    for (auto& [handle, request] : s_loadRequests)
+    {
+      while (request->status.load(std::memory_order_acquire) == AssetLoadStatus::Loading)
+      {
+        std::this_thread::yield();
+      }
+      if (request->commandQueue)
+      {
+        request->commandQueue->Discard();
+        request->commandQueue.reset();
+      }
+    }
+    s_loadRequests.clear();
+    s_failedLoads.clear();
+    s_placeholderAssets.clear();
+    
     AssetImporter::Shutdown();
     
     if (Project::GetActive())
@@ -48,7 +111,10 @@ namespace IKan
     
     s_memoryAssets.clear();
     s_loadedAssets.clear();
+    s_evictedAssets.clear();
     s_assetRegistry.Clear();
+    s_dependencyGraph.Clear();
+    AssetResidency::Clear();
   }
   
   AssetHandle AssetManager::ImportAsset(const std::filesystem::path& filepath)
@@ -75,7 +141,7 @@ namespace IKan
     metadata.handle = Hash::GenerateFNV(relativePath);
     metadata.filePath = relativePath;
     metadata.type = type;
-    s_assetRegistry[metadata.filePath] = metadata;
+    s_assetRegistry.Set(metadata.filePath, metadata);
     
     IK_LOG_TRACE(LogModule::Asset, "    Imported {0} : {1}", (uint64_t)metadata.handle, metadata.filePath.string());
     
@@ -138,6 +204,13 @@ namespace IKan
   {
     return IsMemoryAsset(assetHandle) or GetMetadata(assetHandle).IsValid();
   }
+  AssetHandle AssetManager::AddMemoryOnlyAsset(const Ref<Asset>& asset)
+  {
+    IK_ASSERT(asset, "Memory asset is NULL");
+    asset->handle = AssetHandle();
+    s_memoryAssets[asset->handle] = asset;
+    return asset->handle;
+  }
   
   void AssetManager::OnAssetRenamed(AssetHandle assetHandle, const std::filesystem::path& newFilePath)
   {
@@ -149,8 +222,9 @@ namespace IKan
     
     s_assetRegistry.Remove(metadata.filePath);
     metadata.filePath = GetRelativePath(newFilePath);
-    s_assetRegistry[metadata.filePath] = metadata;
-    WriteRegistryToFile();
+    s_assetRegistry.Set(metadata.filePath, metadata);
+    s_failedLoads.erase(assetHandle);
+    OnRegistryChanged();
   }
   
   void AssetManager::OnAssetMoved(AssetHandle assetHandle, const std::filesystem::path& destinationPath)
@@ -163,9 +237,10 @@ namespace IKan
     
     s_assetRegistry.Remove(metadata.filePath);
     metadata.filePath = destinationPath / metadata.filePath.filename();
-    s_assetRegistry[metadata.filePath] = metadata;
+    s_assetRegistry.Set(metadata.filePath, metadata);
+    s_failedLoads.erase(assetHandle);
     
-    WriteRegistryToFile();
+    OnRegistryChanged();
   }
   
   void AssetManager::OnAssetDeleted(AssetHandle assetHandle)
@@ -178,17 +253,21 @@ namespace IKan
     
     s_assetRegistry.Remove(metadata.filePath);
     s_loadedAssets.erase(assetHandle);
-    WriteRegistryToFile();
+    s_failedLoads.erase(assetHandle);
+    s_dependencyGraph.Remove(assetHandle);
+    AssetResidency::OnAssetUnloaded(assetHandle);
+    OnRegistryChanged();
   }
   
   bool AssetManager::ReloadData(AssetHandle assetHandle)
   {
+    s_failedLoads.erase(assetHandle);
     auto& metadata = GetMetadataInternal(assetHandle);
     Ref<Asset> asset;
     metadata.isDataLoaded = AssetImporter::TryLoadData(metadata, asset);
     if (metadata.isDataLoaded)
     {
-      s_loadedAssets[assetHandle] = asset;
+      StoreLoadedAsset(asset);
     }
     return metadata.isDataLoaded;
   }
@@ -203,7 +282,358 @@ namespace IKan
     return s_assetRegistry;
   }
   
-  void AssetManager::LoadAssetRegistry()
+  // Registry Transaction -------------------------------------------------------------------------------------------
+  void AssetManager::BeginRegistryTransaction()
+  {
+    s_registryTransactionDepth++;
+  }
+  
+  void AssetManager::EndRegistryTransaction()
+  {
+    IK_ASSERT(s_registryTransactionDepth > 0, "Registry transaction is not started");
+    if (--s_registryTransactionDepth == 0 and s_isRegistryChangedInTransaction)
+    {
+      s_isRegistryChangedInTransaction = false;
+      WriteRegistryToFile();
+    }
+  }
+  
+  // Async Loading --------------------------------------------------------------------------------------------------
+  Ref<AssetLoadRequest> AssetManager::LoadAssetAsync(AssetHandle assetHandle)
+  {
+    IK_PROFILE();
+    if (auto it = s_loadRequests.find(assetHandle); it != s_loadRequests.end())
+    {
+      return it->second;
+    }
+    if (auto it = s_failedLoads.find(assetHandle); it != s_failedLoads.end())
+    {
+      return it->second.request;
+    }
+    
+    Ref<AssetLoadRequest> request = CreateRef<AssetLoadRequest>();
+    request->handle = assetHandle;
+    
+    const AssetMetadata& metadata = GetMetadataInternal(assetHandle);
+    request->type = metadata.type;
+    request->placeholder = GetPlaceholderAsset(metadata.type);
+    
+    // Loaded, memory or invalid assets are completed here
+    if (IsLoadedAsset(assetHandle) or IsMemoryAsset(assetHandle) or !metadata.IsValid() or
+        !AssetManagerUtils::IsAsyncLoadSupported(metadata.type))
+    {
+      request->asset = GetAsset<Asset>(assetHandle);
+      request->status.store(request->asset ? AssetLoadStatus::Ready : AssetLoadStatus::Failed, std::memory_order_release);
+      return request;
+    }
+    
+    // Load on worker thread. Renderer commands are recorded in request and submitted from main thread once loaded
+    s_loadRequests.emplace(assetHandle, request);
+    JobSystem::Execute([request, metadata]() {
+      IK_PROFILE();
+      request->commandQueue = CreateScope<RenderCommandQueue>();
+      
+      Ref<Asset> asset;
+      bool isLoaded = false;
+      Renderer::RecordDeferred(*request->commandQueue, [&metadata, &asset, &isLoaded]() {
+        isLoaded = AssetImporter::TryLoadData(metadata, asset);
+      });
+      
+      request->asset = asset;
+      request->status.store(isLoaded ? AssetLoadStatus::Uploading : AssetLoadStatus::Failed, std::memory_order_release);
+    });
+    
+    IK_LOG_TRACE(LogModule::Asset, "Loading asset {0} asynchronously", metadata.filePath.string());
+    return request;
+  }
+  
+  void AssetManager::SyncLoadedAssets()
+  {
+    IK_PERFORMANCE("AssetManager::SyncLoadedAssets");
+    for (auto it = s_loadRequests.begin(); it != s_loadRequests.end();)
+    {
+      if (it->second->status.load(std::memory_order_acquire) == AssetLoadStatus::Loading)
+      {
+        ++it;
+        continue;
+      }
+      
+      FinishLoadRequest(it->second);
+      it = s_loadRequests.erase(it);
+    }
+    
+    RetryChangedFailedLoads();
+    EvictUnusedAssets();
+  }
+  
+  void AssetManager::WaitForAsset(AssetHandle assetHandle)
+  {
+    auto it = s_loadRequests.find(assetHandle);
+    if (it == s_loadRequests.end())
+    {
+      return;
+    }
+    
+    IK_PERFORMANCE("AssetManager::WaitForAsset");
+    while (it->second->status.load(std::memory_order_acquire) == AssetLoadStatus::Loading)
+    {
+      std::this_thread::yield();
+    }
+    
+    FinishLoadRequest(it->second);
+    s_loadRequests.erase(it);
+  }
+  
+  Ref<Asset> AssetManager::GetPlaceholderAsset(AssetType type)
+  {
+    if (auto it = s_placeholderAssets.find(type); it != s_placeholderAssets.end())
+    {
+      return it->second;
+    }
+    
+    Ref<Asset> placeholder;
+    switch (type)
+    {
+      case AssetType::Image: placeholder = TextureFactory::Create(CoreAsset("Textures/White.png")); break;
+      case AssetType::Mesh: placeholder = Mesh::Create(CoreAsset("Meshes/Cube.obj")); break;
+      default: break;
+    }
+    s_placeholderAssets[type] = placeholder;
+    return placeholder;
+  }
+  
+  uint32_t AssetManager::GetPendingLoadCount()
+  {
+    return static_cast<uint32_t>(s_loadRequests.size());
+  }
+  
+  void AssetManager::FinishLoadRequest(const Ref<AssetLoadRequest>& request)
+  {
+    IK_PROFILE();
+    if (request->status.load(std::memory_order_acquire) != AssetLoadStatus::Uploading)
+    {
+      // Resources created before load failed are never used
+      if (request->commandQueue)
+      {
+        request->commandQueue->Discard();
+        request->commandQueue.reset();
+      }
+      
+      // Logged once. Placeholder is returned until asset is reloaded or its file is changed
+      const AssetMetadata& metadata = GetMetadataInternal(request->handle);
+      s_failedLoads[request->handle] = {request, GetFileWriteTime(metadata)};
+      IK_LOG_ERROR(LogModule::Asset, "Failed to load asset {0} ({1})", (uint64_t)request->handle, metadata.filePath.string());
+      return;
+    }
+    
+    // Renderer resources are created before any command recorded after this point uses the asset
+    Renderer::Submit([request]() {
+      request->commandQueue->Execute();
+      request->commandQueue.reset();
+    });
+    
+    AssetMetadata& metadata = GetMetadataInternal(request->handle);
+    if (metadata.IsValid())
+    {
+      metadata.isDataLoaded = true;
+    }
+    StoreLoadedAsset(request->asset);
+    request->status.store(AssetLoadStatus::Ready, std::memory_order_release);
+  }
+  
+  void AssetManager::RetryChangedFailedLoads()
+  {
+    // Files are checked once per second, not on each frame
+    static constexpr std::chrono::seconds CheckInterval {1};
+    const auto now = std::chrono::steady_clock::now();
+    if (s_failedLoads.empty() or now - s_lastFailedLoadCheck < CheckInterval)
+    {
+      return;
+    }
+    s_lastFailedLoadCheck = now;
+    
+    IK_PERFORMANCE("AssetManager::RetryChangedFailedLoads");
+    std::erase_if(s_failedLoads, [](const auto& failedLoad) {
+      return GetFileWriteTime(GetMetadataInternal(failedLoad.first)) != failedLoad.second.writeTime;
+    });
+  }
+  
+  std::filesystem::file_time_type AssetManager::GetFileWriteTime(const AssetMetadata& metadata)
+  {
+    if (!metadata.IsValid() or !Project::GetActive())
+    {
+      return {};
+    }
+    std::error_code error;
+    const std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(Project::GetActive()->GetAssetDirectory() / metadata.filePath, error);
+    return error ? std::filesystem::file_time_type() : writeTime;
+  }
+  
+  void AssetManager::StoreLoadedAsset(const Ref<Asset>& asset)
+  {
+    s_loadedAssets[asset->handle] = asset;
+    AssetResidency::OnAssetLoaded(asset);
+  }
+  
+  // Dependencies ---------------------------------------------------------------------------------------------------
+  void AssetManager::SetAssetDependencies(AssetHandle assetHandle, const std::vector<AssetHandle>& dependencies)
+  {
+    if (s_dependencyGraph.Set(assetHandle, dependencies))
+    {
+      OnRegistryChanged();
+    }
+  }
+  
+  const AssetDependencyGraph& AssetManager::GetDependencyGraph()
+  {
+    return s_dependencyGraph;
+  }
+  
+  uint32_t AssetManager::PrefetchDependencies(AssetHandle assetHandle, bool waitForCompletion)
+  {
+    IK_PROFILE();
+    Timer timer;
+    const std::vector<AssetHandle> closure = s_dependencyGraph.GetClosure(assetHandle);
+    
+    // Dependencies found while loading assets are written once
+    AssetRegistryTransaction registryTransaction;
+    
+    // 1. Queue the assets that are loaded on worker threads, so that they are loaded in parallel
+    std::vector<AssetHandle> syncLoadAssets;
+    for (AssetHandle dependency : closure)
+    {
+      const AssetMetadata& metadata = GetMetadataInternal(dependency);
+      if (!metadata.IsValid() or IsLoadedAsset(dependency))
+      {
+        continue;
+      }
+      
+      if (AssetManagerUtils::IsAsyncLoadSupported(metadata.type))
+      {
+        LoadAssetAsync(dependency);
+      }
+      else
+      {
+        syncLoadAssets.push_back(dependency);
+      }
+    }
+    
+    // 2. Load other assets on calling thread. Closure stores dependencies first, so assets used by them (e.g. Images
+    //    of material) are already queued and only waited for
+    for (AssetHandle dependency : syncLoadAssets)
+    {
+      GetAsset<Asset>(dependency);
+    }
+    
+    // 3. Complete the queued requests
+    if (waitForCompletion)
+    {
+      for (AssetHandle dependency : closure)
+      {
+        WaitForAsset(dependency);
+      }
+    }
+    
+    IK_LOG_INFO(LogModule::Asset, "Prefetched {0} dependencies of asset {1} in {2:.2f} ms", closure.size(),
+                (uint64_t)assetHandle, timer.ElapsedMiliSeconds());
+    return static_cast<uint32_t>(closure.size());
+  }
+  
+  // Residency ------------------------------------------------------------------------------------------------------
+  void AssetManager::EvictUnusedAssets()
+  {
+    // Render thread can still execute the commands of previous frame using the assets evicted in previous frame. They
+    // are released now as previous frame is completed
+    s_evictedAssets.clear();
+    
+    AssetResidency::NextFrame();
+    AssetResidency::Evict([](AssetHandle assetHandle) {
+      auto it = s_loadedAssets.find(assetHandle);
+      if (it == s_loadedAssets.end())
+      {
+        return true;
+      }
+      
+      // Asset is referenced outside asset manager
+      if (it->second.use_count() > 1)
+      {
+        return false;
+      }
+      
+      AssetMetadata& metadata = GetMetadataInternal(assetHandle);
+      if (metadata.IsValid())
+      {
+        metadata.isDataLoaded = false;
+      }
+      s_evictedAssets.push_back(std::move(it->second));
+      s_loadedAssets.erase(it);
+      return true;
+    });
+  }
+  
+  bool AssetManager::AssetDirectoryScan::Contains(const std::filesystem::path& filePath) const
+  {
+    auto [begin, end] = fileNameIndex.equal_range(filePath.filename().string());
+    for (auto it = begin; it != end; ++it)
+    {
+      if (files[it->second] == filePath)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+  
+  AssetManager::AssetDirectoryScan AssetManager::ScanAssetDirectory()
+  {
+    IK_PROFILE();
+    const std::filesystem::path assetDirectory = Project::GetAssetDirectory();
+    AssetDirectoryScan scan;
+    
+    // 1. Files of asset directory are collected here. Each sub directory is scanned recursively on its own job
+    std::vector<std::filesystem::path> subDirectories;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(assetDirectory, error))
+    {
+      if (entry.is_directory())
+      {
+        subDirectories.push_back(entry.path());
+      }
+      else
+      {
+        scan.files.push_back(entry.path().lexically_relative(assetDirectory));
+      }
+    }
+    
+    std::vector<std::vector<std::filesystem::path>> directoryFiles(subDirectories.size());
+    JobSystem::ParallelFor(static_cast<uint32_t>(subDirectories.size()), [&subDirectories, &directoryFiles, &assetDirectory](uint32_t directoryIdx) {
+      std::error_code iteratorError;
+      for (const auto& entry : std::filesystem::recursive_directory_iterator(subDirectories[directoryIdx], iteratorError))
+      {
+        if (!entry.is_directory())
+        {
+          directoryFiles[directoryIdx].push_back(entry.path().lexically_relative(assetDirectory));
+        }
+      }
+    });
+    
+    // 2. Merge the files in directory order and index them with file name
+    for (std::vector<std::filesystem::path>& files : directoryFiles)
+    {
+      scan.files.insert(scan.files.end(), std::make_move_iterator(files.begin()), std::make_move_iterator(files.end()));
+    }
+    
+    scan.fileNameIndex.reserve(scan.files.size());
+    for (uint32_t fileIdx = 0; fileIdx < scan.files.size(); fileIdx++)
+    {
+      scan.fileNameIndex.emplace(scan.files[fileIdx].filename().string(), fileIdx);
+    }
+    
+    IK_LOG_TRACE(LogModule::Asset, "  Scanned {0} files in {1} directories", scan.files.size(), subDirectories.size() + 1);
+    return scan;
+  }
+  
+  void AssetManager::LoadAssetRegistry(const AssetDirectoryScan& scan)
   {
     IK_PROFILE();
     
@@ -230,36 +660,52 @@ namespace IKan
       return;
     }
     
+    // 1. Read the entries. YAML nodes are not thread safe, so they are read on calling thread only
+    std::vector<AssetMetadata> entries;
+    entries.reserve(handles.size());
     for (const auto& entry : handles)
     {
       // Relative file path from asset directory
-      std::string filepath = entry["FilePath"].as<std::string>();
-      
-      AssetMetadata metadata;
+      AssetMetadata& metadata = entries.emplace_back();
       metadata.handle = entry["Handle"].as<uint64_t>();
-      metadata.filePath = filepath;
+      metadata.filePath = entry["FilePath"].as<std::string>();
       metadata.type = (AssetType)AssetUtils::AssetTypeFromString(entry["Type"].as<std::string>());
       
       IK_ASSERT(metadata.type != AssetType::Invalid)
       
-      IK_LOG_TRACE(LogModule::Asset, "    Loaded {0} : {1}", (uint64_t)metadata.handle, metadata.filePath.string());
-      
-      // Relocate the file if not present in directory
-      if (!std::filesystem::exists(AssetManager::GetFileSystemPath(metadata)))
+      if (const auto& dependenciesNode = entry["Dependencies"]; dependenciesNode)
+      {
+        std::vector<AssetHandle> dependencies;
+        dependencies.reserve(dependenciesNode.size());
+        for (const auto& dependency : dependenciesNode)
+        {
+          dependencies.emplace_back(dependency.as<uint64_t>());
+        }
+        s_dependencyGraph.Set(metadata.handle, std::move(dependencies));
+      }
+    }
+    
+    // 2. Validate the entries in parallel. Missing files are relocated with file name index of scan instead of
+    //    walking the asset directory for each missing asset
+    AssetManagerUtils::ParallelForRange(entries.size(), [&entries, &scan](size_t begin, size_t end) {
+      for (size_t entryIdx = begin; entryIdx < end; entryIdx++)
       {
+        AssetMetadata& metadata = entries[entryIdx];
+        if (scan.Contains(metadata.filePath))
+        {
+          continue;
+        }
+        
         IK_LOG_TRACE(LogModule::Asset, "    [WARN] : Missing asset '{0}' detected in registry file, trying to locate...", metadata.filePath.string());
         
-        std::string mostLikelyCandidate;
+        const std::string filepath = metadata.filePath.string();
+        const std::filesystem::path* mostLikelyCandidate = nullptr;
         uint32_t bestScore = 0;
         
-        for (auto& pathEntry : std::filesystem::recursive_directory_iterator(Project::GetAssetDirectory()))
+        auto [candidateBegin, candidateEnd] = scan.fileNameIndex.equal_range(metadata.filePath.filename().string());
+        for (auto candidateIt = candidateBegin; candidateIt != candidateEnd; ++candidateIt)
         {
-          const std::filesystem::path& path = pathEntry.path();
-          if (path.filename() != metadata.filePath.filename())
-          {
-            continue;
-          }
-          
+          const std::filesystem::path& path = scan.files[candidateIt->second];
           if (bestScore > 0)
           {
             IK_LOG_TRACE(LogModule::Asset, "      Multiple candidates found...");
@@ -290,20 +736,28 @@ namespace IKan
           }
           
           bestScore = score;
-          mostLikelyCandidate = path.string();
+          mostLikelyCandidate = &path;
         }
         
-        if (mostLikelyCandidate.empty() and bestScore == 0)
+        if (!mostLikelyCandidate)
         {
           IK_LOG_TRACE(LogModule::Asset, "      Failed to locate a potential match for '{0}'", metadata.filePath.string());
+          metadata.type = AssetType::Invalid;
           continue;
         }
         
-        std::replace(mostLikelyCandidate.begin(), mostLikelyCandidate.end(), '\\', '/');
-        metadata.filePath = std::filesystem::relative(mostLikelyCandidate, Project::GetActive()->GetAssetDirectory());
+        metadata.filePath = *mostLikelyCandidate;
         IK_LOG_WARN(LogModule::Asset, "      Found most likely match '{0}'", metadata.filePath.string());
-        
-      } // If file not exists
+      }
+    });
+    
+    // 3. Store the valid entries in registry
+    for (const AssetMetadata& metadata : entries)
+    {
+      if (metadata.type == AssetType::Invalid)
+      {
+        continue;
+      }
       
       if (metadata.handle == static_cast<AssetHandle>(0))
       {
@@ -311,38 +765,65 @@ namespace IKan
         continue;
       }
       
-      s_assetRegistry[metadata.filePath] = metadata;
-    } // For each asset
+      s_assetRegistry.Set(metadata.filePath, metadata);
+    }
     IK_LOG_TRACE(LogModule::Asset, "  Loaded {0} asset entries", s_assetRegistry.Count());
   }
   
-  void AssetManager::ReloadAssets()
+  void AssetManager::ReloadAssets(const AssetDirectoryScan& scan)
   {
     IK_PROFILE();
     IK_LOG_TRACE(LogModule::Asset, "  Processing Asset path and loading in Registry");
     
-    ProcessDirectory(Project::GetAssetDirectory().string());
+    // 1. Classify the scanned files in parallel. Registry is only read here
+    std::vector<AssetMetadata> importedAssets(scan.files.size());
+    AssetManagerUtils::ParallelForRange(scan.files.size(), [&scan, &importedAssets](size_t begin, size_t end) {
+      for (size_t fileIdx = begin; fileIdx < end; fileIdx++)
+      {
+        const std::filesystem::path& relativePath = scan.files[fileIdx];
+        if (s_assetRegistry.Contains(relativePath))
+        {
+          continue;
+        }
+        
+        AssetMetadata& metadata = importedAssets[fileIdx];
+        metadata.type = GetAssetTypeFromPath(relativePath);
+        if (metadata.type != AssetType::Invalid)
+        {
+          metadata.handle = Hash::GenerateFNV(relativePath);
+          metadata.filePath = relativePath;
+        }
+      }
+    });
+    
+    // 2. Store the new assets in registry in scan order
+    for (const AssetMetadata& metadata : importedAssets)
+    {
+      if (metadata.type == AssetType::Invalid)
+      {
+        continue;
+      }
+      s_assetRegistry.Set(metadata.filePath, metadata);
+      IK_LOG_TRACE(LogModule::Asset, "    Imported {0} : {1}", (uint64_t)metadata.handle, metadata.filePath.string());
+    }
+    
     WriteRegistryToFile();
   }
   
-  void AssetManager::ProcessDirectory(const std::filesystem::path &directoryPath)
+  void AssetManager::OnRegistryChanged()
   {
-    // Process the directories recursively
-    for (const auto& entry : std::filesystem::directory_iterator(directoryPath))
+    // Write is deferred till the outermost transaction ends
+    if (s_registryTransactionDepth > 0)
     {
-      if (entry.is_directory())
-      {
-        ProcessDirectory(entry.path());
-      }
-      else
-      {
-        ImportAsset(entry.path());
-      }
+      s_isRegistryChangedInTransaction = true;
+      return;
     }
+    WriteRegistryToFile();
   }
   
   void AssetManager::WriteRegistryToFile()
   {
+    IK_PERFORMANCE("AssetManager::WriteRegistryToFile");
     IK_LOG_TRACE(LogModule::Asset, "  Writting Assets in file");
     // Sort assets by UUID to make project managment easier
     struct AssetRegistryEntry
@@ -382,6 +863,17 @@ namespace IKan
       out << YAML::Key << "Handle" << YAML::Value << handle;
       out << YAML::Key << "FilePath" << YAML::Value << entry.filePath;
       out << YAML::Key << "Type" << YAML::Value << AssetUtils::AssetTypeToString(entry.type);
+      
+      // Dependencies are cached in registry, so that they are known before the asset is loaded
+      if (const std::vector<AssetHandle>& dependencies = s_dependencyGraph.Get(handle); !dependencies.empty())
+      {
+        out << YAML::Key << "Dependencies" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+        for (AssetHandle dependency : dependencies)
+        {
+          out << (uint64_t)dependency;
+        }
+        out << YAML::EndSeq;
+      }
       out << YAML::EndMap;
     }
     out << YAML::EndSeq;
@@ -394,13 +886,7 @@ namespace IKan
   
   AssetMetadata& AssetManager::GetMetadataInternal(AssetHandle handle)
   {
-    for (auto& [filepath, metadata] : s_assetRegistry)
-    {
-      if (metadata.handle == handle)
-      {
-        return metadata;
-      }
-    }
-    return NullMetadata;
+    AssetMetadata* metadata = s_assetRegistry.TryGet(handle);
+    return metadata ? *metadata : NullMetadata;
   }
 } // namespace IKan
@@ -9,10 +9,25 @@
 
 namespace IKan
 {
-  AssetMetadata& AssetRegistry::operator[](const std::filesystem::path& path)
+  AssetMetadata& AssetRegistry::Set(const std::filesystem::path& path, const AssetMetadata& metadata)
   {
     IK_ASSERT(!path.string().empty());
-    return m_assetRegistry[path];
+    AssetMetadata& storedMetadata = m_assetRegistry[path];
+    
+    // Remove the index of replaced metadata, if it points to this path
+    if (auto it = m_handleIndex.find(storedMetadata.handle); it != m_handleIndex.end() and it->second == &storedMetadata)
+    {
+      m_handleIndex.erase(it);
+    }
+    
+    storedMetadata = metadata;
+    if (auto [it, inserted] = m_handleIndex.try_emplace(metadata.handle, &storedMetadata); !inserted and it->second != &storedMetadata)
+    {
+      IK_LOG_WARN(LogModule::Asset, "Asset handle {0} is shared by '{1}' and '{2}'", (uint64_t)metadata.handle,
+                  it->second->filePath.string(), path.string());
+      it->second = &storedMetadata;
+    }
+    return storedMetadata;
   }
   
   const AssetMetadata& AssetRegistry::Get(const std::filesystem::path& path) const
@@ -21,20 +36,49 @@ namespace IKan
     return m_assetRegistry.at(path);
   }
   
+  AssetMetadata* AssetRegistry::TryGet(AssetHandle handle)
+  {
+    auto it = m_handleIndex.find(handle);
+    return it != m_handleIndex.end() ? it->second : nullptr;
+  }
+  
+  const AssetMetadata* AssetRegistry::TryGet(AssetHandle handle) const
+  {
+    auto it = m_handleIndex.find(handle);
+    return it != m_handleIndex.end() ? it->second : nullptr;
+  }
+  
   bool AssetRegistry::Contains(const std::filesystem::path& path) const
   {
     return m_assetRegistry.find(path) != m_assetRegistry.end();
   }
   
+  bool AssetRegistry::Contains(AssetHandle handle) const
+  {
+    return m_handleIndex.find(handle) != m_handleIndex.end();
+  }
+  
   size_t AssetRegistry::Remove(const std::filesystem::path& path)
   {
-    return m_assetRegistry.erase(path);
+    auto registryIt = m_assetRegistry.find(path);
+    if (registryIt == m_assetRegistry.end())
+    {
+      return 0;
+    }
+    
+    if (auto it = m_handleIndex.find(registryIt->second.handle); it != m_handleIndex.end() and it->second == &registryIt->second)
+    {
+      m_handleIndex.erase(it);
+    }
+    m_assetRegistry.erase(registryIt);
+    return 1;
   }
   
   void AssetRegistry::Clear()
   {
     IK_LOG_TRACE(LogModule::Asset, "Clearing Asset registry");
     m_assetRegistry.clear();
+    m_handleIndex.clear();
   }
   
   size_t AssetRegistry::Count() const
@@ -0,0 +1,162 @@
+//
+//  AssetResidency.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "AssetResidency.hpp"
+
+namespace IKan
+{
+  static const AssetResidencyStats NullResidencyStats;
+
+  void AssetResidency::Clear()
+  {
+    s_entries.clear();
+    s_entryMap.clear();
+    s_stats.clear();
+    s_residentBytes = 0;
+    s_peakResidentBytes = 0;
+  }
+
+  void AssetResidency::OnAssetLoaded(const Ref<Asset>& asset)
+  {
+    if (!asset)
+    {
+      return;
+    }
+
+    // Reloaded asset replaces the previous data
+    OnAssetUnloaded(asset->handle);
+
+    Entry entry;
+    entry.handle = asset->handle;
+    entry.type = asset->GetAssetType();
+    entry.cpuBytes = asset->GetCPUMemorySize();
+    entry.gpuBytes = asset->GetGPUMemorySize();
+    entry.lastUsedFrame = s_frameIndex;
+
+    s_entries.push_front(entry);
+    s_entryMap[entry.handle] = s_entries.begin();
+
+    AssetResidencyStats& stats = s_stats[entry.type];
+    stats.assetCount++;
+    stats.cpuBytes += entry.cpuBytes;
+    stats.gpuBytes += entry.gpuBytes;
+    stats.peakBytes = std::max(stats.peakBytes, stats.GetTotalBytes());
+
+    s_residentBytes += entry.cpuBytes + entry.gpuBytes;
+    s_peakResidentBytes = std::max(s_peakResidentBytes, s_residentBytes);
+  }
+
+  void AssetResidency::OnAssetUnloaded(AssetHandle assetHandle)
+  {
+    if (auto it = s_entryMap.find(assetHandle); it != s_entryMap.end())
+    {
+      RemoveEntry(it->second);
+    }
+  }
+
+  void AssetResidency::Touch(AssetHandle assetHandle)
+  {
+    if (auto it = s_entryMap.find(assetHandle); it != s_entryMap.end())
+    {
+      it->second->lastUsedFrame = s_frameIndex;
+      if (it->second != s_entries.begin())
+      {
+        // Splice does not invalidate the iterator
+        s_entries.splice(s_entries.begin(), s_entries, it->second);
+      }
+    }
+  }
+  
+  void AssetResidency::NextFrame()
+  {
+    s_frameIndex++;
+  }
+
+  uint32_t AssetResidency::Evict(const EvictFn& evictFunc)
+  {
+    if (s_residentBytes <= s_budget)
+    {
+      return 0;
+    }
+
+    IK_PERFORMANCE("AssetResidency::Evict");
+    uint32_t evictedCount = 0;
+
+    // Visit from least recently used. Assets still in use are skipped and stay in their place
+    auto it = s_entries.end();
+    while (it != s_entries.begin() and s_residentBytes > s_budget)
+    {
+      --it;
+      const Entry& entry = *it;
+      
+      // Entries are in order of use, so all the remaining entries are also used in current or previous frame.
+      // Evicting them would reload them in next frame
+      if (entry.lastUsedFrame + 1 >= s_frameIndex)
+      {
+        break;
+      }
+      if (entry.cpuBytes + entry.gpuBytes == 0 or !evictFunc(entry.handle))
+      {
+        continue;
+      }
+
+      IK_LOG_TRACE(LogModule::Asset, "Evicting asset {0} ({1} KB)", (uint64_t)entry.handle,
+                   (entry.cpuBytes + entry.gpuBytes) / 1024);
+      s_stats[entry.type].evictedCount++;
+      evictedCount++;
+
+      // Continue from the more recently used entry
+      auto evictedIt = it++;
+      RemoveEntry(evictedIt);
+    }
+
+    if (evictedCount > 0)
+    {
+      IK_LOG_INFO(LogModule::Asset, "Evicted {0} assets. Resident {1} MB (Budget {2} MB)", evictedCount,
+                  s_residentBytes / (1024 * 1024), s_budget / (1024 * 1024));
+    }
+    return evictedCount;
+  }
+
+  void AssetResidency::SetBudget(uint64_t budget)
+  {
+    s_budget = budget;
+  }
+
+  uint64_t AssetResidency::GetBudget()
+  {
+    return s_budget;
+  }
+  uint64_t AssetResidency::GetResidentBytes()
+  {
+    return s_residentBytes;
+  }
+  uint64_t AssetResidency::GetPeakResidentBytes()
+  {
+    return s_peakResidentBytes;
+  }
+  const AssetResidencyStats& AssetResidency::GetStats(AssetType type)
+  {
+    if (auto it = s_stats.find(type); it != s_stats.end())
+    {
+      return it->second;
+    }
+    return NullResidencyStats;
+  }
+
+  void AssetResidency::RemoveEntry(std::list<Entry>::iterator it)
+  {
+    AssetResidencyStats& stats = s_stats[it->type];
+    stats.assetCount--;
+    stats.cpuBytes -= it->cpuBytes;
+    stats.gpuBytes -= it->gpuBytes;
+    s_residentBytes -= it->cpuBytes + it->gpuBytes;
+
+    s_entryMap.erase(it->handle);
+    s_entries.erase(it);
+  }
+} // namespace IKan
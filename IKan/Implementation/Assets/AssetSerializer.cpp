@@ -83,6 +83,17 @@ out << YAML::Key << uniform << YAML::Value << mapHandle; \
     
     std::ofstream fout(AssetManager::GetFileSystemPath(metadata));
     fout << out.c_str();
+    
+    std::vector<AssetHandle> dependencies;
+    for (const Ref<Image>& map : {material->GetAlbedoMap(), material->GetNormalMap(), material->GetMetallicMap(),
+      material->GetRoughnessMap(), material->GetDepthMap()})
+    {
+      if (map)
+      {
+        dependencies.push_back(map->handle);
+      }
+    }
+    AssetManager::SetAssetDependencies(metadata.handle, dependencies);
   }
   bool MaterialSerializer::TryLoadData(const AssetMetadata &metadata, Ref<Asset> &asset) const
   {
@@ -119,6 +130,9 @@ out << YAML::Key << uniform << YAML::Value << mapHandle; \
     IK_DESERIALIZE_PROPERTY(RoughnessTexture, roughnessMap, materialNode, (AssetHandle)0);
     IK_DESERIALIZE_PROPERTY(DepthTexture, depthMap, materialNode, (AssetHandle)0);
     
+    // Materials saved before dependency graph are added here
+    AssetManager::SetAssetDependencies(metadata.handle, {albedoMap, normalMap, metalnessMap, roughnessMap, depthMap});
+    
     if (albedoMap)
     {
       if (AssetManager::IsAssetHandleValid(albedoMap))
@@ -8,6 +8,7 @@
 #include "Application.hpp"
 
 #include "Renderer/RendererStats.hpp"
+#include "Assets/AssetManager.hpp"
 
 /// IKan Engine Version
 static const std::string IKanVersion = "4.0";
@@ -15,7 +16,7 @@ static const std::string IKanVersion = "4.0";
 namespace IKan
 {
   Application::Application(const ApplicationSpecification& appSpec)
-  : m_specification(appSpec)
+  : m_specification(appSpec), m_renderThread(appSpec.threadingPolicy)
   {
     IK_PROFILE();
     IK_ASSERT(!s_instance, "Application instance already created");
@@ -23,6 +24,9 @@ namespace IKan
     
     IK_LOG_INFO(LogModule::Application, "Initializing Core application data. Version : {0}", IKanVersion);
     
+    // Initialize the worker threads
+    JobSystem::Initialize(m_specification.workerThreadCount);
+
     // Set the renrerer Type
     Renderer::SetCurrentRendererAPI(m_specification.rendererType);
 
@@ -69,6 +73,7 @@ namespace IKan
     m_window.reset();
     Renderer::Shutdown();
     m_layers.PopOverlay(m_imguiLayer.get());
+    JobSystem::Shutdown();
     
     s_instance = nullptr;
   }
@@ -78,6 +83,9 @@ namespace IKan
     // Flush the pending task before game loop starts
     FlushBeforeGameLoop();
     
+    // Start the render thread. From now on context is owned by render thread if renderer is multi threaded
+    m_renderThread.Run(m_window->GetRendererContext());
+    
     // Separator in profiler logs before Game Loop
     {
       IK_NAMED_PROFILE("-------------")
@@ -94,6 +102,9 @@ namespace IKan
       
       if (!m_minimized)
       {
+        // Make the assets loaded by worker threads available to this frame
+        AssetManager::SyncLoadedAssets();
+        
         // Updating all the attached layer
         {
           IK_PERFORMANCE("Application::LayersUpdate");
@@ -109,6 +120,12 @@ namespace IKan
           OnUpdate(m_timeStep);
         }
 
+        if (m_renderThread.GetThreadingPolicy() == ThreadingPolicy::MultiThreaded)
+        {
+          EndFrameMultiThreaded();
+          continue;
+        }
+
         // Render the Gui on Renderer thread
         Renderer::Submit([this](){ RenderImGui(); });
         Renderer::Submit([]() { PerformanceProfiler::Get().Clear(); });
@@ -124,6 +141,9 @@ namespace IKan
         Renderer::WaitAndRender();
       }
     }
+    
+    // Render the last frame and take the context back from render thread
+    m_renderThread.Terminate();
     IK_LOG_WARN("", "--------------------------------------------------------------------------");
     IK_LOG_WARN("", "                           Ending Game Loop                               ");
     IK_LOG_WARN("", "--------------------------------------------------------------------------");
@@ -255,6 +275,32 @@ namespace IKan
     return false;
   }
   
+  void Application::EndFrameMultiThreaded()
+  {
+    // Fence: Render thread should complete the last frame before main thread uses the context
+    m_renderThread.BlockUntilRenderComplete();
+    
+    // Render the Gui on main thread. ImGui (and its platform windows) should not leave the main thread. GUI displays
+    // the output of last frame rendered by render thread
+    m_renderThread.AcquireContext();
+    RenderImGui();
+    
+    // Read by GUI, so reset only after GUI is rendered
+    PerformanceProfiler::Get().Clear();
+    RendererStatistics::Get().ResetEachFrame();
+    
+    // Update the window swap buffers
+    m_window->Update();
+    m_renderThread.ReleaseContext();
+    
+    // Store the frame time difference
+    m_timeStep = m_window->GetTimestep();
+    
+    // Hand over the recorded frame to render thread. Main thread records the next frame in other queue meanwhile
+    m_renderThread.NextFrame();
+    m_renderThread.Kick();
+  }
+
   void Application::RenderImGui()
   {
     IK_ASSERT(m_imguiLayer, "ImGui Layer is not created yet !!");
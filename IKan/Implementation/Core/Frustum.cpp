@@ -0,0 +1,102 @@
+//
+//  Frustum.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "Frustum.hpp"
+
+namespace IKan
+{
+  // AABB Packet -----------------------------------------------------------------------------------------------------
+  void AABBPacket::Set(uint32_t lane, const AABB& aabb)
+  {
+    IK_ASSERT(lane < Width, "Invalid lane of AABB packet");
+    minX[lane] = aabb.min.x;
+    minY[lane] = aabb.min.y;
+    minZ[lane] = aabb.min.z;
+    maxX[lane] = aabb.max.x;
+    maxY[lane] = aabb.max.y;
+    maxZ[lane] = aabb.max.z;
+  }
+  
+  // Frustum ---------------------------------------------------------------------------------------------------------
+  Frustum::Frustum(const glm::mat4& viewProjection)
+  {
+    // Gribb-Hartmann plane extraction from rows of matrix. glm matrix is column major, so rows are the columns of
+    // transposed matrix
+    const glm::mat4 rows = glm::transpose(viewProjection);
+    
+    planes[0] = rows[3] + rows[0]; // Left
+    planes[1] = rows[3] - rows[0]; // Right
+    planes[2] = rows[3] + rows[1]; // Bottom
+    planes[3] = rows[3] - rows[1]; // Top
+    planes[4] = rows[3] + rows[2]; // Near
+    planes[5] = rows[3] - rows[2]; // Far
+    
+    for (glm::vec4& plane : planes)
+    {
+      plane /= glm::length(glm::vec3(plane));
+    }
+  }
+  
+  bool Frustum::IsVisible(const AABB& aabb) const
+  {
+    for (const glm::vec4& plane : planes)
+    {
+      // Corner of box farthest along plane normal. Box is outside if this corner is behind the plane
+      const glm::vec3 positive = glm::vec3(plane.x > 0.0f ? aabb.max.x : aabb.min.x,
+                                           plane.y > 0.0f ? aabb.max.y : aabb.min.y,
+                                           plane.z > 0.0f ? aabb.max.z : aabb.min.z);
+      if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  
+  uint32_t Frustum::Cull(const AABBPacket& packet) const
+  {
+    // Sign of plane normal is same for all lanes, so corner is selected per packet and not per box
+    // 1.0 for lanes in front of all planes tested so far
+    glm::vec4 visible(1.0f);
+    for (const glm::vec4& plane : planes)
+    {
+      const glm::vec4& x = plane.x > 0.0f ? packet.maxX : packet.minX;
+      const glm::vec4& y = plane.y > 0.0f ? packet.maxY : packet.minY;
+      const glm::vec4& z = plane.z > 0.0f ? packet.maxZ : packet.minZ;
+      const glm::vec4 distance = x * plane.x + y * plane.y + z * plane.z + plane.w;
+      visible = glm::min(visible, glm::step(glm::vec4(0.0f), distance));
+    }
+    
+    uint32_t mask = 0;
+    for (uint32_t lane = 0; lane < AABBPacket::Width; lane++)
+    {
+      mask |= visible[lane] > 0.0f ? (1u << lane) : 0u;
+    }
+    return mask;
+  }
+  
+  uint32_t Frustum::Cull(const std::vector<AABBPacket>& packets, uint32_t boxCount, std::vector<uint8_t>& visibility) const
+  {
+    IK_PERFORMANCE("Frustum::Cull");
+    IK_ASSERT(packets.size() * AABBPacket::Width >= boxCount, "Packets can not store all boxes");
+    
+    visibility.resize(boxCount);
+    uint32_t visibleCount = 0;
+    for (uint32_t packetIdx = 0; packetIdx * AABBPacket::Width < boxCount; packetIdx++)
+    {
+      const uint32_t mask = Cull(packets[packetIdx]);
+      const uint32_t firstBox = packetIdx * AABBPacket::Width;
+      const uint32_t lanes = std::min(AABBPacket::Width, boxCount - firstBox);
+      for (uint32_t lane = 0; lane < lanes; lane++)
+      {
+        visibility[firstBox + lane] = (mask >> lane) & 1u;
+        visibleCount += visibility[firstBox + lane];
+      }
+    }
+    return visibleCount;
+  }
+} // namespace IKan
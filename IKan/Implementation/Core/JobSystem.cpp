@@ -0,0 +1,189 @@
+//
+//  JobSystem.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "JobSystem.hpp"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+
+namespace IKan
+{
+  // Job System Data -------------------------------------------------------------------------------------------------
+  /// This structure stores the job system data
+  struct JobSystemData
+  {
+    std::vector<std::thread> workers;
+    std::deque<JobSystem::JobFn> jobs;
+    std::mutex mutex;
+    std::condition_variable conditionVariable;
+    bool isRunning {false};
+  };
+  static JobSystemData s_jobSystemData;
+
+  /// Stores true for worker threads
+  static thread_local bool t_isWorkerThread {false};
+
+  namespace JobSystemUtils
+  {
+    /// This function is the loop of each worker thread
+    static void WorkerLoop()
+    {
+      t_isWorkerThread = true;
+      while (true)
+      {
+        JobSystem::JobFn job;
+        {
+          std::unique_lock<std::mutex> lock(s_jobSystemData.mutex);
+          s_jobSystemData.conditionVariable.wait(lock, []() {
+            return !s_jobSystemData.isRunning or !s_jobSystemData.jobs.empty();
+          });
+
+          // Finish all the queued jobs before exit
+          if (s_jobSystemData.jobs.empty())
+          {
+            return;
+          }
+
+          job = std::move(s_jobSystemData.jobs.front());
+          s_jobSystemData.jobs.pop_front();
+        }
+        job();
+      }
+    }
+  } // namespace JobSystemUtils
+
+  // Job System APIs -------------------------------------------------------------------------------------------------
+  void JobSystem::Initialize(uint32_t workerCount)
+  {
+    IK_PROFILE();
+    IK_ASSERT(!s_jobSystemData.isRunning, "Job system is already initialized");
+
+    if (0 == workerCount)
+    {
+      uint32_t hardwareThreads = std::thread::hardware_concurrency();
+      workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    }
+
+    IK_LOG_INFO(LogModule::JobSystem, "Initializing Job System with {0} worker threads", workerCount);
+    s_jobSystemData.isRunning = true;
+    s_jobSystemData.workers.reserve(workerCount);
+    for (uint32_t workerIdx = 0; workerIdx < workerCount; workerIdx++)
+    {
+      s_jobSystemData.workers.emplace_back(JobSystemUtils::WorkerLoop);
+    }
+  }
+
+  void JobSystem::Shutdown()
+  {
+    IK_PROFILE();
+    if (!s_jobSystemData.isRunning)
+    {
+      return;
+    }
+
+    IK_LOG_WARN(LogModule::JobSystem, "Shutting down Job System");
+    {
+      std::scoped_lock<std::mutex> lock(s_jobSystemData.mutex);
+      s_jobSystemData.isRunning = false;
+    }
+    s_jobSystemData.conditionVariable.notify_all();
+
+    for (std::thread& worker : s_jobSystemData.workers)
+    {
+      worker.join();
+    }
+    s_jobSystemData.workers.clear();
+  }
+
+  void JobSystem::Execute(JobFn job)
+  {
+    if (!s_jobSystemData.isRunning)
+    {
+      job();
+      return;
+    }
+
+    {
+      std::scoped_lock<std::mutex> lock(s_jobSystemData.mutex);
+      s_jobSystemData.jobs.push_back(std::move(job));
+    }
+    s_jobSystemData.conditionVariable.notify_one();
+  }
+
+  void JobSystem::ParallelFor(uint32_t count, const ParallelForFn& job)
+  {
+    if (0 == count)
+    {
+      return;
+    }
+
+    // Execute in order on calling thread. Worker should not wait for other workers to avoid dead lock
+    if (!s_jobSystemData.isRunning or 1 == count or t_isWorkerThread)
+    {
+      for (uint32_t jobIdx = 0; jobIdx < count; jobIdx++)
+      {
+        job(jobIdx);
+      }
+      return;
+    }
+
+    /// This structure stores the shared state of parallel for. Shared with helper jobs as they can start after the
+    /// calling thread already returned
+    struct ParallelForState
+    {
+      std::atomic<uint32_t> nextIndex {0};
+      std::atomic<uint32_t> completed {0};
+      std::mutex mutex;
+      std::condition_variable conditionVariable;
+    };
+    Ref<ParallelForState> state = CreateRef<ParallelForState>();
+
+    // Note: 'job' is accessed only if an index is left, which means calling thread is still waiting
+    auto runJobs = [state, &job, count]() {
+      uint32_t jobIdx = 0;
+      while ((jobIdx = state->nextIndex.fetch_add(1)) < count)
+      {
+        job(jobIdx);
+        if (state->completed.fetch_add(1) + 1 == count)
+        {
+          std::scoped_lock<std::mutex> lock(state->mutex);
+          state->conditionVariable.notify_all();
+        }
+      }
+    };
+
+    // Queue the helper jobs. Calling thread also executes the jobs
+    uint32_t helperCount = std::min(static_cast<uint32_t>(s_jobSystemData.workers.size()), count - 1);
+    for (uint32_t helperIdx = 0; helperIdx < helperCount; helperIdx++)
+    {
+      Execute(runJobs);
+    }
+    runJobs();
+
+    // Wait for all the jobs to be completed
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->conditionVariable.wait(lock, [&state, count]() { return state->completed.load() == count; });
+  }
+
+  uint32_t JobSystem::GetWorkerCount()
+  {
+    return static_cast<uint32_t>(s_jobSystemData.workers.size());
+  }
+
+  bool JobSystem::IsInitialized()
+  {
+    return s_jobSystemData.isRunning;
+  }
+
+  bool JobSystem::IsWorkerThread()
+  {
+    return t_isWorkerThread;
+  }
+} // namespace IKan
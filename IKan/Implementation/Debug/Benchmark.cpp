@@ -0,0 +1,602 @@
+//
+//  Benchmark.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "Benchmark.hpp"
+
+#include <random>
+#include <optional>
+
+#include "Core/UUID.hpp"
+#include "Core/JobSystem.hpp"
+#include "Core/CoreAssetPath.hpp"
+#include "Renderer/Renderer.hpp"
+#include "Renderer/SceneRenderer.hpp"
+#include "Renderer/Renderer2D.hpp"
+#include "Renderer/Graphics/Texture.hpp"
+#include "Renderer/Mesh.hpp"
+#include "Assets/AssetManager.hpp"
+#include "Assets/AssetRegistry.hpp"
+#include "Project/Project.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/Entity.hpp"
+#include "Scene/Component.hpp"
+#include "Scene/SceneSerializer.hpp"
+#include "Platform/Null/NullRendererAPI.hpp"
+
+namespace IKan
+{
+  namespace BenchmarkUtils
+  {
+    /// This structure stores the benchmark entry
+    struct Entry
+    {
+      std::string_view name;
+      bool (*function)();
+    };
+
+    /// This function creates the temporary project of benchmarks in new directory under system temporary directory and
+    /// sets it as active. Existing directories are never reused, so only the directory created here is removed later
+    /// - Returns: project directory. Empty if directory can not be created
+    static std::filesystem::path CreateProject()
+    {
+      IK_PROFILE();
+      std::error_code error;
+      const std::filesystem::path tempDirectory = std::filesystem::temp_directory_path(error);
+      if (error)
+      {
+        IK_LOG_ERROR(LogModule::Benchmark, "Failed to get temporary directory: {0}", error.message());
+        return {};
+      }
+      
+      std::filesystem::path directory;
+      for (uint32_t attempt = 0; attempt < 8 and directory.empty(); attempt++)
+      {
+        const std::filesystem::path candidate = tempDirectory / ("IKanBenchmark_" + std::to_string(static_cast<uint64_t>(UUID())));
+        if (std::filesystem::create_directory(candidate, error))
+        {
+          directory = candidate;
+        }
+      }
+      if (directory.empty())
+      {
+        IK_LOG_ERROR(LogModule::Benchmark, "Failed to create project directory in {0}", tempDirectory.string());
+        return {};
+      }
+      std::filesystem::create_directories(directory / "Assets", error);
+
+      ProjectConfig config;
+      config.name = "Benchmark";
+      config.assetDirectory = "Assets";
+      config.assetRegistryPath = "Assets/AssetRegistry.ikr";
+      config.fontPath = "Assets/Fonts";
+      config.meshPath = "Assets/Meshes";
+      config.materialPath = "Assets/Materials";
+      config.scenePath = "Assets/Scenes";
+      config.texturePath = "Assets/Textures";
+      config.physicsPath = "Assets/Physics";
+      config.prefabPath = "Assets/Prefabs";
+      config.sceneType = SceneType::_3D;
+      config.projectDirectory = directory;
+
+      Ref<Project> project = CreateRef<Project>();
+      project->SetConfig(config);
+      Project::SetActive(project);
+      return directory;
+    }
+  } // namespace BenchmarkUtils
+
+  // Renderer Benchmarks ---------------------------------------------------------------------------------------------
+  namespace RendererBenchmarks
+  {
+    /// This function records the same scene with parallel and serial recording of scene renderer. Chunks are merged in
+    /// order, so both frames should make same draw calls with same state. Only the binds and material uploads at start of
+    /// chunks are extra in parallel
+    static bool RecordParallel()
+    {
+      IK_PROFILE();
+      static constexpr uint32_t GridWidth = 64, GridHeight = 32;
+
+      Ref<Mesh> mesh = Mesh::Create(CoreAsset("Meshes/Cube.obj"));
+      const AssetHandle meshHandle = AssetManager::AddMemoryOnlyAsset(mesh);
+
+      SceneRenderer sceneRenderer("Benchmark");
+      sceneRenderer.SetViewportSize(1280, 720);
+
+      SceneRendererCamera sceneCamera;
+      sceneCamera.camera.SetPerspectiveProjectionMatrix(glm::radians(45.0f), 1280.0f, 720.0f, 0.1f, 1000.0f);
+      sceneCamera.position = {0.0f, 0.0f, 100.0f};
+      sceneCamera.viewMatrix = glm::lookAt(sceneCamera.position, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+      sceneCamera.near = 0.1f;
+      sceneCamera.far = 1000.0f;
+      sceneCamera.FOV = glm::radians(45.0f);
+
+      // Each mesh has its own tiling factor, so every mesh is one instanced batch
+      auto recordFrame = [&](bool parallel) {
+        sceneRenderer.SetParallelRecording(parallel);
+        NullRendererRecord::Get().Reset();
+
+        Timer timer;
+        sceneRenderer.BeginScene(sceneCamera);
+        for (uint32_t y = 0; y < GridHeight; y++)
+        {
+          for (uint32_t x = 0; x < GridWidth; x++)
+          {
+            const glm::vec3 position {2.0f * x - GridWidth + 1.0f, 2.0f * y - GridHeight + 1.0f, 0.0f};
+            sceneRenderer.SubmitMesh(meshHandle, glm::translate(glm::mat4(1.0f), position), nullptr, 1.0f + y * GridWidth + x);
+          }
+        }
+        sceneRenderer.EndScene();
+        const double recordTime = timer.ElapsedMiliSeconds();
+
+        Renderer::WaitAndRender();
+        IK_LOG_INFO(LogModule::Benchmark, "  {0} recording : {1:.3f} ms, {2} draw calls, {3} pipeline, {4} shader binds",
+                    parallel ? "Parallel" : "Serial  ", recordTime, NullRendererRecord::Get().drawCalls.size(),
+                    NullRendererRecord::Get().pipelineBinds, NullRendererRecord::Get().shaderBinds);
+        return NullRendererRecord::Get();
+      };
+
+      // First frame creates the instance buffer
+      recordFrame(false);
+
+      const NullRendererRecord serial = recordFrame(false);
+      const NullRendererRecord parallel = recordFrame(true);
+
+      if (serial.drawCalls.empty())
+      {
+        IK_LOG_ERROR(LogModule::Benchmark, "  Scene is not rendered");
+        return false;
+      }
+      // Each draw call stores the uniforms, textures and instance buffer range it is drawn with, so equal draw calls
+      // mean that every mesh is rendered with same state
+      for (size_t drawIdx = 0; drawIdx < serial.drawCalls.size() and drawIdx < parallel.drawCalls.size(); drawIdx++)
+      {
+        if (serial.drawCalls[drawIdx] != parallel.drawCalls[drawIdx])
+        {
+          IK_LOG_ERROR(LogModule::Benchmark, "  Draw call {0} of parallel recording does not match serial recording", drawIdx);
+          return false;
+        }
+      }
+      if (serial.drawCalls.size() != parallel.drawCalls.size())
+      {
+        IK_LOG_ERROR(LogModule::Benchmark, "  Parallel recording made {0} draw calls, serial recording made {1}",
+                     parallel.drawCalls.size(), serial.drawCalls.size());
+        return false;
+      }
+      if (serial.bufferBytes != parallel.bufferBytes or serial.bufferHash != parallel.bufferHash or
+          serial.textureBytes != parallel.textureBytes or serial.clears != parallel.clears or
+          serial.viewportChanges != parallel.viewportChanges or serial.frameBufferBinds != parallel.frameBufferBinds)
+      {
+        IK_LOG_ERROR(LogModule::Benchmark, "  Buffer data or render passes of parallel recording do not match serial recording");
+        return false;
+      }
+      
+      // Only allowed difference: Each chunk starts with no bound state, so it binds the shader, material textures and
+      // pipeline again and uploads the same material uniforms again. These do not change the state of any draw call
+      if (parallel.shaderBinds < serial.shaderBinds or parallel.pipelineBinds < serial.pipelineBinds or
+          parallel.textureBinds < serial.textureBinds or parallel.uniformUploads < serial.uniformUploads)
+      {
+        IK_LOG_ERROR(LogModule::Benchmark, "  Parallel recording made less binds or uniform uploads than serial recording");
+        return false;
+      }
+      IK_LOG_INFO(LogModule::Benchmark, "  Parallel recording rebinds : {0} shader, {1} pipeline, {2} texture, {3} uniform uploads",
+                  parallel.shaderBinds - serial.shaderBinds, parallel.pipelineBinds - serial.pipelineBinds,
+                  parallel.textureBinds - serial.textureBinds, parallel.uniformUploads - serial.uniformUploads);
+      return true;
+    }
+
+    /// This function submits the same quads with one call of SubmitQuads and with SubmitQuad for each quad. Both should
+    /// upload same instances and make same draw calls
+    static bool SubmitQuads()
+    {
+      IK_PROFILE();
+      static constexpr uint32_t QuadCount = 100'000;
+      static constexpr uint32_t TextureCount = 4;
+
+      std::vector<glm::mat4> transforms(QuadCount);
+      std::vector<glm::vec4> colors(QuadCount);
+      std::vector<uint16_t> textureIndices(QuadCount);
+      for (uint32_t quadIdx = 0; quadIdx < QuadCount; quadIdx++)
+      {
+        const glm::vec3 position(quadIdx % 400, quadIdx / 400, 0.0f);
+        transforms[quadIdx] = Utils::Math::GetTransformMatrix(position, {0.0f, 0.0f, quadIdx * 0.01f}, glm::vec3(0.5f));
+        colors[quadIdx] = {(quadIdx % 256) / 255.0f, 0.5f, 1.0f - (quadIdx % 256) / 255.0f, 1.0f};
+        textureIndices[quadIdx] = static_cast<uint16_t>(quadIdx % TextureCount);
+      }
+
+      // Each texture takes its own slot in batch
+      std::vector<Ref<Texture>> textures;
+      for (uint32_t textureIdx = 0; textureIdx < TextureCount; textureIdx++)
+      {
+        textures.push_back(TextureFactory::Create());
+      }
+
+      const glm::mat4 viewProjection = glm::ortho(0.0f, 400.0f, 0.0f, 250.0f);
+      auto submitFrame = [&](bool bulk) {
+        NullRendererRecord::Get().Reset();
+
+        Timer timer;
+        Renderer2D::BeginBatch(viewProjection, glm::mat4(1.0f));
+        if (bulk)
+        {
+          Renderer2D::SubmitQuads(transforms, colors, textures, textureIndices);
+        }
+        else
+        {
+          for (uint32_t quadIdx = 0; quadIdx < QuadCount; quadIdx++)
+          {
+            Renderer2D::SubmitQuad(transforms[quadIdx], colors[quadIdx], textures[textureIndices[quadIdx]]);
+          }
+        }
+        Renderer2D::EndBatch();
+        const double submitTime = timer.ElapsedMiliSeconds();
+
+        Renderer::WaitAndRender();
+        IK_LOG_INFO(LogModule::Benchmark, "  {0} : {1:.3f} ms, {2} draw calls, {3} KB instance data", bulk ? "SubmitQuads" : "SubmitQuad ",
+                    submitTime, NullRendererRecord::Get().drawCalls.size(), NullRendererRecord::Get().bufferBytes / 1024);
+        return NullRendererRecord::Get();
+      };
+
+      const NullRendererRecord single = submitFrame(false);
+      const NullRendererRecord bulk = submitFrame(true);
+
+      uint32_t instances = 0;
+      for (const NullRendererRecord::DrawCall& drawCall : bulk.drawCalls)
+      {
+        instances += drawCall.instanceCount;
+      }
+      if (instances != QuadCount)
+      {
+        IK_LOG_ERROR(LogModule::Benchmark, "  SubmitQuads rendered {0} quads instead of {1}", instances, QuadCount);
+        return false;
+      }
+      if (single.drawCalls != bulk.drawCalls or single.bufferBytes != bulk.bufferBytes)
+      {
+        IK_LOG_ERROR(LogModule::Benchmark, "  Draw calls of SubmitQuads do not match SubmitQuad");
+        return false;
+      }
+      return true;
+    }
+  } // namespace RendererBenchmarks
+
+  // Asset Benchmarks ------------------------------------------------------------------------------------------------
+  namespace AssetBenchmarks
+  {
+    /// This function compares the metadata lookup of handle index of registry with linear scan of registry
+    static bool HandleLookup()
+    {
+      IK_PROFILE();
+      static constexpr uint32_t AssetCounts[] = {10'000, 50'000, 100'000};
+      static constexpr uint32_t LinearScanLookups = 1'000;
+
+      for (uint32_t assetCount : AssetCounts)
+      {
+        AssetRegistry registry;
+        std::vector<AssetHandle> handles;
+        handles.reserve(assetCount);
+        for (uint32_t assetIdx = 0; assetIdx < assetCount; assetIdx++)
+        {
+          AssetMetadata metadata;
+          metadata.handle = AssetHandle();
+          metadata.type = AssetType::Image;
+          metadata.filePath = "Textures/Texture_" + std::to_string(assetIdx) + ".png";
+          registry.Set(metadata.filePath, metadata);
+          handles.push_back(metadata.handle);
+        }
+        std::shuffle(handles.begin(), handles.end(), std::mt19937(assetCount));
+
+        // Handle index
+        uint32_t found = 0;
+        Timer indexTimer;
+        for (AssetHandle handle : handles)
+        {
+          const AssetMetadata* metadata = std::as_const(registry).TryGet(handle);
+          found += metadata and metadata->handle == handle;
+        }
+        const double indexTime = indexTimer.ElapsedNanoSeconds() / assetCount;
+
+        // Linear scan of registry. Only few handles as each lookup visits half registry on average
+        uint32_t scanned = 0;
+        Timer scanTimer;
+        for (uint32_t lookupIdx = 0; lookupIdx < LinearScanLookups; lookupIdx++)
+        {
+          for (const auto& [path, metadata] : registry)
+          {
+            if (metadata.handle == handles[lookupIdx])
+            {
+              scanned++;
+              break;
+            }
+          }
+        }
+        const double scanTime = scanTimer.ElapsedNanoSeconds() / LinearScanLookups;
+
+        IK_LOG_INFO(LogModule::Benchmark, "  {0:>6} assets : Index {1:.1f} ns, Linear scan {2:.1f} ns per lookup", assetCount,
+                    indexTime, scanTime);
+        if (found != assetCount or scanned != LinearScanLookups)
+        {
+          IK_LOG_ERROR(LogModule::Benchmark, "  Handles are missing in registry");
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /// This function renames and moves the assets with and without registry transaction. Registry file is written for
+    /// each asset without transaction and once for all assets with transaction
+    static bool BulkRenameMove()
+    {
+      IK_PROFILE();
+      static constexpr uint32_t AssetCounts[] = {100, 1'000};
+
+      const std::filesystem::path bulkDirectory = Project::GetAssetDirectory() / "Bulk";
+      for (uint32_t assetCount : AssetCounts)
+      {
+        for (bool useTransaction : {false, true})
+        {
+          std::filesystem::create_directories(bulkDirectory / "Moved");
+
+          // Asset files are only registered, never loaded. So empty files are enough
+          std::vector<AssetHandle> handles(assetCount);
+          for (uint32_t assetIdx = 0; assetIdx < assetCount; assetIdx++)
+          {
+            const std::filesystem::path filePath = bulkDirectory / ("Asset_" + std::to_string(assetIdx) + ".png");
+            std::ofstream(filePath).close();
+            handles[assetIdx] = AssetManager::ImportAsset(filePath);
+          }
+
+          Timer renameTimer;
+          {
+            std::optional<AssetRegistryTransaction> registryTransaction;
+            if (useTransaction)
+            {
+              registryTransaction.emplace();
+            }
+            for (uint32_t assetIdx = 0; assetIdx < assetCount; assetIdx++)
+            {
+              const std::filesystem::path newFilePath = bulkDirectory / ("Renamed_" + std::to_string(assetIdx) + ".png");
+              Utils::FileSystem::Rename(AssetManager::GetFileSystemPath(AssetManager::GetMetadata(handles[assetIdx])), newFilePath);
+              AssetManager::OnAssetRenamed(handles[assetIdx], newFilePath);
+            }
+          }
+          const double renameTime = renameTimer.ElapsedMiliSeconds();
+
+          Timer moveTimer;
+          {
+            std::optional<AssetRegistryTransaction> registryTransaction;
+            if (useTransaction)
+            {
+              registryTransaction.emplace();
+            }
+            for (AssetHandle handle : handles)
+            {
+              Utils::FileSystem::MoveFile(AssetManager::GetFileSystemPath(AssetManager::GetMetadata(handle)), bulkDirectory / "Moved");
+              AssetManager::OnAssetMoved(handle, "Bulk/Moved");
+            }
+          }
+          const double moveTime = moveTimer.ElapsedMiliSeconds();
+
+          IK_LOG_INFO(LogModule::Benchmark, "  {0:>5} assets {1} : Rename {2:.2f} ms, Move {3:.2f} ms", assetCount,
+                      useTransaction ? "with transaction   " : "without transaction", renameTime, moveTime);
+
+          // Registry should have the final path of all assets
+          bool isRegistryValid = true;
+          for (uint32_t assetIdx = 0; assetIdx < assetCount; assetIdx++)
+          {
+            const AssetMetadata& metadata = AssetManager::GetMetadata(handles[assetIdx]);
+            const std::filesystem::path expectedPath = std::filesystem::path("Bulk/Moved") / ("Renamed_" + std::to_string(assetIdx) + ".png");
+            isRegistryValid = isRegistryValid and metadata.filePath == expectedPath and
+                              std::filesystem::exists(AssetManager::GetFileSystemPath(metadata));
+          }
+
+          {
+            AssetRegistryTransaction registryTransaction;
+            for (AssetHandle handle : handles)
+            {
+              AssetManager::OnAssetDeleted(handle);
+            }
+          }
+          std::filesystem::remove_all(bulkDirectory);
+
+          if (!isRegistryValid)
+          {
+            IK_LOG_ERROR(LogModule::Benchmark, "  Registry path of renamed and moved assets is invalid");
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+  } // namespace AssetBenchmarks
+
+  // Scene Benchmarks ------------------------------------------------------------------------------------------------
+  namespace SceneBenchmarks
+  {
+    /// This function creates the scene with entities. Every 8 entities make one hierarchy of root with 7 children
+    /// - Parameter entityCount: number of entities in scene
+    static Ref<Scene> CreateScene(uint32_t entityCount)
+    {
+      IK_PROFILE();
+      Ref<Scene> scene = Scene::Create(SceneType::_3D, "Benchmark", std::max(entityCount, 200'000u));
+      Entity root;
+      for (uint32_t entityIdx = 0; entityIdx < entityCount; entityIdx++)
+      {
+        const std::string name = "Entity_" + std::to_string(entityIdx);
+        Entity entity = entityIdx % 8 == 0 ? scene->CreateEntity(name) : scene->CreateChildEntity(root, name);
+        entity.GetTransform().UpdatePosition(glm::vec3(entityIdx % 100, entityIdx / 100 % 100, entityIdx / 10'000));
+        root = entityIdx % 8 == 0 ? entity : root;
+      }
+      return scene;
+    }
+
+    /// This function returns the number of entities in scene
+    /// - Parameter scene: scene
+    static size_t GetEntityCount(const Ref<Scene>& scene)
+    {
+      return scene->GetRegistry().view<IDComponent>().size();
+    }
+
+    /// This function compares the loading of same scene from yaml and binary file
+    static bool LoadYamlBinary()
+    {
+      IK_PROFILE();
+      static constexpr uint32_t EntityCounts[] = {1'000, 10'000, 100'000};
+
+      std::filesystem::create_directories(Project::GetSceneDirectory());
+      const std::filesystem::path yamlPath = Project::GetSceneDirectory() / ("Yaml" + SceneExtension);
+      const std::filesystem::path binaryPath = Project::GetSceneDirectory() / ("Binary" + SceneExtension);
+      for (uint32_t entityCount : EntityCounts)
+      {
+        {
+          Ref<Scene> scene = CreateScene(entityCount);
+          SceneSerializer serializer(scene);
+          serializer.Serialize(yamlPath, SceneFormat::Yaml);
+          serializer.Serialize(binaryPath, SceneFormat::Binary);
+        }
+
+        auto loadScene = [entityCount](const std::filesystem::path& filePath, double& loadTime) {
+          Ref<Scene> scene = Scene::Create(SceneType::_3D, "Benchmark", std::max(entityCount, 200'000u));
+          Timer timer;
+          const bool loaded = SceneSerializer(scene).Deserialize(filePath);
+          loadTime = timer.ElapsedMiliSeconds();
+          return loaded ? scene : nullptr;
+        };
+
+        double yamlTime = 0.0, binaryTime = 0.0;
+        Ref<Scene> yamlScene = loadScene(yamlPath, yamlTime);
+        Ref<Scene> binaryScene = loadScene(binaryPath, binaryTime);
+
+        IK_LOG_INFO(LogModule::Benchmark, "  {0:>6} entities : Yaml {1:.2f} ms ({2} KB), Binary {3:.2f} ms ({4} KB)", entityCount,
+                    yamlTime, std::filesystem::file_size(yamlPath) / 1024, binaryTime,
+                    std::filesystem::file_size(binaryPath) / 1024);
+
+        if (!yamlScene or !binaryScene or GetEntityCount(yamlScene) != entityCount or GetEntityCount(binaryScene) != entityCount)
+        {
+          IK_LOG_ERROR(LogModule::Benchmark, "  Entities are missing in loaded scene");
+          return false;
+        }
+
+        // Both formats should load same names, transforms and hierarchy
+        auto idView = yamlScene->GetRegistry().view<IDComponent>();
+        for (auto entity : idView)
+        {
+          Entity yamlEntity(entity, yamlScene.get());
+          Entity binaryEntity = binaryScene->TryGetEntityWithUUID(idView.get<IDComponent>(entity).ID);
+          if (!binaryEntity or yamlEntity.GetName() != binaryEntity.GetName() or
+              yamlEntity.GetParentUUID() != binaryEntity.GetParentUUID() or
+              yamlEntity.Children() != binaryEntity.Children() or
+              yamlEntity.GetTransform().Position() != binaryEntity.GetTransform().Position())
+          {
+            IK_LOG_ERROR(LogModule::Benchmark, "  Entity {0} of binary scene does not match yaml scene", yamlEntity.GetName());
+            return false;
+          }
+        }
+      }
+      std::filesystem::remove(yamlPath);
+      std::filesystem::remove(binaryPath);
+      return true;
+    }
+
+    /// This function copies the scene as on entering play mode. Copied scene should iterate same entities in same order
+    static bool CopyPlayMode()
+    {
+      IK_PROFILE();
+      static constexpr uint32_t EntityCounts[] = {10'000, 100'000, 200'000};
+
+      for (uint32_t entityCount : EntityCounts)
+      {
+        Ref<Scene> editorScene = CreateScene(entityCount);
+        Ref<Scene> runtimeScene = Scene::Create(SceneType::_3D, "Benchmark", std::max(entityCount, 200'000u));
+
+        Timer timer;
+        editorScene->CopyTo(runtimeScene);
+        const double copyTime = timer.ElapsedMiliSeconds();
+
+        IK_LOG_INFO(LogModule::Benchmark, "  {0:>6} entities : Copy {1:.2f} ms", entityCount, copyTime);
+
+        auto editorView = editorScene->GetRegistry().view<IDComponent>();
+        auto runtimeView = runtimeScene->GetRegistry().view<IDComponent>();
+        if (GetEntityCount(runtimeScene) != entityCount or !std::equal(editorView.begin(), editorView.end(), runtimeView.begin()))
+        {
+          IK_LOG_ERROR(LogModule::Benchmark, "  Entities of copied scene do not match");
+          return false;
+        }
+
+        for (auto entity : editorView)
+        {
+          Entity editorEntity(entity, editorScene.get());
+          Entity runtimeEntity(entity, runtimeScene.get());
+          if (editorEntity.GetUUID() != runtimeEntity.GetUUID() or editorEntity.GetName() != runtimeEntity.GetName() or
+              editorEntity.Children() != runtimeEntity.Children() or
+              editorEntity.GetTransform().Position() != runtimeEntity.GetTransform().Position())
+          {
+            IK_LOG_ERROR(LogModule::Benchmark, "  Entity {0} of copied scene does not match", editorEntity.GetName());
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+  } // namespace SceneBenchmarks
+
+  /// Benchmarks in order of execution
+  static const BenchmarkUtils::Entry s_benchmarks[] =
+  {
+    {"Renderer.RecordParallel", &RendererBenchmarks::RecordParallel},
+    {"Renderer.SubmitQuads", &RendererBenchmarks::SubmitQuads},
+    {"Asset.HandleLookup", &AssetBenchmarks::HandleLookup},
+    {"Asset.BulkRenameMove", &AssetBenchmarks::BulkRenameMove},
+    {"Scene.LoadYamlBinary", &SceneBenchmarks::LoadYamlBinary},
+    {"Scene.CopyPlayMode", &SceneBenchmarks::CopyPlayMode},
+  };
+
+  bool Benchmark::Run(std::string_view filter)
+  {
+    IK_PROFILE();
+    IK_LOG_INFO(LogModule::Benchmark, "Running benchmarks '{0}'", filter);
+
+    // Headless engine. Commands are executed by Null renderer on calling thread
+    JobSystem::Initialize();
+    Renderer::SetCurrentRendererAPI(RendererType::Null);
+    Renderer::Initialize();
+    Renderer::WaitAndRender();
+    const std::filesystem::path directory = BenchmarkUtils::CreateProject();
+    if (directory.empty())
+    {
+      Renderer::Shutdown();
+      JobSystem::Shutdown();
+      return false;
+    }
+    IK_LOG_INFO(LogModule::Benchmark, "Temporary project : {0}", directory.string());
+
+    uint32_t executed = 0, failed = 0;
+    for (const BenchmarkUtils::Entry& benchmark : s_benchmarks)
+    {
+      if (!filter.empty() and benchmark.name.find(filter) == std::string_view::npos)
+      {
+        continue;
+      }
+
+      IK_LOG_INFO(LogModule::Benchmark, "{0}", benchmark.name);
+      executed++;
+      if (!benchmark.function())
+      {
+        IK_LOG_ERROR(LogModule::Benchmark, "{0} failed", benchmark.name);
+        failed++;
+      }
+      Renderer::WaitAndRender();
+    }
+
+    Project::CloseActive();
+    std::error_code error;
+    std::filesystem::remove_all(directory, error);
+    Renderer::Shutdown();
+    JobSystem::Shutdown();
+
+    IK_LOG_INFO(LogModule::Benchmark, "Executed {0} benchmarks. {1} failed", executed, failed);
+    return 0 == failed;
+  }
+} // namespace IKan
@@ -52,6 +52,9 @@ namespace IKan
   // Performance Profiler --------------------------------------------------------------------------------------------
   void PerformanceProfiler::SetPerFrameTiming(const char* name, float time)
   {
+    // Render thread and main thread both store the timings
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    
     // Store the function in map
     if (m_perFrameData.find(name) == m_perFrameData.end())
     {
@@ -63,6 +66,7 @@ namespace IKan
   }
   void PerformanceProfiler::Clear()
   {
+    std::scoped_lock<std::mutex> lock(m_mutex);
     m_perFrameData.clear();
   }
   const std::unordered_map<const char*, float>& PerformanceProfiler::GetPerFrameData() const
@@ -10,6 +10,7 @@
 #include "Events/ApplicationEvents.h"
 #include "Events/MouseEvents.h"
 #include "Events/KeyEvents.h"
+#include "Renderer/Renderer.hpp"
 
 namespace IKan
 {
@@ -25,6 +26,12 @@ namespace IKan
     [[maybe_unused]] bool glfwInitialized = GLFW_TRUE == glfwInit();
     IK_ASSERT(glfwInitialized, "Can not initialise the GLFW library !");
     
+    // Null renderer does not need any graphics context
+    if (Renderer::GetCurrentRendererAPI() == RendererType::Null)
+    {
+      glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+    }
+
     // Configure the GLFW Context Version.
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
@@ -63,7 +70,10 @@ namespace IKan
       glfwTerminate();
       IK_ASSERT(false, "Unable to create the window !");
     }
-    glfwSwapInterval(1);
+    if (Renderer::GetCurrentRendererAPI() != RendererType::Null)
+    {
+      glfwSwapInterval(1);
+    }
     
     // Set the user defined pointer to GLFW Window, this pointer will be retrieved when an interrupt will be triggered.
     glfwSetWindowUserPointer(m_window, &m_data);
@@ -346,4 +356,9 @@ namespace IKan
   {
     return static_cast<void*>(m_window);
   }
+  
+  RendererContext* MacWindow::GetRendererContext() const
+  {
+    return m_context.get();
+  }
 } // namespace IKan
@@ -85,6 +85,8 @@ namespace IKan
     void* GetNativeWindow() const override;
     /// This function returns the title of the window.
     std::string_view GetTitle() const override;
+    /// This function returns the renderer context of the window.
+    RendererContext* GetRendererContext() const override;
     
   private:
     // Member Functions -----------------------------------------------------------------------------------------------
@@ -0,0 +1,106 @@
+//
+//  NullFrameBuffer.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "NullFrameBuffer.hpp"
+
+#include "Platform/Null/NullRendererAPI.hpp"
+#include "Platform/Null/NullTexture.hpp"
+
+namespace IKan
+{
+  NullFrameBuffer::NullFrameBuffer(const FrameBufferSpecification& spec)
+  : m_rendererID(NullRendererRecord::GenerateRendererID()), m_specification(spec)
+  {
+    IK_PROFILE();
+    IK_LOG_DEBUG(LogModule::FrameBuffer, "Creating Null Framebuffer '{0}' (ID : {1}).", m_specification.debugName, m_rendererID);
+    Invalidate();
+  }
+  
+  NullFrameBuffer::~NullFrameBuffer()
+  {
+    IK_PROFILE();
+    IK_LOG_DEBUG(LogModule::FrameBuffer, "Destroying Null Framebuffer '{0}' (ID : {1}).", m_specification.debugName, m_rendererID);
+  }
+  
+  void NullFrameBuffer::Invalidate()
+  {
+    IK_PROFILE();
+    Texture2DSpecification spec;
+    spec.title  = m_specification.debugName;
+    spec.width  = m_specification.width;
+    spec.height = m_specification.height;
+    spec.enableDebugLogs = false;
+    
+    m_colorAttachments.clear();
+    m_depthAttachment.reset();
+    for (FrameBufferAttachments::TextureFormat format : m_specification.attachments.textureFormats)
+    {
+      switch (format)
+      {
+        case FrameBufferAttachments::TextureFormat::RGBA8:
+          m_colorAttachments.emplace_back(CreateRef<NullTexture>(spec));
+          break;
+        case FrameBufferAttachments::TextureFormat::Depth24Stencil:
+          m_depthAttachment = CreateRef<NullTexture>(spec);
+          break;
+        case FrameBufferAttachments::TextureFormat::None:
+        default:
+          IK_ASSERT(false, "Invalid Framebuffer attachment format!");
+      }
+    }
+  }
+  
+  void NullFrameBuffer::Bind() const
+  {
+    Renderer::Submit([rendererID = m_rendererID](){
+      NullRendererRecord& record = NullRendererRecord::Get();
+      record.frameBufferBinds++;
+      record.boundFrameBuffer = rendererID;
+    });
+    Renderer::SetViewport(m_specification.width, m_specification.height);
+  }
+  
+  void NullFrameBuffer::Unbind() const
+  {
+    Renderer::Submit([](){
+      NullRendererRecord::Get().boundFrameBuffer = 0;
+    });
+  }
+  
+  void NullFrameBuffer::Resize(const uint32_t width, const uint32_t height)
+  {
+    IK_PROFILE();
+    if (0 == width or 0 == height or (width == m_specification.width and height == m_specification.height))
+    {
+      return;
+    }
+    
+    m_specification.width  = width;
+    m_specification.height = height;
+    Invalidate();
+  }
+  
+  const FrameBufferSpecification& NullFrameBuffer::GetSpecification() const
+  {
+    return m_specification;
+  }
+  
+  RendererID NullFrameBuffer::GetRendererId() const
+  {
+    return m_rendererID;
+  }
+  
+  Ref<Texture> NullFrameBuffer::GetDepthAttachment() const
+  {
+    return m_depthAttachment;
+  }
+  
+  const std::vector<Ref<Texture>>& NullFrameBuffer::GetColorAttachments() const
+  {
+    return m_colorAttachments;
+  }
+} // namespace IKan
@@ -0,0 +1,55 @@
+//
+//  NullFrameBuffer.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "Renderer/Graphics/FrameBuffer.hpp"
+
+namespace IKan
+{
+  /// This class implements the framebuffer for Null renderer. Attachments are Null textures.
+  class NullFrameBuffer : public FrameBuffer
+  {
+  public:
+    /// This constructor creates the framebuffer with specification.
+    /// - Parameter spec: Framebuffer specification.
+    NullFrameBuffer(const FrameBufferSpecification& spec);
+    /// This destructor destroys the Null framebuffer.
+    ~NullFrameBuffer();
+    
+    /// This function records the framebuffer bind.
+    void Bind() const override;
+    /// This function records the framebuffer unbind.
+    void Unbind() const override;
+    
+    /// This function resizes the framebuffer attachments.
+    /// - Parameters:
+    ///   - width: New width of FB
+    ///   - height: New height of FB
+    void Resize(const uint32_t width, const uint32_t height) override;
+    
+    /// This function returns the Frame buffer specification.
+    const FrameBufferSpecification& GetSpecification() const override;
+    /// This function returns the Renderer ID.
+    RendererID GetRendererId() const override;
+    /// This function returns the Depth Attachment.
+    Ref<Texture> GetDepthAttachment() const override;
+    /// This function returns the Color Attachments.
+    const std::vector<Ref<Texture>>& GetColorAttachments() const override;
+    
+    DELETE_COPY_MOVE_CONSTRUCTORS(NullFrameBuffer);
+    
+  private:
+    /// This function creates the attachments with current size.
+    void Invalidate();
+    
+    RendererID m_rendererID {0};
+    FrameBufferSpecification m_specification;
+    std::vector<Ref<Texture>> m_colorAttachments;
+    Ref<Texture> m_depthAttachment;
+  };
+} // namespace IKan
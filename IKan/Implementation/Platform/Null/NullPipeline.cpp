@@ -0,0 +1,62 @@
+//
+//  NullPipeline.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "NullPipeline.hpp"
+
+#include "Renderer/Graphics/RendererBuffer.hpp"
+#include "Platform/Null/NullRendererAPI.hpp"
+
+namespace IKan
+{
+  NullPipeline::NullPipeline(const PipelineSpecification& spec)
+  : m_rendererID(NullRendererRecord::GenerateRendererID()), m_specification(spec)
+  {
+    IK_PROFILE();
+    IK_LOG_DEBUG(LogModule::Pipeline, "Creating Null Pipeline (ID : {0}).", m_rendererID);
+  }
+  
+  NullPipeline::~NullPipeline()
+  {
+    IK_PROFILE();
+    IK_LOG_DEBUG(LogModule::Pipeline, "Destroying Null Pipeline (ID : {0}).", m_rendererID);
+  }
+  
+  void NullPipeline::Bind() const
+  {
+    Renderer::Submit([rendererID = m_rendererID](){
+      NullRendererRecord& record = NullRendererRecord::Get();
+      record.pipelineBinds++;
+      record.boundPipeline = rendererID;
+    });
+  }
+  
+  void NullPipeline::Unbind() const
+  {
+    Renderer::Submit([](){
+      NullRendererRecord::Get().boundPipeline = 0;
+    });
+  }
+  
+  void NullPipeline::SetInstanceBuffer(const Ref<VertexBuffer>& instanceBuffer, uint32_t offset) const
+  {
+    Renderer::Submit([bufferID = instanceBuffer ? instanceBuffer->GetRendererID() : 0, offset](){
+      NullRendererRecord& record = NullRendererRecord::Get();
+      record.boundInstanceBuffer = bufferID;
+      record.boundInstanceOffset = offset;
+    });
+  }
+  
+  RendererID NullPipeline::GetRendererID() const
+  {
+    return m_rendererID;
+  }
+  
+  const PipelineSpecification& NullPipeline::GetSpecification() const
+  {
+    return m_specification;
+  }
+} // namespace IKan
@@ -0,0 +1,46 @@
+//
+//  NullPipeline.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "Renderer/Graphics/Pipeline.hpp"
+
+namespace IKan
+{
+  /// This class implements the pipeline for Null renderer. Only pipeline binds are recorded.
+  class NullPipeline : public Pipeline
+  {
+  public:
+    /// This consturctor creates the pipeline with the specification.
+    /// - Parameter spec: Pipeline specification.
+    NullPipeline(const PipelineSpecification& spec);
+    /// This destructior destroys the pipeline data.
+    ~NullPipeline();
+    
+    /// This function records the pipeline bind.
+    void Bind() const override;
+    /// This function records the pipeline unbind.
+    void Unbind() const override;
+    /// This function ignores the instance buffer as no attribute is fetched.
+    /// - Parameters:
+    ///   - instanceBuffer: vertex buffer having instance data.
+    ///   - offset: offset of first instance in buffer (in bytes).
+    void SetInstanceBuffer(const Ref<VertexBuffer>& instanceBuffer, uint32_t offset) const override;
+    
+    /// This function returns the renderer ID of Pipeline.
+    RendererID GetRendererID() const override;
+    
+    /// This function returns the const pipeline specification.
+    const PipelineSpecification& GetSpecification() const override;
+    
+    DELETE_COPY_MOVE_CONSTRUCTORS(NullPipeline);
+    
+  private:
+    RendererID m_rendererID {0};
+    PipelineSpecification m_specification;
+  };
+} // namespace IKan
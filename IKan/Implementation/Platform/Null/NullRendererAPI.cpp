@@ -0,0 +1,180 @@
+//
+//  NullRendererAPI.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "NullRendererAPI.hpp"
+
+#include "Renderer/Renderer.hpp"
+#include "Renderer/Graphics/Pipeline.hpp"
+#include "Renderer/RendererStats.hpp"
+
+namespace IKan
+{
+  // Null Renderer Record --------------------------------------------------------------------------------------------
+  void NullRendererRecord::Reset()
+  {
+    *this = NullRendererRecord();
+  }
+  
+  uint64_t NullRendererRecord::GetUniformState(RendererID shader) const
+  {
+    uint64_t hash = HashOffsetBasis;
+    if (auto it = shaderUniforms.find(shader); it != shaderUniforms.end())
+    {
+      for (const auto& [name, valueHash] : it->second)
+      {
+        hash = HashBytes(name.data(), name.size(), hash);
+        hash = HashBytes(&valueHash, sizeof(valueHash), hash);
+      }
+    }
+    return hash;
+  }
+  
+  uint64_t NullRendererRecord::GetTextureState() const
+  {
+    uint64_t hash = HashOffsetBasis;
+    for (const auto& [slot, texture] : boundTextures)
+    {
+      hash = HashBytes(&slot, sizeof(slot), hash);
+      hash = HashBytes(&texture, sizeof(texture), hash);
+    }
+    return hash;
+  }
+  
+  uint64_t NullRendererRecord::HashBytes(const void* data, size_t size, uint64_t hash)
+  {
+    static constexpr uint64_t Prime = 1099511628211ull;
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+      hash ^= bytes[i];
+      hash *= Prime;
+    }
+    return hash;
+  }
+  
+  RendererID NullRendererRecord::GenerateRendererID()
+  {
+    static std::atomic<RendererID> s_nextRendererID {1};
+    return s_nextRendererID++;
+  }
+  
+  NullRendererRecord& NullRendererRecord::Get()
+  {
+    static NullRendererRecord instance;
+    return instance;
+  }
+  
+  // Null Renderer API -----------------------------------------------------------------------------------------------
+  NullRendererAPI::NullRendererAPI()
+  {
+    IK_PROFILE();
+    IK_LOG_INFO(LogModule::Renderer, "Creating Null Renderer API instance.");
+    
+    RendererCapabilities& caps = RendererCapabilities::Get();
+    caps.vendor   = "IKan";
+    caps.renderer = "Null Renderer";
+    caps.version  = "1.0";
+    
+    IK_LOG_INFO(LogModule::Renderer, "  Vendor       | {0}", caps.vendor);
+    IK_LOG_INFO(LogModule::Renderer, "  Renderer     | {0}", caps.renderer);
+    IK_LOG_INFO(LogModule::Renderer, "  Version      | {0}", caps.version);
+  }
+  
+  NullRendererAPI::~NullRendererAPI()
+  {
+    IK_PROFILE();
+    IK_LOG_WARN(LogModule::Renderer, "Destroying Null Renderer API instance.");
+  }
+  
+  void NullRendererAPI::SetClearColor([[maybe_unused]] const glm::vec4& color) const
+  {
+  }
+  void NullRendererAPI::ClearBits() const
+  {
+    Renderer::Submit([](){
+      NullRendererRecord::Get().clears++;
+    });
+  }
+  void NullRendererAPI::ClearColorBits() const
+  {
+    ClearBits();
+  }
+  void NullRendererAPI::ClearDepthBits() const
+  {
+    ClearBits();
+  }
+  void NullRendererAPI::ClearStencilBits() const
+  {
+    ClearBits();
+  }
+  
+  void NullRendererAPI::SetViewport([[maybe_unused]] uint32_t width, [[maybe_unused]] uint32_t height) const
+  {
+    Renderer::Submit([](){
+      NullRendererRecord::Get().viewportChanges++;
+    });
+  }
+  
+  void NullRendererAPI::DrawIndexed(const Ref<Pipeline>& pipeline, uint32_t count) const
+  {
+    IK_ASSERT(pipeline, "Pipeline is NULL!");
+    SubmitDrawCall(pipeline, {NullRendererRecord::DrawType::Indexed, 0, 0, count, 0, 0});
+  }
+  
+  void NullRendererAPI::DrawLines(const Ref<Pipeline>& pipeline, uint32_t vertexCount) const
+  {
+    IK_ASSERT(pipeline, "Pipeline is NULL!");
+    SubmitDrawCall(pipeline, {NullRendererRecord::DrawType::Lines, 0, 0, vertexCount, 0, 0});
+  }
+  
+  void NullRendererAPI::DrawArrays(const Ref<Pipeline>& pipeline, uint32_t count) const
+  {
+    IK_ASSERT(pipeline, "Pipeline is NULL!");
+    SubmitDrawCall(pipeline, {NullRendererRecord::DrawType::Arrays, 0, 0, count, 0, 0});
+  }
+  
+  void NullRendererAPI::DrawQuad(const Ref<Pipeline>& pipeline) const
+  {
+    IK_ASSERT(pipeline, "Pipeline is NULL!");
+    SubmitDrawCall(pipeline, {NullRendererRecord::DrawType::Quad, 0, 0, 4, 0, 0});
+  }
+  
+  void NullRendererAPI::DrawIndexedBaseVertex(uint32_t indexCount, void* indicesData, uint32_t baseVertex) const
+  {
+    SubmitDrawCall(nullptr, {NullRendererRecord::DrawType::IndexedBaseVertex, 0, 0, indexCount, baseVertex, (uint64_t)indicesData});
+  }
+  
+  void NullRendererAPI::DrawIndexedBaseVertexInstanced(uint32_t indexCount, void* indicesData, uint32_t baseVertex, uint32_t instanceCount) const
+  {
+    SubmitDrawCall(nullptr, {NullRendererRecord::DrawType::IndexedBaseVertexInstanced, 0, 0, indexCount, baseVertex, (uint64_t)indicesData, instanceCount});
+  }
+  
+  void NullRendererAPI::SubmitDrawCall(const Ref<Pipeline>& pipeline, const NullRendererRecord::DrawCall& drawCall) const
+  {
+    if (pipeline)
+    {
+      pipeline->Bind();
+    }
+    
+    Renderer::Submit([drawCall](){
+      NullRendererRecord& record = NullRendererRecord::Get();
+      NullRendererRecord::DrawCall& recordedCall = record.drawCalls.emplace_back(drawCall);
+      recordedCall.pipeline = record.boundPipeline;
+      recordedCall.shader = record.boundShader;
+      recordedCall.instanceBuffer = record.boundInstanceBuffer;
+      recordedCall.instanceOffset = record.boundInstanceOffset;
+      recordedCall.uniformState = record.GetUniformState(record.boundShader);
+      recordedCall.textureState = record.GetTextureState();
+    });
+    
+    if (pipeline)
+    {
+      pipeline->Unbind();
+    }
+    RendererStatistics::Get().drawCalls++;
+  }
+} // namespace IKan
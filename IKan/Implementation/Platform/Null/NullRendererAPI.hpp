@@ -0,0 +1,153 @@
+//
+//  NullRendererAPI.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "Renderer/Graphics/RendererAPI.hpp"
+
+namespace IKan
+{
+  /// This structure stores the calls recorded by Null renderer backend. Data is recorded when render commands are
+  /// executed, so it matches the calls that Open GL backend would make to GPU.
+  /// - Note: Data is never reset by renderer. Client should reset it before recording the frame to be verified.
+  struct NullRendererRecord
+  {
+    /// This enum stores the type of draw call
+    enum class DrawType : uint8_t
+    {
+      Indexed, Lines, Arrays, Quad, IndexedBaseVertex, IndexedBaseVertexInstanced
+    };
+    
+    /// This structure stores the parameters of draw call and snapshot of state used by draw call. Redundant binds and
+    /// uploads of same data do not change the snapshot
+    struct DrawCall
+    {
+      DrawType type {DrawType::Indexed};
+      RendererID pipeline {0};
+      RendererID shader {0};
+      uint32_t count {0};
+      uint32_t baseVertex {0};
+      uint64_t indexOffset {0};
+      uint32_t instanceCount {1};
+      
+      RendererID instanceBuffer {0};
+      uint32_t instanceOffset {0};
+      uint64_t uniformState {0}; // Hash of uniform values of bound shader
+      uint64_t textureState {0}; // Hash of textures bound in slots
+      
+      bool operator==(const DrawCall& other) const = default;
+    };
+    
+    // Fixed Constants
+    static constexpr uint64_t HashOffsetBasis = 14695981039346656037ull;
+    
+    // Member Variables ----------------------------------------------------------------------------------------------
+    uint32_t clears {0}, viewportChanges {0};
+    uint32_t pipelineBinds {0}, shaderBinds {0}, textureBinds {0}, frameBufferBinds {0};
+    uint32_t uniformUploads {0};
+    uint64_t uniformBytes {0}, bufferBytes {0}, textureBytes {0};
+    uint64_t bufferHash {HashOffsetBasis}; // Hash of all the buffer data in upload order
+    
+    RendererID boundPipeline {0}, boundShader {0}, boundFrameBuffer {0};
+    RendererID boundInstanceBuffer {0};
+    uint32_t boundInstanceOffset {0};
+    std::map<uint32_t, RendererID> boundTextures; // Texture of each slot
+    std::unordered_map<RendererID, std::map<std::string, uint64_t>> shaderUniforms; // Hash of each uniform value of shader
+    std::vector<DrawCall> drawCalls;
+    
+    // Member Functions ---------------------------------------------------------------------------------------------
+    /// This function resets all the recorded data
+    void Reset();
+    /// This function returns the hash of uniform values of shader
+    /// - Parameter shader: renderer ID of shader
+    uint64_t GetUniformState(RendererID shader) const;
+    /// This function returns the hash of textures bound in slots
+    uint64_t GetTextureState() const;
+    
+    /// This function returns the FNV-1a hash of data
+    /// - Parameters:
+    ///   - data: data to be hashed
+    ///   - size: size of data
+    ///   - hash: hash of previous data. Used to combine the hashes
+    static uint64_t HashBytes(const void* data, size_t size, uint64_t hash = HashOffsetBasis);
+    
+    /// This function returns the unique renderer ID for Null renderer objects. ID 0 is never returned
+    static RendererID GenerateRendererID();
+    /// This function returns the static singleton instance of NullRendererRecord
+    static NullRendererRecord& Get();
+  };
+
+  /// This class implements the Renderer APIs for Null renderer. No GPU call is made, all calls are recorded in
+  /// NullRendererRecord.
+  class NullRendererAPI : public RendererAPI
+  {
+  public:
+    /// This constructor creates the instance of Null Rendere API.
+    NullRendererAPI();
+    /// This destructor destroys the Null Renderer API instance.
+    virtual ~NullRendererAPI();
+    
+    /// This function records the clear color.
+    /// - Parameter color: new clear color of screen.
+    void SetClearColor(const glm::vec4& color) const override;
+    /// This function records the clear of all bits.
+    void ClearBits() const override;
+    /// This function records the clear of color bits.
+    void ClearColorBits() const override;
+    /// This function records the clear of depth bits.
+    void ClearDepthBits() const override;
+    /// This function records the clear of stencil bits.
+    void ClearStencilBits() const override;
+    
+    /// This function records the viewport update.
+    /// - Parameters:
+    ///   - width: new width of renderer viewport
+    ///   - height: new height of renderer viewport
+    void SetViewport(uint32_t width, uint32_t height) const override;
+    
+    /// This function records the indexed draw call.
+    /// - Parameters:
+    ///   - pipeline: pipeline having vertex buffer and index buffer
+    ///   - count: number of Indices
+    void DrawIndexed(const Ref<Pipeline>& pipeline, uint32_t count) const override;
+    /// This function records the lines draw call.
+    /// - Parameters:
+    ///   - pipeline: pipeline having vertex buffer layout
+    ///   - vertexCount: number of vertices
+    void DrawLines(const Ref<Pipeline>& pipeline, uint32_t vertexCount) const override;
+    /// This function records the array draw call.
+    /// - Parameters:
+    ///   - pipeline: pipeline having vertex buffer attribute
+    ///   - count: number of vertices
+    void DrawArrays(const Ref<Pipeline>& pipeline, uint32_t count) const override;
+    /// This function records the fullscreen quad draw call.
+    /// - Parameter pipeline: pipeline having vertex buffer and index buffer
+    void DrawQuad(const Ref<Pipeline>& pipeline) const override;
+    /// This function records the base vertex draw call.
+    /// - Parameters:
+    ///   - indexCount: index count
+    ///   - indicesData: indices data
+    ///   - baseVertex: base vertex
+    void DrawIndexedBaseVertex(uint32_t indexCount, void* indicesData, uint32_t baseVertex) const override;
+    /// This function records the instanced base vertex draw call.
+    /// - Parameters:
+    ///   - indexCount: index count
+    ///   - indicesData: indices data
+    ///   - baseVertex: base vertex
+    ///   - instanceCount: number of instances
+    void DrawIndexedBaseVertexInstanced(uint32_t indexCount, void* indicesData, uint32_t baseVertex, uint32_t instanceCount) const override;
+    
+    DELETE_COPY_MOVE_CONSTRUCTORS(NullRendererAPI);
+    
+  private:
+    /// This function submits the draw call to be recorded
+    /// - Parameters:
+    ///   - pipeline: pipeline to be bound while drawing. Current bound pipeline is recorded if null
+    ///   - drawCall: draw call parameters
+    void SubmitDrawCall(const Ref<Pipeline>& pipeline, const NullRendererRecord::DrawCall& drawCall) const;
+  };
+} // namespace IKan
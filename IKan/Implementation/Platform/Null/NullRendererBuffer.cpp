@@ -0,0 +1,103 @@
+//
+//  NullRendererBuffer.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "NullRendererBuffer.hpp"
+
+#include "Renderer/RendererStats.hpp"
+#include "Platform/Null/NullRendererAPI.hpp"
+
+namespace IKan
+{
+  // Vertex Buffer ---------------------------------------------------------------------------------------------------
+  NullVertexBuffer::NullVertexBuffer([[maybe_unused]] void *data, uint32_t size)
+  : NullVertexBuffer(size)
+  {
+  }
+  
+  NullVertexBuffer::NullVertexBuffer(uint32_t size)
+  : m_rendererID(NullRendererRecord::GenerateRendererID()), m_size(size)
+  {
+    Renderer::Submit([size]() {
+      RendererStatistics::Get().vertexBufferSize += size;
+      NullRendererRecord::Get().bufferBytes += size;
+    });
+  }
+  
+  NullVertexBuffer::~NullVertexBuffer()
+  {
+    RendererStatistics::Get().vertexBufferSize -= m_size;
+  }
+  
+  void NullVertexBuffer::SetData(void* data, uint32_t size, uint32_t offset)
+  {
+    m_size = size;
+    
+    // Data is hashed on calling thread, as it may be changed before command is executed
+    const uint64_t dataHash = NullRendererRecord::HashBytes(&offset, sizeof(offset), data ? NullRendererRecord::HashBytes(data, size) : 0);
+    Renderer::Submit([size, dataHash]() {
+      NullRendererRecord& record = NullRendererRecord::Get();
+      record.bufferBytes += size;
+      record.bufferHash = NullRendererRecord::HashBytes(&dataHash, sizeof(dataHash), record.bufferHash);
+    });
+  }
+  
+  void NullVertexBuffer::Bind() const
+  {
+  }
+  
+  void NullVertexBuffer::Unbind() const
+  {
+  }
+  
+  RendererID NullVertexBuffer::GetRendererID() const
+  {
+    return m_rendererID;
+  }
+  
+  uint32_t NullVertexBuffer::GetSize() const
+  {
+    return m_size;
+  }
+  
+  // Index Buffer ---------------------------------------------------------------------------------------------------
+  NullIndexBuffer::NullIndexBuffer([[maybe_unused]] void *data, uint32_t size)
+  : m_rendererID(NullRendererRecord::GenerateRendererID()), m_size(size)
+  {
+    Renderer::Submit([size]() {
+      RendererStatistics::Get().indexBufferSize += size;
+      NullRendererRecord::Get().bufferBytes += size;
+    });
+  }
+  
+  NullIndexBuffer::~NullIndexBuffer()
+  {
+    RendererStatistics::Get().indexBufferSize -= m_size;
+  }
+  
+  void NullIndexBuffer::Bind() const
+  {
+  }
+  
+  void NullIndexBuffer::Unbind() const
+  {
+  }
+  
+  uint32_t NullIndexBuffer::GetCount() const
+  {
+    return m_size / SizeOfSingleIndices;
+  }
+  
+  uint32_t NullIndexBuffer::GetSize() const
+  {
+    return m_size;
+  }
+  
+  RendererID NullIndexBuffer::GetRendererID() const
+  {
+    return m_rendererID;
+  }
+} // namespace IKan
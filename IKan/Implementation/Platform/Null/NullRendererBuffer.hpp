@@ -0,0 +1,84 @@
+//
+//  NullRendererBuffer.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "Renderer/Graphics/RendererBuffer.hpp"
+
+namespace IKan
+{
+  // Vertex Buffer ---------------------------------------------------------------------------------------------------
+  /// This class implements the vertex buffer for Null renderer. Only size of data is recorded.
+  class NullVertexBuffer : public VertexBuffer
+  {
+  public:
+    /// This Constructor creates the vertex buffer with data.
+    /// - Parameters:
+    ///   - data: Data of vertex Buffer
+    ///   - size: Size of vertex Buffer
+    NullVertexBuffer(void* data, uint32_t size);
+    /// This Constructor creates the vertex buffer without data.
+    /// - Parameter size: Size of vertex buffer.
+    NullVertexBuffer(uint32_t size);
+    /// This destructor destroyes the Null Vertex Buffer.
+    ~NullVertexBuffer();
+    
+    /// This function records the size of data uploaded to buffer.
+    /// - Parameters:
+    ///   - data: Data pointer
+    ///   - size: size of data
+    ///   - offset: data offset
+    void SetData(void* data, uint32_t size, uint32_t offset = 0) override;
+    /// This function does nothing for Null renderer.
+    void Bind() const override;
+    /// This function does nothing for Null renderer.
+    void Unbind() const override;
+    
+    /// This function returns the renderer ID of Vertex Buffer.
+    RendererID GetRendererID() const override;
+    /// This function returns the size of Vertex Buffer.
+    uint32_t GetSize() const override;
+    
+    DELETE_COPY_MOVE_CONSTRUCTORS(NullVertexBuffer);
+    
+  private:
+    RendererID m_rendererID {0};
+    uint32_t m_size {0};
+  };
+  
+  // Index Buffer ---------------------------------------------------------------------------------------------------
+  /// This class implements the index buffer for Null renderer. Only size of data is recorded.
+  class NullIndexBuffer : public IndexBuffer
+  {
+  public:
+    /// This Constructor creates the index buffer.
+    /// - Parameters:
+    ///   - data: Data of index Buffer
+    ///   - size: Size of index Buffer
+    NullIndexBuffer(void* data, uint32_t size);
+    /// This destructor destroyes the Null Index Buffer.
+    ~NullIndexBuffer();
+    
+    /// This function does nothing for Null renderer.
+    void Bind() const override;
+    /// This function does nothing for Null renderer.
+    void Unbind() const override;
+    
+    /// This function returns the number of indices in buffer.
+    uint32_t GetCount() const override;
+    /// This function returns the size of index buffer.
+    uint32_t GetSize() const override;
+    /// This function returns the renderer ID of index buffer.
+    RendererID GetRendererID() const override;
+    
+    DELETE_COPY_MOVE_CONSTRUCTORS(NullIndexBuffer);
+    
+  private:
+    RendererID m_rendererID {0};
+    uint32_t m_size {0};
+  };
+} // namespace IKan
@@ -0,0 +1,36 @@
+//
+//  NullRendererContext.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "NullRendererContext.hpp"
+
+namespace IKan
+{
+  NullRendererContext::NullRendererContext(GLFWwindow* windowPtr)
+  : m_window(windowPtr)
+  {
+    IK_PROFILE();
+    IK_LOG_TRACE(LogModule::Renderer, "Creating Null Renderer Context.");
+  }
+  
+  NullRendererContext::~NullRendererContext()
+  {
+    IK_PROFILE();
+    IK_LOG_TRACE(LogModule::Renderer, "Destroying Null Renderer Context.");
+  }
+  
+  void NullRendererContext::SwapBuffers()
+  {
+  }
+  
+  void NullRendererContext::MakeCurrent()
+  {
+  }
+  
+  void NullRendererContext::ReleaseCurrent()
+  {
+  }
+} // namespace IKan
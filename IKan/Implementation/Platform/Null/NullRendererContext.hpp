@@ -0,0 +1,36 @@
+//
+//  NullRendererContext.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "Renderer/Graphics/RendererContext.hpp"
+
+namespace IKan
+{
+  /// This class implements the APIs for Null Renderer Context. No graphics context is created.
+  class NullRendererContext : public RendererContext
+  {
+  public:
+    /// This constructor creates the Null Renderer context.
+    /// - Parameter windowPtr: GLFW Window pointer. Can be NULL for headless renderer.
+    NullRendererContext(GLFWwindow* windowPtr);
+    /// This destructor destroys the Null Rendere Context.
+    ~NullRendererContext();
+    
+    /// This function does nothing as there is no buffer to swap.
+    void SwapBuffers() override;
+    /// This function does nothing as there is no context to be current.
+    void MakeCurrent() override;
+    /// This function does nothing as there is no context to be released.
+    void ReleaseCurrent() override;
+    
+    DELETE_COPY_MOVE_CONSTRUCTORS(NullRendererContext);
+    
+  private:
+    GLFWwindow* m_window;
+  };
+} // namespace IKan
@@ -0,0 +1,102 @@
+//
+//  NullShader.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "NullShader.hpp"
+
+#include "Platform/Null/NullRendererAPI.hpp"
+
+namespace IKan
+{
+  NullShader::NullShader(const std::filesystem::path& shaderFilePath)
+  : OpenGLShader(shaderFilePath, ReflectionOnly()), m_nullRendererID(NullRendererRecord::GenerateRendererID())
+  {
+  }
+  
+  NullShader::~NullShader()
+  {
+  }
+  
+  void NullShader::Bind() const
+  {
+    Renderer::Submit([rendererID = m_nullRendererID](){
+      NullRendererRecord& record = NullRendererRecord::Get();
+      record.shaderBinds++;
+      record.boundShader = rendererID;
+    });
+  }
+  
+  void NullShader::Unbind() const
+  {
+  }
+  
+  void NullShader::SetVSMaterialUniformBuffer(const Buffer& buffer)
+  {
+    SubmitUniformUpload("VS Material Buffer", buffer.data, buffer.size);
+  }
+  
+  void NullShader::SetFSMaterialUniformBuffer(const Buffer& buffer)
+  {
+    SubmitUniformUpload("FS Material Buffer", buffer.data, buffer.size);
+  }
+  
+  void NullShader::SetGSMaterialUniformBuffer(const Buffer& buffer)
+  {
+    SubmitUniformUpload("GS Material Buffer", buffer.data, buffer.size);
+  }
+  
+  RendererID NullShader::GetRendererID() const
+  {
+    return m_nullRendererID;
+  }
+  
+  void NullShader::SetUniformMat4Array(std::string_view name, const glm::mat4& values, uint32_t count)
+  {
+    SubmitUniformUpload(name, &values, sizeof(glm::mat4) * count);
+  }
+  
+  void NullShader::SetUniformMat4(std::string_view name, const glm::mat4& value)
+  {
+    SubmitUniformUpload(name, &value, sizeof(glm::mat4));
+  }
+  
+  void NullShader::SetUniformMat3(std::string_view name, const glm::mat3& value)
+  {
+    SubmitUniformUpload(name, &value, sizeof(glm::mat3));
+  }
+  
+  void NullShader::SetUniformFloat1(std::string_view name, float value)
+  {
+    SubmitUniformUpload(name, &value, sizeof(float));
+  }
+  
+  void NullShader::SetUniformFloat2(std::string_view name, const glm::vec2& value)
+  {
+    SubmitUniformUpload(name, &value, sizeof(glm::vec2));
+  }
+  
+  void NullShader::SetUniformFloat3(std::string_view name, const glm::vec3& value)
+  {
+    SubmitUniformUpload(name, &value, sizeof(glm::vec3));
+  }
+  
+  void NullShader::SetUniformFloat4(std::string_view name, const glm::vec4& value)
+  {
+    SubmitUniformUpload(name, &value, sizeof(glm::vec4));
+  }
+  
+  void NullShader::SubmitUniformUpload(std::string_view name, const void* data, uint64_t size) const
+  {
+    // Data is hashed on calling thread, as it may be changed before command is executed
+    const uint64_t valueHash = data ? NullRendererRecord::HashBytes(data, size) : 0;
+    Renderer::Submit([rendererID = m_nullRendererID, name = std::string(name), valueHash, size](){
+      NullRendererRecord& record = NullRendererRecord::Get();
+      record.uniformUploads++;
+      record.uniformBytes += size;
+      record.shaderUniforms[rendererID][name] = valueHash;
+    });
+  }
+} // namespace IKan
@@ -0,0 +1,92 @@
+//
+//  NullShader.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "Platform/OpenGL/OpenGLShader.hpp"
+
+namespace IKan
+{
+  /// This class implements the shader for Null renderer. GLSL code is only parsed to reflect the uniforms and resources
+  /// used by materials. No program is compiled and uniform uploads are only recorded.
+  class NullShader : public OpenGLShader
+  {
+  public:
+    /// This consturctor parses the shader code
+    /// - Parameter shaderFilePath: Shader Code file path
+    NullShader(const std::filesystem::path& shaderFilePath);
+    /// This destructor destroys the Null shader
+    ~NullShader();
+    
+    /// This function records the shader bind
+    void Bind() const override;
+    /// This function does nothing for Null renderer
+    void Unbind() const override;
+    
+    /// This function records the vertex shader buffer data.
+    /// - Parameter buffer: buffer data.
+    void SetVSMaterialUniformBuffer(const Buffer& buffer) override;
+    /// This function records the fragment shader buffer data.
+    /// - Parameter buffer: buffer data.
+    void SetFSMaterialUniformBuffer(const Buffer& buffer) override;
+    /// This function records the geomatry shader buffer data.
+    /// - Parameter buffer: buffer data.
+    void SetGSMaterialUniformBuffer(const Buffer& buffer) override;
+    
+    /// This function returns the Renderer ID of Shader.
+    RendererID GetRendererID() const override;
+    
+    /// This functions records the Matrix 4x4 array upload.
+    /// - Parameters:
+    ///   - name: Name of Uniform
+    ///   - values: Value of Uniform
+    ///   - count: Size of Mat4 Array
+    void SetUniformMat4Array(std::string_view name, const glm::mat4& values, uint32_t count) override;
+    /// This functions records the Matrix 4x4 upload.
+    /// - Parameters:
+    ///   - name: Name of Uniform
+    ///   - value: Value of Uniform
+    void SetUniformMat4(std::string_view name, const glm::mat4& value) override;
+    /// This functions records the Matrix 3x3 upload.
+    /// - Parameters:
+    ///   - name: Name of Uniform
+    ///   - value: Value of Uniform
+    void SetUniformMat3(std::string_view name, const glm::mat3& value) override;
+    /// This functions records the Flaot upload.
+    /// - Parameters:
+    ///   - name: Name of Uniform
+    ///   - value: Value of Uniform
+    void SetUniformFloat1(std::string_view name, float value) override;
+    /// This functions records the Vec2 upload.
+    /// - Parameters:
+    ///   - name: Name of Uniform
+    ///   - value: Value of Uniform
+    void SetUniformFloat2(std::string_view name, const glm::vec2& value) override;
+    /// This functions records the Vec3 upload.
+    /// - Parameters:
+    ///   - name: Name of Uniform
+    ///   - value: Value of Uniform
+    void SetUniformFloat3(std::string_view name, const glm::vec3& value) override;
+    /// This functions records the Vec4 upload.
+    /// - Parameters:
+    ///   - name: Name of Uniform
+    ///   - value: Value of Uniform
+    void SetUniformFloat4(std::string_view name, const glm::vec4& value) override;
+    
+    DELETE_COPY_MOVE_CONSTRUCTORS(NullShader);
+    
+  private:
+    /// This function submits the uniform upload to be recorded
+    /// - Parameters:
+    ///   - name: name of uniform
+    ///   - data: uniform data
+    ///   - size: size of uniform data
+    void SubmitUniformUpload(std::string_view name, const void* data, uint64_t size) const;
+    
+    RendererID m_nullRendererID {0};
+  };
+} // namespace IKan
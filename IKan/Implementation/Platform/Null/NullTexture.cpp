@@ -0,0 +1,229 @@
+//
+//  NullTexture.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "NullTexture.hpp"
+
+#include <stb_image.h>
+
+#include "Renderer/RendererStats.hpp"
+#include "Platform/Null/NullRendererAPI.hpp"
+
+namespace IKan
+{
+  namespace NullTextureUtils
+  {
+    /// This function submits the texture bind to be recorded
+    /// - Parameters:
+    ///   - rendererID: renderer ID of texture
+    ///   - slot: texture slot
+    static void SubmitBind(RendererID rendererID, uint32_t slot)
+    {
+      Renderer::Submit([rendererID, slot]() {
+        NullRendererRecord& record = NullRendererRecord::Get();
+        record.textureBinds++;
+        record.boundTextures[slot] = rendererID;
+      });
+    }
+    
+    /// This function submits the texture data size to be recorded
+    /// - Parameter size: size of texture data
+    static void SubmitUpload(uint64_t size)
+    {
+      Renderer::Submit([size]() {
+        RendererStatistics::Get().textureBufferSize += size;
+        NullRendererRecord::Get().textureBytes += size;
+      });
+    }
+  } // namespace NullTextureUtils
+  
+  // Null Texture ----------------------------------------------------------------------------------------------------
+  NullTexture::NullTexture(const Texture2DSpecification& spec)
+  : m_rendererID(NullRendererRecord::GenerateRendererID()), m_specification(spec)
+  {
+    IK_PROFILE();
+    NullTextureUtils::SubmitUpload(static_cast<uint64_t>(m_specification.width) * m_specification.height * 4);
+  }
+  
+  NullTexture::~NullTexture()
+  {
+    IK_PROFILE();
+    RendererStatistics::Get().textureBufferSize -= static_cast<uint64_t>(m_specification.width) * m_specification.height * 4;
+  }
+  
+  void NullTexture::Bind(uint32_t slot) const
+  {
+    NullTextureUtils::SubmitBind(m_rendererID, slot);
+  }
+  
+  void NullTexture::Unbind() const
+  {
+  }
+  
+  void NullTexture::AttachToFramebuffer([[maybe_unused]] TextureAttachment attachmentType, [[maybe_unused]] uint32_t colorID,
+                                        [[maybe_unused]] uint32_t depthID, [[maybe_unused]] uint32_t level) const
+  {
+  }
+  
+  void NullTexture::SetData([[maybe_unused]] void* data, [[maybe_unused]] uint32_t x, [[maybe_unused]] uint32_t y,
+                            uint32_t width, uint32_t height)
+  {
+    Renderer::Submit([size = static_cast<uint64_t>(width) * height]() {
+      NullRendererRecord::Get().textureBytes += size;
+    });
+  }
+  
+  uint32_t NullTexture::GetWidth() const
+  {
+    return m_specification.width;
+  }
+  
+  uint32_t NullTexture::GetHeight() const
+  {
+    return m_specification.height;
+  }
+  
+  RendererID NullTexture::GetRendererID() const
+  {
+    return m_rendererID;
+  }
+  
+  // Null Image ------------------------------------------------------------------------------------------------------
+  NullImage::NullImage(const Imagespecification& spec)
+  : m_rendererID(NullRendererRecord::GenerateRendererID()), m_specification(spec)
+  {
+    IK_PROFILE();
+    m_name = m_specification.filePath.filename();
+    
+    // Only header is read to get the size of image. Pixels are never decoded
+    [[maybe_unused]] bool validImage = stbi_info(m_specification.filePath.c_str(), &m_width, &m_height, &m_channel);
+    IK_ASSERT(validImage, "Invalid image file!");
+    
+    NullTextureUtils::SubmitUpload(static_cast<uint64_t>(m_width) * static_cast<uint64_t>(m_height) * static_cast<uint64_t>(m_channel));
+  }
+  
+  NullImage::~NullImage()
+  {
+    IK_PROFILE();
+    RendererStatistics::Get().textureBufferSize -= static_cast<uint64_t>(m_width) * static_cast<uint64_t>(m_height) * static_cast<uint64_t>(m_channel);
+  }
+  
+  void NullImage::Bind(uint32_t slot) const
+  {
+    NullTextureUtils::SubmitBind(m_rendererID, slot);
+  }
+  
+  void NullImage::Unbind() const
+  {
+  }
+  
+  void NullImage::AttachToFramebuffer([[maybe_unused]] TextureAttachment attachmentType, [[maybe_unused]] uint32_t colorID,
+                                      [[maybe_unused]] uint32_t depthID, [[maybe_unused]] uint32_t level) const
+  {
+  }
+  
+  void NullImage::SetData([[maybe_unused]] void* data, [[maybe_unused]] uint32_t x, [[maybe_unused]] uint32_t y,
+                          [[maybe_unused]] uint32_t width, [[maybe_unused]] uint32_t height)
+  {
+  }
+  
+  uint32_t NullImage::GetWidth() const
+  {
+    return static_cast<uint32_t>(m_width);
+  }
+  
+  uint32_t NullImage::GetHeight() const
+  {
+    return static_cast<uint32_t>(m_height);
+  }
+  
+  RendererID NullImage::GetRendererID() const
+  {
+    return m_rendererID;
+  }
+  
+  const std::filesystem::path& NullImage::GetfilePath() const
+  {
+    return m_specification.filePath;
+  }
+  
+  const std::string& NullImage::GetName() const
+  {
+    return m_name;
+  }
+  
+  const Imagespecification& NullImage::GetSpecification() const
+  {
+    return m_specification;
+  }
+  
+  // Null Texture Array ----------------------------------------------------------------------------------------------
+  NullTextureArray::NullTextureArray(const TextureArraySpecification& spec)
+  : m_rendererID(NullRendererRecord::GenerateRendererID()), m_specification(spec)
+  {
+    IK_PROFILE();
+    RendererStatistics::Get().textureBufferSize += static_cast<uint64_t>(m_specification.width) * m_specification.height * m_specification.layers * 4;
+  }
+  
+  NullTextureArray::~NullTextureArray()
+  {
+    IK_PROFILE();
+    RendererStatistics::Get().textureBufferSize -= static_cast<uint64_t>(m_specification.width) * m_specification.height * m_specification.layers * 4;
+  }
+  
+  void NullTextureArray::Bind(uint32_t slot) const
+  {
+    NullTextureUtils::SubmitBind(m_rendererID, slot);
+  }
+  
+  void NullTextureArray::Unbind() const
+  {
+  }
+  
+  void NullTextureArray::AttachToFramebuffer([[maybe_unused]] TextureAttachment attachmentType, [[maybe_unused]] uint32_t colorID,
+                                             [[maybe_unused]] uint32_t depthID, [[maybe_unused]] uint32_t level) const
+  {
+  }
+  
+  void NullTextureArray::SetData([[maybe_unused]] void* data, [[maybe_unused]] uint32_t x, [[maybe_unused]] uint32_t y,
+                                 [[maybe_unused]] uint32_t width, [[maybe_unused]] uint32_t height)
+  {
+  }
+  
+  void NullTextureArray::CopyToLayer(const Ref<Texture>& texture, [[maybe_unused]] uint32_t layer)
+  {
+    Renderer::Submit([size = static_cast<uint64_t>(texture->GetWidth()) * texture->GetHeight() * 4]() {
+      NullRendererRecord::Get().textureBytes += size;
+    });
+  }
+  
+  void NullTextureArray::CopyLayers([[maybe_unused]] const Ref<TextureArray>& source, uint32_t layerCount)
+  {
+    Renderer::Submit([size = static_cast<uint64_t>(m_specification.width) * m_specification.height * 4 * layerCount]() {
+      NullRendererRecord::Get().textureBytes += size;
+    });
+  }
+  
+  uint32_t NullTextureArray::GetWidth() const
+  {
+    return m_specification.width;
+  }
+  
+  uint32_t NullTextureArray::GetHeight() const
+  {
+    return m_specification.height;
+  }
+  
+  uint32_t NullTextureArray::GetLayerCount() const
+  {
+    return m_specification.layers;
+  }
+  
+  RendererID NullTextureArray::GetRendererID() const
+  {
+    return m_rendererID;
+  }
+} // namespace IKan
@@ -0,0 +1,155 @@
+//
+//  NullTexture.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "Renderer/Graphics/Texture.hpp"
+
+namespace IKan
+{
+  /// This class implements the texture for Null renderer. Only size of texture data is recorded.
+  class NullTexture : public Texture
+  {
+  public:
+    /// This constructor creates the texture with specification.
+    /// - Parameter spec: Texture specification.
+    NullTexture(const Texture2DSpecification& spec);
+    /// This destructor destroys the Null texture.
+    ~NullTexture();
+    
+    /// This function records the texture bind.
+    /// - Parameter slot: Texture slot.
+    void Bind(uint32_t slot = 0) const override;
+    /// This function does nothing for Null renderer.
+    void Unbind() const override;
+    
+    /// This function does nothing for Null renderer.
+    /// - Parameters:
+    ///   - colorID : Color Attaachment ID to Framebuffer
+    ///   - depthID : Depth Attachment ID to Framebuffer
+    ///   - attachmentType: attachment type of texture
+    void AttachToFramebuffer(TextureAttachment attachmentType, uint32_t colorID = 0, uint32_t depthID = 0, uint32_t level = 0) const override;
+    /// This function records the size of updated region.
+    /// - Parameters:
+    ///   - data: data of region
+    ///   - x: x offset of region
+    ///   - y: y offset of region
+    ///   - width: width of region
+    ///   - height: height of region
+    void SetData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+    
+    /// This function returns the width of texture.
+    uint32_t GetWidth() const override;
+    /// This function returns the height of texture.
+    uint32_t GetHeight() const override;
+    /// This function returns the renderer ID of texture.
+    RendererID GetRendererID() const override;
+    
+    DELETE_COPY_MOVE_CONSTRUCTORS(NullTexture);
+    
+  private:
+    RendererID m_rendererID {0};
+    Texture2DSpecification m_specification;
+  };
+  
+  /// This class implements the image for Null renderer. Only the header of image file is read to get the size.
+  class NullImage : public Image
+  {
+  public:
+    /// This constructor creates the image with specification.
+    /// - Parameter spec: Image specification.
+    NullImage(const Imagespecification& spec);
+    /// This destructor destroys the Null image.
+    virtual ~NullImage();
+    
+    /// This function records the image bind.
+    /// - Parameter slot: Texture slot.
+    void Bind(uint32_t slot = 0) const override;
+    /// This function does nothing for Null renderer.
+    void Unbind() const override;
+    
+    /// This function does nothing for Null renderer.
+    /// - Parameters:
+    ///   - colorID : Color Attaachment ID to Framebuffer
+    ///   - depthID : Depth Attachment ID to Framebuffer
+    ///   - attachmentType: attachment type of texture
+    void AttachToFramebuffer(TextureAttachment attachmentType, uint32_t colorID = 0, uint32_t depthID = 0, uint32_t level = 0) const override;
+    /// This function does nothing for Null renderer.
+    void SetData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+    
+    /// This function returns the width of image.
+    uint32_t GetWidth() const override;
+    /// This function returns the height of image.
+    uint32_t GetHeight() const override;
+    /// This function returns the renderer ID of image.
+    RendererID GetRendererID() const override;
+    
+    /// This function returns the file path of image.
+    const std::filesystem::path& GetfilePath() const override;
+    /// This function returns the name of image.
+    const std::string& GetName() const override;
+    /// This function returns the specification of image.
+    const Imagespecification& GetSpecification() const override;
+    
+    DELETE_COPY_MOVE_CONSTRUCTORS(NullImage);
+    
+  private:
+    RendererID m_rendererID {0};
+    Imagespecification m_specification;
+    int32_t m_width {0};
+    int32_t m_height {0};
+    int32_t m_channel {0};
+    std::string m_name {};
+  };
+  
+  /// This class implements the texture array for Null renderer. Only size of layers copied is recorded.
+  class NullTextureArray : public TextureArray
+  {
+  public:
+    /// This constructor creates the texture array with specification.
+    /// - Parameter spec: Texture array specification.
+    NullTextureArray(const TextureArraySpecification& spec);
+    /// This destructor destroys the Null texture array.
+    virtual ~NullTextureArray();
+    
+    /// This function records the texture bind.
+    /// - Parameter slot: Texture slot.
+    void Bind(uint32_t slot = 0) const override;
+    /// This function does nothing for Null renderer.
+    void Unbind() const override;
+    
+    /// This function does nothing for Null renderer.
+    void AttachToFramebuffer(TextureAttachment attachmentType, uint32_t colorID = 0, uint32_t depthID = 0, uint32_t level = 0) const override;
+    /// This function does nothing for Null renderer.
+    void SetData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+    /// This function records the size of texture copied.
+    /// - Parameters:
+    ///   - texture: texture not bigger than array
+    ///   - layer: layer index
+    void CopyToLayer(const Ref<Texture>& texture, uint32_t layer) override;
+    /// This function records the size of layers copied.
+    /// - Parameters:
+    ///   - source: texture array of same size
+    ///   - layerCount: number of layers to be copied
+    void CopyLayers(const Ref<TextureArray>& source, uint32_t layerCount) override;
+    
+    /// This function returns the width of texture array.
+    uint32_t GetWidth() const override;
+    /// This function returns the height of texture array.
+    uint32_t GetHeight() const override;
+    /// This function returns the number of layers.
+    uint32_t GetLayerCount() const override;
+    /// This function returns the renderer ID of texture array.
+    RendererID GetRendererID() const override;
+    
+    DELETE_COPY_MOVE_CONSTRUCTORS(NullTextureArray);
+    
+  private:
+    RendererID m_rendererID {0};
+    TextureArraySpecification m_specification;
+  };
+} // namespace IKan
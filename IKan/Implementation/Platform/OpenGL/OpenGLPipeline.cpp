@@ -9,6 +9,8 @@
 
 #include <glad/glad.h>
 
+#include "Renderer/Graphics/RendererBuffer.hpp"
+
 namespace IKan
 {
 #define PIPELINE_LOG(...) IK_LOG_DEBUG(LogModule::Pipeline, __VA_ARGS__);
@@ -33,6 +35,10 @@ namespace IKan
         case ShaderDataType::Int3:     return GL_INT;
         case ShaderDataType::Int4:     return GL_INT;
         case ShaderDataType::Bool:     return GL_BOOL;
+        case ShaderDataType::Half2:    return GL_HALF_FLOAT;
+        case ShaderDataType::Half4:    return GL_HALF_FLOAT;
+        case ShaderDataType::Short2:   return GL_SHORT;
+        case ShaderDataType::UByte4:   return GL_UNSIGNED_BYTE;
       }
       
       IK_ASSERT(false, "Unknown ShaderDataType!");
@@ -43,6 +49,13 @@ namespace IKan
   OpenGLPipeline::OpenGLPipeline(const PipelineSpecification& spec)
   : m_specification(spec)
   {
+    // Instance attributes are located after all vertex attributes. Each column of matrix uses one location
+    for (const BufferElement& element : m_specification.vertexLayout.GetElements())
+    {
+      const bool isMatrix = element.type == ShaderDataType::Mat3 or element.type == ShaderDataType::Mat4;
+      m_instanceAttributeIndex += isMatrix ? element.count : 1;
+    }
+    
     Renderer::Submit([this](){
       IK_PROFILE();
       glGenVertexArrays(1, &m_rendererID);
@@ -74,6 +87,10 @@ namespace IKan
           case ShaderDataType::Float2:
           case ShaderDataType::Float3:
           case ShaderDataType::Float4:
+          case ShaderDataType::Half2:
+          case ShaderDataType::Half4:
+          case ShaderDataType::Short2:
+          case ShaderDataType::UByte4:
           {
             glEnableVertexAttribArray(index);
             glVertexAttribPointer(index, (int)element.count, PipelineUtils::ShaderDataTypeToOpenGLBaseType(element.type),
@@ -107,10 +124,11 @@ namespace IKan
   
   OpenGLPipeline::~OpenGLPipeline()
   {
-    Renderer::Submit([this](){
+    // Note: Pipeline is destroyed before command is executed, so renderer ID is copied
+    Renderer::Submit([rendererID = m_rendererID](){
       IK_PROFILE();
-      PIPELINE_LOG("Destroying Open GL Pipeline (ID : {0}).", m_rendererID);
-      glDeleteVertexArrays(1, &m_rendererID);
+      PIPELINE_LOG("Destroying Open GL Pipeline (ID : {0}).", rendererID);
+      glDeleteVertexArrays(1, &rendererID);
     });
     
     // Reset the shader on destruction
@@ -131,6 +149,44 @@ namespace IKan
     });
   }
   
+  void OpenGLPipeline::SetInstanceBuffer(const Ref<VertexBuffer>& instanceBuffer, uint32_t offset) const
+  {
+    Renderer::Submit([this, instanceBuffer, offset](){
+      glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer->GetRendererID());
+      
+      const BufferLayout& instanceLayout = m_specification.instanceLayout;
+      uint32_t index = m_instanceAttributeIndex;
+      for (const BufferElement& element : instanceLayout.GetElements())
+      {
+        // Integer attributes are read without conversion to float
+        const bool isInteger = element.type == ShaderDataType::Int or element.type == ShaderDataType::Int2 or
+                               element.type == ShaderDataType::Int3 or element.type == ShaderDataType::Int4;
+        if (isInteger)
+        {
+          glEnableVertexAttribArray(index);
+          glVertexAttribIPointer(index, (int)element.count, PipelineUtils::ShaderDataTypeToOpenGLBaseType(element.type),
+                                 (int)instanceLayout.GetStride(), (const void*)(offset + element.offset));
+          glVertexAttribDivisor(index, 1);
+          index++;
+          continue;
+        }
+        
+        // Matrix is set as columns of vectors
+        const bool isMatrix = element.type == ShaderDataType::Mat3 or element.type == ShaderDataType::Mat4;
+        const uint32_t columns = isMatrix ? element.count : 1;
+        for (uint32_t column = 0; column < columns; column++)
+        {
+          glEnableVertexAttribArray(index);
+          glVertexAttribPointer(index, (int)element.count, PipelineUtils::ShaderDataTypeToOpenGLBaseType(element.type),
+                                element.normalized ? GL_TRUE : GL_FALSE, (int)instanceLayout.GetStride(),
+                                (const void*)(offset + element.offset + sizeof(float) * element.count * column));
+          glVertexAttribDivisor(index, 1);
+          index++;
+        }
+      }
+    });
+  }
+  
   RendererID OpenGLPipeline::GetRendererID() const
   {
     return m_rendererID;
@@ -25,6 +25,11 @@ namespace IKan
     void Bind() const override;
     /// This function unbinds the current Pipeline from the renderer.
     void Unbind() const override;
+    /// This function sets the buffer of per instance attributes of instance layout for next instanced draws.
+    /// - Parameters:
+    ///   - instanceBuffer: vertex buffer having instance data.
+    ///   - offset: offset of first instance in buffer (in bytes).
+    void SetInstanceBuffer(const Ref<VertexBuffer>& instanceBuffer, uint32_t offset) const override;
     
     /// This function returns the renderer ID of Pipeline.
     RendererID GetRendererID() const override;
@@ -36,6 +41,7 @@ namespace IKan
 
   private:
     RendererID m_rendererID {0};
+    uint32_t m_instanceAttributeIndex {0};
     PipelineSpecification m_specification;
   };
 } // namespace IKan
@@ -150,5 +150,14 @@ namespace IKan
     
     RendererStatistics::Get().drawCalls++;
   }
+  
+  void OpenGLRendererAPI::DrawIndexedBaseVertexInstanced(uint32_t indexCount, void* indicesData, uint32_t baseVertex, uint32_t instanceCount) const
+  {
+    Renderer::Submit([indexCount, indicesData, baseVertex, instanceCount](){
+      glDrawElementsInstancedBaseVertex(GL_TRIANGLES, (GLsizei)indexCount, GL_UNSIGNED_INT, indicesData, (GLsizei)instanceCount, (GLint)baseVertex);
+    });
+    
+    RendererStatistics::Get().drawCalls++;
+  }
 
 } // namespace IKan
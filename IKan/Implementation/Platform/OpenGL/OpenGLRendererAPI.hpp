@@ -62,6 +62,13 @@ namespace IKan
     ///   - indicesData: indices data.
     ///   - baseVertex: base vertex.
     void DrawIndexedBaseVertex(uint32_t indexCount, void* indicesData, uint32_t baseVertex) const override;
+    /// This function draw the index based vertex for multiple instances.
+    /// - Parameters:
+    ///   - indexCount: index count.
+    ///   - indicesData: indices data.
+    ///   - baseVertex: base vertex.
+    ///   - instanceCount: number of instances.
+    void DrawIndexedBaseVertexInstanced(uint32_t indexCount, void* indicesData, uint32_t baseVertex, uint32_t instanceCount) const override;
 
     DELETE_COPY_MOVE_CONSTRUCTORS(OpenGLRendererAPI);
   };
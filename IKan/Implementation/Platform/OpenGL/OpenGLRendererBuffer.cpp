@@ -70,8 +70,9 @@ namespace IKan
     IK_LOG_DEBUG(LogModule::VertexBuffer, "  Size              | {0} B", m_size);
     IK_LOG_DEBUG(LogModule::VertexBuffer, "  Total Size Left   | {0} B", RendererStatistics::Get().vertexBufferSize);
     
-    Renderer::Submit([this]() {
-      glDeleteBuffers(1, &m_rendererID);
+    // Note: Buffer is destroyed before command is executed, so renderer ID is copied
+    Renderer::Submit([rendererID = m_rendererID]() {
+      glDeleteBuffers(1, &rendererID);
     });
   }
   
@@ -142,15 +143,16 @@ namespace IKan
   
   OpenGLIndexBuffer::~OpenGLIndexBuffer()
   {
-    Renderer::Submit([this](){
+    // Note: Buffer is destroyed before command is executed, so data is copied
+    Renderer::Submit([rendererID = m_rendererID, size = m_size](){
       IK_PROFILE();
-      RendererStatistics::Get().indexBufferSize -= m_size;
-      glDeleteBuffers(1, &m_rendererID);
+      RendererStatistics::Get().indexBufferSize -= size;
+      glDeleteBuffers(1, &rendererID);
       
       IK_LOG_DEBUG(LogModule::IndexBuffer, "Destroying Open GL Index Buffer.");
-      IK_LOG_DEBUG(LogModule::IndexBuffer, "  Renderer ID            | {0}", m_rendererID);
+      IK_LOG_DEBUG(LogModule::IndexBuffer, "  Renderer ID            | {0}", rendererID);
       IK_LOG_DEBUG(LogModule::IndexBuffer, "  Size of single Indices | {0} B", SizeOfSingleIndices);
-      IK_LOG_DEBUG(LogModule::IndexBuffer, "  Size                   | {0} B", m_size);
+      IK_LOG_DEBUG(LogModule::IndexBuffer, "  Size                   | {0} B", size);
       IK_LOG_DEBUG(LogModule::IndexBuffer, "  Total Size Left        | {0} B", RendererStatistics::Get().indexBufferSize);
     });
   }
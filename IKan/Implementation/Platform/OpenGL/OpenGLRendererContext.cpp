@@ -43,4 +43,14 @@ namespace IKan
     IK_PERFORMANCE("OpenGLRendererContext::SwapBuffers")
     glfwSwapBuffers(m_window);
   }
+  
+  void OpenGLRendererContext::MakeCurrent()
+  {
+    glfwMakeContextCurrent(m_window);
+  }
+  
+  void OpenGLRendererContext::ReleaseCurrent()
+  {
+    glfwMakeContextCurrent(nullptr);
+  }
 } // namespace IKan
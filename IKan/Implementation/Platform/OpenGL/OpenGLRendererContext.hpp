@@ -23,6 +23,10 @@ namespace IKan
     
     /// This function swaps the renderer buffers, Should be called each frame.
     void SwapBuffers() override;
+    /// This function makes the Open GL context current on the calling thread.
+    void MakeCurrent() override;
+    /// This function releases the Open GL context from the calling thread.
+    void ReleaseCurrent() override;
     
     DELETE_COPY_MOVE_CONSTRUCTORS(OpenGLRendererContext);
     
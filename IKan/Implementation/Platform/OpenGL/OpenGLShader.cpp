@@ -66,6 +66,7 @@ namespace IKan
     {
       if (type == "sampler2D")          return true;
       if (type == "sampler2DMS")        return true;
+      if (type == "sampler2DArray")     return true;
       if (type == "samplerCube")        return true;
       if (type == "sampler2DShadow")    return true;
       return false;
@@ -151,6 +152,27 @@ namespace IKan
     ResolveUniforms();
   }
   
+  OpenGLShader::OpenGLShader(const std::filesystem::path& shaderFilePath, ReflectionOnly)
+  : m_reflectionOnly(true), m_filePath(shaderFilePath), m_name(shaderFilePath.filename())
+  {
+    IK_PROFILE();
+    IK_ASSERT(m_filePath != "", "Empty File Path!");
+    SHADER_LOG("Creating '{0}' for Shader reflection.", m_name);
+    
+    // Extract the file and store the glsl code as text string
+    std::string shaderString = Utils::String::ReadFromFile(m_filePath);
+    IK_ASSERT(shaderString != "", "Empty File Content!");
+    
+    // Process the shader codes
+    PreprocessShader(shaderString);
+    
+    // Parse shader and Store all the structures and uniforms in Shader class
+    Parse();
+    
+    // Resolve the sampler registers. Uniform locations are not resolved without program
+    ResolveUniforms();
+  }
+  
   OpenGLShader::~OpenGLShader()
   {
     SHADER_LOG("Destroying '{0}' for Open GL (ID : {1}).", m_name, m_rendererID);
@@ -481,21 +503,22 @@ namespace IKan
         }
         sampler++;
       }
-      // For arrya of samplers
+      // For arrya of samplers. Arrays use consecutive slots after previous samplers
       else if (resource->GetCount() > 1)
       {
-        resource->m_register = 0;
+        resource->m_register = sampler;
         
         uint32_t count = resource->GetCount();
         int32_t* samplers = new int32_t[count];
         
         for (uint32_t s = 0; s < count; s++)
         {
-          samplers[s] = (int32_t)s;
+          samplers[s] = (int32_t)(sampler + s);
         }
-        SHADER_LOG("      Location : {0} to {1} for {2}[{3}]", 0, count, resource->GetName(), resource->GetCount());
+        SHADER_LOG("      Location : {0} to {1} for {2}[{3}]", sampler, sampler + count, resource->GetName(), resource->GetCount());
         SetIntArray(resource->GetName(), samplers, count);
         delete[] samplers;
+        sampler += count;
       }
     } // for (size_t i = 0; i < resources_.size(); i++)
     
@@ -581,6 +604,11 @@ namespace IKan
   
   int32_t OpenGLShader::GetUniformLocation(std::string_view name)
   {
+    if (m_reflectionOnly)
+    {
+      return -1;
+    }
+    
     if (m_locationMap.find(name) != m_locationMap.end())
     {
       return m_locationMap.at(name);
@@ -821,12 +849,22 @@ namespace IKan
   // Uniforms with name ----------------------------------------------------------------------------------------------
   void OpenGLShader::SetUniformInt1(std::string_view name, int32_t value)
   {
+    if (m_reflectionOnly)
+    {
+      return;
+    }
+    
     glUseProgram(m_rendererID);
     glUniform1i(GetUniformLocation(name), value);
   }
   
   void OpenGLShader::SetIntArray(std::string_view name, int32_t* values, uint32_t count)
   {
+    if (m_reflectionOnly)
+    {
+      return;
+    }
+    
     glUseProgram(m_rendererID);
     int32_t* textureArraySlotData = new int32_t[count];
     memcpy(textureArraySlotData, values, count * sizeof(int32_t));
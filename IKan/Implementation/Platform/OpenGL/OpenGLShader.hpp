@@ -109,6 +109,15 @@ namespace IKan
     
     DELETE_COPY_MOVE_CONSTRUCTORS(OpenGLShader);
     
+  protected:
+    /// Tag to create the shader only for reflection of GLSL code
+    struct ReflectionOnly {};
+    
+    /// This consturctor parses the shader code and reflects the structures, uniforms and resources without creating
+    /// Open GL program. Used by renderers that share the GLSL shaders but not the Open GL context
+    /// - Parameter shaderFilePath: Shader Code file path
+    OpenGLShader(const std::filesystem::path& shaderFilePath, ReflectionOnly);
+    
   private:
     // Member Functions ----------------------------------------------------------------------------------------------
     /// This function reads the shader code in string and store all the shader code in a map to be used by compiler.
@@ -185,6 +194,7 @@ namespace IKan
     
     // Member Variables ----------------------------------------------------------------------------------------------
     RendererID m_rendererID {0};
+    bool m_reflectionOnly {false};
     std::filesystem::path m_filePath {};
     std::string m_name {};
     
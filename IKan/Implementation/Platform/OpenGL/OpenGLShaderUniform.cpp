@@ -139,6 +139,7 @@ namespace IKan
   {
     if (type == "sampler2D")    return Type::Texture2D;
     if (type == "sampler2DMS")  return Type::Texture2D;
+    if (type == "sampler2DArray") return Type::Texture2DArray;
     if (type == "samplerCube")  return Type::TextureCubeMap;
     
     return Type::None;
@@ -151,6 +152,7 @@ namespace IKan
       case Type::None:           return "None       ";
       case Type::Texture2D:      return "sampler2D  ";
       case Type::TextureCubeMap: return "samplerCube";
+      case Type::Texture2DArray: return "sampler2DArray";
     }
     return "Invalid Type";
   }
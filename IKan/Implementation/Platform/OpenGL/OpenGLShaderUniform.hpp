@@ -101,7 +101,7 @@ namespace IKan
     /// This enum stores the Shader unifor resource type
     enum class Type : uint8_t
     {
-      None, Texture2D, TextureCubeMap
+      None, Texture2D, TextureCubeMap, Texture2DArray
     };
     
     /// This constructor creates the resource uniform of shader.
@@ -10,17 +10,11 @@
 #include <glad/glad.h>
 #include <stb_image.h>
 
-#include <ft2build.h>
-#include FT_FREETYPE_H
-
 #include "Renderer/RendererStats.hpp"
 #include "Platform/OpenGL/OpenGLSpecification.hpp"
 
 namespace IKan
 {
-#define CHAR_TEXTURE_SUBMIT 0
-#define CHAR_DEBUG_TEXTURE_LOG 0
-  
   // Open GL Texture ------------------------------------------------------------------------------------
   OpenGLTexture::OpenGLTexture(const Texture2DSpecification& spec)
   : m_specification(spec)
@@ -154,6 +148,23 @@ namespace IKan
     });
   }
   
+  void OpenGLTexture::SetData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+  {
+    IK_ASSERT(TextureType::Texture2D == m_specification.type, "Only 2D texture can be updated!");
+    IK_ASSERT(x + width <= m_specification.width and y + height <= m_specification.height, "Region is outside the texture!");
+    
+    // Data is copied as render thread uploads it later
+    const uint32_t channel = TextureFormat::RED == m_specification.dataFormat ? 1 : (TextureFormat::RGBA == m_specification.dataFormat ? 4 : 3);
+    Renderer::Submit([this, x, y, width, height, localData = Buffer::Copy(data, width * height * channel)]() {
+      GLenum dataFormat = TextureUtils::OpenGLFormatFromIKanFormat(m_specification.dataFormat);
+      GLenum dataType = TextureUtils::GetTextureDataType(TextureUtils::OpenGLFormatFromIKanFormat(m_specification.internalFormat));
+      
+      glBindTexture(GL_TEXTURE_2D, m_rendererID);
+      glTexSubImage2D(GL_TEXTURE_2D, 0, /* Level */ (GLint)x, (GLint)y, (GLsizei)width, (GLsizei)height, dataFormat, dataType,
+                      localData.data);
+    });
+  }
+  
   RendererID OpenGLTexture::GetRendererID() const
   {
     return m_rendererID;
@@ -174,19 +185,15 @@ namespace IKan
     IK_PROFILE();
     m_name = m_specification.filePath.filename();
     
-    Renderer::Submit([this]() {
-      // Invert Image
-      if (m_specification.invertVertically)
-      {
-        stbi_set_flip_vertically_on_load(1);
-      }
-      
-      // Load the file with stb image API
-      // TODO: IKan: Move this outside Submit
-      void* data = stbi_load(m_specification.filePath.c_str(), &m_width, &m_height, &m_channel, 0 /* desired_channels */);
-      
-      IK_ASSERT(data, "Data is NULL!");
-      
+    // Decode the file with stb image API on calling thread, so that image can be loaded off the render thread. Flip
+    // flag is thread local
+    stbi_set_flip_vertically_on_load_thread(m_specification.invertVertically ? 1 : 0);
+    // Data is owned by command, so it is freed even if command is discarded without being executed
+    std::shared_ptr<stbi_uc> data(stbi_load(m_specification.filePath.c_str(), &m_width, &m_height, &m_channel, 0 /* desired_channels */),
+                                  stbi_image_free);
+    IK_ASSERT(data, "Data is NULL!");
+    
+    Renderer::Submit([this, data]() mutable {
       // If file loaded successfullY
       TextureFormat internalFormat = TextureFormat::RGBA8;
       TextureFormat dataFormat = TextureFormat::RGBA;
@@ -228,7 +235,7 @@ namespace IKan
       GLenum glDataFormat = TextureUtils::OpenGLFormatFromIKanFormat(dataFormat);
       
       glTexImage2D(GL_TEXTURE_2D, 0, /* Level */ (GLint)glInternalFormat, (GLsizei)m_width, (GLsizei)m_height, 0,
-                   /* Border */ glDataFormat, TextureUtils::GetTextureDataType(glInternalFormat), data);
+                   /* Border */ glDataFormat, TextureUtils::GetTextureDataType(glInternalFormat), data.get());
       
       // Store the size of texture in Data
       m_size = (uint32_t)m_width * (uint32_t)m_height * (uint32_t)m_channel;
@@ -237,7 +244,7 @@ namespace IKan
       RendererStatistics::Get().textureBufferSize += m_size;
       
       // Delete the data as we have already loaded in graphics
-      delete (stbi_uc*)data;
+      data.reset();
       
       IK_LOG_DEBUG(LogModule::Texture, "Creating Open GL Image Texture from File ... ");
       IK_LOG_DEBUG(LogModule::Texture, "  File Path          | {0}", Utils::FileSystem::IKanAbsolute(m_specification.filePath).string());
@@ -271,8 +278,9 @@ namespace IKan
     
     RendererStatistics::Get().textureBufferSize -= m_size;
     
-    Renderer::Submit([this] {
-      glDeleteTextures(1, &m_rendererID);
+    // Note: Image is destroyed before command is executed, so renderer ID is copied
+    Renderer::Submit([rendererID = m_rendererID] {
+      glDeleteTextures(1, &rendererID);
     });
   }
   
@@ -295,6 +303,12 @@ namespace IKan
   {
     IK_ASSERT(false);
   }
+  
+  void OpenGLImage::SetData([[maybe_unused]] void* data, [[maybe_unused]] uint32_t x, [[maybe_unused]] uint32_t y,
+                            [[maybe_unused]] uint32_t width, [[maybe_unused]] uint32_t height)
+  {
+    IK_ASSERT(false, "Image data is loaded from file only!");
+  }
 
   RendererID OpenGLImage::GetRendererID() const
   {
@@ -318,101 +332,148 @@ namespace IKan
   {
     return m_name;
   }
+  const Imagespecification& OpenGLImage::GetSpecification() const
+  {
+    return m_specification;
+  }
+  uint64_t OpenGLImage::GetGPUMemorySize() const
+  {
+    // Note: Size is computed from loaded image as 'm_size' is updated only when texture is created on render thread
+    return static_cast<uint64_t>(m_width) * static_cast<uint64_t>(m_height) * static_cast<uint64_t>(m_channel);
+  }
   
-  // Open GL Char Texture -------------------------------------------------------------------------------
-  OpenGLCharTexture::OpenGLCharTexture(const CharTextureSpecification& charTextureSpec)
-  : m_specification(charTextureSpec)
-  {
-    // Note: Do not submite in queue as this face pointer is local is not copied. This happens once so no runtime issues
-#if CHAR_TEXTURE_SUBMIT
-    Renderer::Submit([this, name, values, count]() {
-#endif
+  // Open GL Texture Array ------------------------------------------------------------------------------
+  OpenGLTextureArray::OpenGLTextureArray(const TextureArraySpecification& spec)
+  : m_specification(spec)
+  {
+    Renderer::Submit([this]() {
       IK_PROFILE();
       glGenTextures(1, &m_rendererID);
-      glBindTexture(GL_TEXTURE_2D, m_rendererID);
-      
-      // Create texture in the renderer Buffer
-      glTexImage2D(GL_TEXTURE_2D, 0, /* Level */ GL_RED, (GLsizei)m_specification.face->glyph->bitmap.width, (GLsizei)m_specification.face->glyph->bitmap.rows,
-                   0, /* Border */ GL_RED, GL_UNSIGNED_BYTE, m_specification.face->glyph->bitmap.buffer );
+      glBindTexture(GL_TEXTURE_2D_ARRAY, m_rendererID);
+      glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, /* Level */ GL_RGBA8, (GLsizei)m_specification.width, (GLsizei)m_specification.height,
+                   (GLsizei)m_specification.layers, 0, /* Border */ GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
       
-      m_width = (uint32_t)m_specification.face->glyph->bitmap.width;
-      m_height = (uint32_t)m_specification.face->glyph->bitmap.rows;
+      // Set the Texture filter
+      glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, TextureUtils::OpenGLFilterFromIKanFilter(m_specification.minFilter));
+      glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, TextureUtils::OpenGLFilterFromIKanFilter(m_specification.magFilter));
       
-      // set texture options
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+      // Set the Texture wraps
+      glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, TextureUtils::OpenGLWrapFromIKanWrap(m_specification.Xwrap));
+      glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, TextureUtils::OpenGLWrapFromIKanWrap(m_specification.Ywrap));
       
-#if CHAR_DEBUG_TEXTURE_LOG
-      IK_LOG_TRACE(LogModule::CharTexture, "Creating Open GL Char Texture to store Char {0} ( Renderer ID {1} )", m_specification.charVal, m_rendererID);
-#endif
+      // Framebuffer to read the textures copied in layers
+      glGenFramebuffers(1, &m_copyFramebufferID);
       
-      // Increment the size in stats
-      m_dataSize = m_specification.face->glyph->bitmap.width * m_specification.face->glyph->bitmap.rows;
-      RendererStatistics::Get().textureBufferSize += m_dataSize;
+      RendererStatistics::Get().textureBufferSize += static_cast<uint64_t>(m_specification.width) * m_specification.height * m_specification.layers * 4;
       
-#if CHAR_TEXTURE_SUBMIT
+      IK_LOG_DEBUG(LogModule::Texture, "Creating Open GL Texture Array ");
+      IK_LOG_DEBUG(LogModule::Texture, "  Name              | {0}", m_specification.title);
+      IK_LOG_TRACE(LogModule::Texture, "  Renderer ID       | {0}", m_rendererID);
+      IK_LOG_TRACE(LogModule::Texture, "  Size              | {0} x {1}", m_specification.width, m_specification.height);
+      IK_LOG_TRACE(LogModule::Texture, "  Layers            | {0}", m_specification.layers);
     });
-#endif
   }
   
-  OpenGLCharTexture::~OpenGLCharTexture()
+  OpenGLTextureArray::~OpenGLTextureArray()
   {
     IK_PROFILE();
-    RendererStatistics::Get().textureBufferSize -= m_dataSize;
-#if CHAR_TEXTURE_SUBMIT
+    RendererStatistics::Get().textureBufferSize -= static_cast<uint64_t>(m_specification.width) * m_specification.height * m_specification.layers * 4;
+    
+    IK_LOG_DEBUG(LogModule::Texture, "Destroying Open GL Texture Array ");
+    IK_LOG_DEBUG(LogModule::Texture, "  Name              | {0}", m_specification.title);
     Renderer::Submit([this] {
-#endif
+      glDeleteFramebuffers(1, &m_copyFramebufferID);
       glDeleteTextures(1, &m_rendererID);
-#if CHAR_TEXTURE_SUBMIT
     });
-#endif
   }
   
-  void OpenGLCharTexture::Bind(uint32_t slot) const
+  void OpenGLTextureArray::Bind(uint32_t slot) const
   {
-    Renderer::Submit([this, slot] {
+    Renderer::Submit([this, slot]() {
       glActiveTexture(GL_TEXTURE0 + slot);
-      glBindTexture(GL_TEXTURE_2D, m_rendererID);
+      glBindTexture(GL_TEXTURE_2D_ARRAY, m_rendererID);
     });
   }
-  void OpenGLCharTexture::Unbind() const
+  
+  void OpenGLTextureArray::Unbind() const
   {
-    Renderer::Submit([] {
-      glBindTexture(GL_TEXTURE_2D, 0);
+    Renderer::Submit([]() {
+      glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
     });
   }
   
-  void OpenGLCharTexture::AttachToFramebuffer([[maybe_unused]] TextureAttachment attachmentType, [[maybe_unused]] uint32_t colorID,
-                                              [[maybe_unused]] uint32_t depthID, [[maybe_unused]] uint32_t level) const
+  void OpenGLTextureArray::AttachToFramebuffer([[maybe_unused]] TextureAttachment attachmentType, [[maybe_unused]] uint32_t colorID,
+                                               [[maybe_unused]] uint32_t depthID, [[maybe_unused]] uint32_t level) const
   {
     IK_ASSERT(false);
   }
   
-  RendererID OpenGLCharTexture::GetRendererID() const
+  void OpenGLTextureArray::SetData([[maybe_unused]] void* data, [[maybe_unused]] uint32_t x, [[maybe_unused]] uint32_t y,
+                                   [[maybe_unused]] uint32_t width, [[maybe_unused]] uint32_t height)
   {
-    return m_rendererID;
+    IK_ASSERT(false, "Texture array layers are filled by copying textures!");
+  }
+  
+  void OpenGLTextureArray::CopyToLayer(const Ref<Texture>& texture, uint32_t layer)
+  {
+    IK_ASSERT(texture->GetWidth() <= m_specification.width and texture->GetHeight() <= m_specification.height, "Invalid texture size!");
+    IK_ASSERT(layer < m_specification.layers, "Invalid layer!");
+    
+    // Texture is captured, so that it is alive till it is copied
+    Renderer::Submit([this, texture, layer, width = texture->GetWidth(), height = texture->GetHeight()]() {
+      // Copy is done between draws of render pass, so read framebuffer of pass is restored
+      GLint readFramebuffer = 0;
+      glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFramebuffer);
+      
+      glBindFramebuffer(GL_READ_FRAMEBUFFER, m_copyFramebufferID);
+      glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture->GetRendererID(), 0);
+      glReadBuffer(GL_COLOR_ATTACHMENT0);
+      
+      glBindTexture(GL_TEXTURE_2D_ARRAY, m_rendererID);
+      glCopyTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, /* Level */ 0, 0, (GLint)layer, 0, 0, (GLsizei)width, (GLsizei)height);
+      
+      glBindFramebuffer(GL_READ_FRAMEBUFFER, (GLuint)readFramebuffer);
+    });
   }
-  uint32_t OpenGLCharTexture::GetWidth() const
+  
+  void OpenGLTextureArray::CopyLayers(const Ref<TextureArray>& source, uint32_t layerCount)
   {
-    return m_width;
+    IK_ASSERT(source->GetWidth() == m_specification.width and source->GetHeight() == m_specification.height, "Invalid array size!");
+    IK_ASSERT(layerCount <= m_specification.layers and layerCount <= source->GetLayerCount(), "Invalid layer count!");
+    
+    // Source is captured, so that it is alive till it is copied
+    Renderer::Submit([this, source, layerCount]() {
+      GLint readFramebuffer = 0;
+      glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFramebuffer);
+      
+      glBindFramebuffer(GL_READ_FRAMEBUFFER, m_copyFramebufferID);
+      glBindTexture(GL_TEXTURE_2D_ARRAY, m_rendererID);
+      for (uint32_t layer = 0; layer < layerCount; layer++)
+      {
+        glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, source->GetRendererID(), 0, (GLint)layer);
+        glReadBuffer(GL_COLOR_ATTACHMENT0);
+        glCopyTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, /* Level */ 0, 0, (GLint)layer, 0, 0,
+                            (GLsizei)m_specification.width, (GLsizei)m_specification.height);
+      }
+      
+      glBindFramebuffer(GL_READ_FRAMEBUFFER, (GLuint)readFramebuffer);
+    });
   }
-  uint32_t OpenGLCharTexture::GetHeight() const
+  
+  uint32_t OpenGLTextureArray::GetWidth() const
   {
-    return m_height;
+    return m_specification.width;
   }
-  glm::ivec2 OpenGLCharTexture::GetSize() const
+  uint32_t OpenGLTextureArray::GetHeight() const
   {
-    return m_specification.size;
+    return m_specification.height;
   }
-  glm::ivec2 OpenGLCharTexture::GetBearing() const
+  uint32_t OpenGLTextureArray::GetLayerCount() const
   {
-    return m_specification.bearing;
+    return m_specification.layers;
   }
-  uint32_t OpenGLCharTexture::GetAdvance() const
+  RendererID OpenGLTextureArray::GetRendererID() const
   {
-    return m_specification.advance;
+    return m_rendererID;
   }
-  
 } // namespace IKan
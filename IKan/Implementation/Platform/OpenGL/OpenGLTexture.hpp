@@ -34,6 +34,14 @@ namespace IKan
     ///   - depthID : Depth Attachment ID to Framebuffer.
     ///   - level : level of framebuffer attachment.
     void AttachToFramebuffer(TextureAttachment attachmentType, uint32_t colorID = 0, uint32_t depthID = 0, uint32_t level = 0) const override;
+    /// This function updates the region of texture.
+    /// - Parameters:
+    ///   - data: data of region in texture data format.
+    ///   - x: x offset of region.
+    ///   - y: y offset of region.
+    ///   - width: width of region.
+    ///   - height: height of region.
+    void SetData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
     
     /// This function returns width of texture.
     uint32_t GetWidth() const override;
@@ -73,6 +81,8 @@ namespace IKan
     ///   - depthID : Depth Attachment ID to Framebuffer.
     ///   - level : level of framebuffer attachment.
     void AttachToFramebuffer(TextureAttachment attachmentType, uint32_t colorID = 0, uint32_t depthID = 0, uint32_t level = 0) const override;
+    /// This function asserts as image data is loaded from file only.
+    void SetData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
     
     /// This function returns width of image.
     uint32_t GetWidth() const override;
@@ -85,6 +95,10 @@ namespace IKan
     const std::filesystem::path& GetfilePath() const override;
     /// This function returns name of image.
     const std::string& GetName() const override;
+    /// This function returns specification of image.
+    const Imagespecification& GetSpecification() const override;
+    /// This function returns size of image in GPU.
+    uint64_t GetGPUMemorySize() const override;
     
     DELETE_COPY_MOVE_CONSTRUCTORS(OpenGLImage);
     
@@ -98,49 +112,51 @@ namespace IKan
     std::string m_name {};
   };
   
-  /// This class implements the APIs to create character texture for Open GL.
-  class OpenGLCharTexture : public CharTexture
+  /// This class implements the APIs to create 2D texture array for Open GL.
+  class OpenGLTextureArray : public TextureArray
   {
   public:
-    /// This constructor creates the Open GL character texture from specification.
-    /// - Parameter charTextureSpec: Character texture specification
-    OpenGLCharTexture(const CharTextureSpecification& charTextureSpec);
-    /// This destructor destroyes and deletes the Open GL character texture.
-    virtual ~OpenGLCharTexture();
+    /// This constructor creates the Open GL texture array from specification.
+    /// - Parameter spec: Texture array specification.
+    OpenGLTextureArray(const TextureArraySpecification& spec);
+    /// This destructor destroyes and deletes the Open GL texture array.
+    virtual ~OpenGLTextureArray();
     
-    /// This function binds the character texture at slot inside shader.
-    /// - Parameter slot: shader slot where this character texture to be binded.
-    void Bind(uint32_t slot) const override;
-    /// This function unbinds the character texture
-    void Unbind() const  override;
+    /// This function binds the texture array at slot inside shader.
+    /// - Parameter slot: shader slot where this texture array to be binded.
+    void Bind(uint32_t slot = 0) const override;
+    /// This function unbinds the texture array.
+    void Unbind() const override;
     
-    /// This function attach the current Image to Framebuffer
-    /// - Parameters:
-    ///   - attachmentType: attachment type of character texture.
-    ///   - colorID : Color Attaachment ID to Framebuffer
-    ///   - depthID : Depth Attachment ID to Framebuffer
-    ///   - level : level of framebuffer attachment.
+    /// This function asserts as texture array can not be attached to framebuffer.
     void AttachToFramebuffer(TextureAttachment attachmentType, uint32_t colorID = 0, uint32_t depthID = 0, uint32_t level = 0) const override;
+    /// This function asserts as layers are filled by copying textures only.
+    void SetData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+    /// This function copies the texture at origin of layer using read framebuffer.
+    /// - Parameters:
+    ///   - texture: texture not bigger than array.
+    ///   - layer: layer index.
+    void CopyToLayer(const Ref<Texture>& texture, uint32_t layer) override;
+    /// This function copies the layers of other array using read framebuffer.
+    /// - Parameters:
+    ///   - source: texture array of same size.
+    ///   - layerCount: number of layers to be copied.
+    void CopyLayers(const Ref<TextureArray>& source, uint32_t layerCount) override;
     
-    /// This function returns the Renderer ID.
-    RendererID GetRendererID() const override;
-    /// This function returns width of texture.
+    /// This function returns width of texture array.
     uint32_t GetWidth() const override;
-    /// This function returns height of texture.
+    /// This function returns height of texture array.
     uint32_t GetHeight() const override;
-    /// This function returns the size.
-    glm::ivec2 GetSize() const override;
-    /// This function returns the bearing.
-    glm::ivec2 GetBearing() const override;
-    /// This function returns the advance.
-    uint32_t GetAdvance() const override;
+    /// This function returns number of layers.
+    uint32_t GetLayerCount() const override;
+    /// This function returns renderer ID of texture array.
+    RendererID GetRendererID() const override;
     
-    DELETE_COPY_MOVE_CONSTRUCTORS(OpenGLCharTexture);
+    DELETE_COPY_MOVE_CONSTRUCTORS(OpenGLTextureArray);
     
   private:
-    RendererID m_rendererID {};
-    CharTextureSpecification m_specification;
-    uint32_t m_dataSize {0};
-    uint32_t m_width {0}, m_height {0};
+    RendererID m_rendererID {0};
+    RendererID m_copyFramebufferID {0};
+    TextureArraySpecification m_specification;
   };
 } // namespace IKan
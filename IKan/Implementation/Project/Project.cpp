@@ -37,6 +37,10 @@ namespace IKan
   {
     m_config.sceneType = sceneType;
   }
+  void Project::UpdateBinaryScenes(bool flag)
+  {
+    m_config.binaryScenes = flag;
+  }
 
   void Project::SetActive(Ref<Project> project)
   {
@@ -132,6 +136,11 @@ namespace IKan
     IK_ASSERT(s_activeProject);
     return std::filesystem::path(s_activeProject->GetConfig().projectDirectory) / s_activeProject->GetConfig().physicsPath;
   }
+  std::filesystem::path Project::GetCacheDirectory()
+  {
+    IK_ASSERT(s_activeProject);
+    return std::filesystem::path(s_activeProject->GetConfig().projectDirectory) / "Cache";
+  }
 
   std::filesystem::path Project::GetAssetPath(const std::filesystem::path& assetRelativePath)
   {
@@ -52,6 +52,7 @@ namespace IKan
       out << YAML::Key << "StartScene" << YAML::Value << m_project->m_config.startScene;
       out << YAML::Key << "AutoSave" << YAML::Value << m_project->m_config.enableAutoSave;
       out << YAML::Key << "AutoSaveInterval" << YAML::Value << m_project->m_config.autoSaveIntervalSeconds;
+      out << YAML::Key << "BinaryScenes" << YAML::Value << m_project->m_config.binaryScenes;
       out << YAML::EndMap;
     }
     out << YAML::EndMap;
@@ -101,6 +102,7 @@ namespace IKan
     config.startScene = rootNode["StartScene"].as<std::string>("");
     config.enableAutoSave = rootNode["AutoSave"].as<bool>(false);
     config.autoSaveIntervalSeconds = rootNode["AutoSaveInterval"].as<int>(300);
+    config.binaryScenes = rootNode["BinaryScenes"].as<bool>(false);
     
     // Unserialized data
     config.projectFileName = filepath.filename().string();
@@ -67,6 +67,8 @@ namespace IKan
       glm::vec2 textureCoords;
       
       float textureIndex {0};
+      float textureLayer {-1}; // Layer in texture array slot, -1 if texture index is texture slot
+      glm::vec2 textureScale {1.0f}; // Size of image relative to size of texture array layer
       float tilingFactor {0};
       
       int32_t pixelID {-1};
@@ -76,6 +78,10 @@ namespace IKan
     static constexpr uint32_t VertexForSingleElement = 4;
     static constexpr uint32_t IndicesForSingleElement = 6;
     
+    /// Half of the shader slots are used for textures and half for texture arrays
+    static constexpr uint32_t MaxTextureSlots = Texture2DSpecification::MaxTextureSlotsInShader / 2;
+    static constexpr uint32_t MaxTextureArraySlots = Texture2DSpecification::MaxTextureSlotsInShader - MaxTextureSlots;
+    
     // Member Variables ----------------------------------------------------------------------------------------------
     /// Batch limits
     uint32_t maxIndicesPerBatch {0};
@@ -88,11 +94,29 @@ namespace IKan
     /// - Note: Slot 0 is reserved for white texture (No Image only color)
     uint32_t textureSlotIndex {1};
     
-    /// Stores all the 16 Texture in array so that there is no need to load texture each frame
+    /// Stores all the 8 Texture in array so that there is no need to load texture each frame
     /// - Note: Load only if new texture is added or older replaced with new
-    std::array<Ref<Texture>, Texture2DSpecification::MaxTextureSlotsInShader> textureSlots;
+    std::array<Ref<Texture>, MaxTextureSlots> textureSlots;
+    
+    /// Texture array slot index sent to Shader. Images are rendered from layers of texture arrays
+    uint32_t arraySlotIndex {0};
+    /// Stores the texture arrays used in batch. Texture arrays are bound after texture slots
+    std::array<Ref<TextureArray>, MaxTextureArraySlots> arraySlots;
 
     // Member Functions ----------------------------------------------------------------------------------------------
+    /// This function binds the textures and texture arrays used in batch
+    void BindTextures() const
+    {
+      for (uint32_t i = 0; i < textureSlotIndex; i++)
+      {
+        textureSlots[i]->Bind(i);
+      }
+      for (uint32_t i = 0; i < arraySlotIndex; i++)
+      {
+        arraySlots[i]->Bind(MaxTextureSlots + i);
+      }
+    }
+    
     void Initialize(uint32_t maxElement)
     {
       IK_PROFILE();
@@ -123,10 +147,14 @@ namespace IKan
     {
       IK_PROFILE();
       maxIndicesPerBatch = 0;
-      for (uint32_t i = 0; i < Texture2DSpecification::MaxTextureSlotsInShader; i++)
+      for (uint32_t i = 0; i < MaxTextureSlots; i++)
       {
         textureSlots[i].reset();
       }
+      for (uint32_t i = 0; i < MaxTextureArraySlots; i++)
+      {
+        arraySlots[i].reset();
+      }
       CommonBatchData::Destroy();
     }
   };
@@ -60,6 +60,8 @@ namespace IKan
         { "a_Color",        ShaderDataType::Float4 },
         { "a_TexCoords",    ShaderDataType::Float2 },
         { "a_TexIndex",     ShaderDataType::Float },
+        { "a_TexLayer",     ShaderDataType::Float },
+        { "a_TexScale",     ShaderDataType::Float2 },
         { "a_TilingFactor", ShaderDataType::Float },
         { "a_ObjectID",     ShaderDataType::Int },
         { "a_LocalPosition",ShaderDataType::Float3 },
@@ -139,6 +141,7 @@ namespace IKan
       
       indexCountInBatch = 0;
       textureSlotIndex = 1;
+      arraySlotIndex = 0;
       vertexBufferPtr = vertexBufferBasePtr;
     }
     
@@ -152,10 +155,7 @@ namespace IKan
         vertexBuffer->SetData(vertexBufferBasePtr, dataSize);
         
         // Bind Textures
-        for (uint32_t i = 0; i < textureSlotIndex; i++)
-        {
-          textureSlots[i]->Bind(i);
-        }
+        BindTextures();
         
         // Render the Data
         shader->Bind();
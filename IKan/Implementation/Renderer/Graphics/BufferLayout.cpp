@@ -24,12 +24,16 @@ namespace IKan
         case ShaderDataType::Float3 : return 4 * 3;
         case ShaderDataType::Float4 : return 4 * 4;
         case ShaderDataType::Mat3   : return 4 * 3 * 3;
-        case ShaderDataType::Mat4   : return 4 * 4 * 5;
+        case ShaderDataType::Mat4   : return 4 * 4 * 4;
         case ShaderDataType::Int    : return 4;
         case ShaderDataType::Int2   : return 4 * 2;
         case ShaderDataType::Int3   : return 4 * 3;
         case ShaderDataType::Int4   : return 4 * 4;
         case ShaderDataType::Bool   : return 1;
+        case ShaderDataType::Half2  : return 2 * 2;
+        case ShaderDataType::Half4  : return 2 * 4;
+        case ShaderDataType::Short2 : return 2 * 2;
+        case ShaderDataType::UByte4 : return 1 * 4;
       }
       IK_ASSERT(false, "Invalid Type");
       return 0;
@@ -53,6 +57,10 @@ namespace IKan
         case ShaderDataType::Int3   : return 3;
         case ShaderDataType::Int4   : return 4;
         case ShaderDataType::Bool   : return 1;
+        case ShaderDataType::Half2  : return 2;
+        case ShaderDataType::Half4  : return 4;
+        case ShaderDataType::Short2 : return 2;
+        case ShaderDataType::UByte4 : return 4;
       }
       IK_ASSERT(false, "Unkown Shader datatype!! ");
     }
@@ -75,6 +83,10 @@ namespace IKan
         case ShaderDataType::Int3:     return "Int3   ";
         case ShaderDataType::Int4:     return "Int4   ";
         case ShaderDataType::Bool:     return "Bool   ";
+        case ShaderDataType::Half2:    return "Half2  ";
+        case ShaderDataType::Half4:    return "Half4  ";
+        case ShaderDataType::Short2:   return "Short2 ";
+        case ShaderDataType::UByte4:   return "UByte4 ";
       }
       
       IK_ASSERT(false, "Unknown ShaderDataType!");
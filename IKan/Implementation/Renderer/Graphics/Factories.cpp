@@ -15,6 +15,13 @@
 #include "Platform/OpenGL/OpenGLShader.hpp"
 #include "Platform/OpenGL/OpenGLPipeline.hpp"
 #include "Platform/OpenGL/OpenGLFrameBuffer.hpp"
+#include "Platform/Null/NullRendererContext.hpp"
+#include "Platform/Null/NullRendererAPI.hpp"
+#include "Platform/Null/NullTexture.hpp"
+#include "Platform/Null/NullRendererBuffer.hpp"
+#include "Platform/Null/NullShader.hpp"
+#include "Platform/Null/NullPipeline.hpp"
+#include "Platform/Null/NullFrameBuffer.hpp"
 
 namespace IKan
 {
@@ -23,6 +30,7 @@ namespace IKan
     switch(Renderer::GetCurrentRendererAPI())
     {
       case RendererType::OpenGL: return CreateScope<OpenGLRendererContext>(windowPtr);
+      case RendererType::Null: return CreateScope<NullRendererContext>(windowPtr);
       case RendererType::Invalid:
       default:
         IK_LOG_CRITICAL(LogModule::Renderer, "Renderer API Type is not set or set as invalid."
@@ -38,6 +46,7 @@ namespace IKan
     switch (Renderer::GetCurrentRendererAPI())
     {
       case RendererType::OpenGL: return CreateScope<OpenGLRendererAPI>();
+      case RendererType::Null: return CreateScope<NullRendererAPI>();
       case RendererType::Invalid:
       default:
         IK_LOG_CRITICAL(LogModule::Renderer, "Renderer API Type is not set or set as invalid."
@@ -53,6 +62,7 @@ namespace IKan
     switch (Renderer::GetCurrentRendererAPI())
     {
       case RendererType::OpenGL: return CreateRef<OpenGLTexture>(spec);
+      case RendererType::Null: return CreateRef<NullTexture>(spec);
       case RendererType::Invalid:
       default:
         IK_LOG_CRITICAL(LogModule::Renderer, "Renderer API Type is not set or set as invalid."
@@ -82,11 +92,12 @@ namespace IKan
     return Create(0xffffffff);
   }
   
-  Ref<Texture> TextureFactory::Create(const CharTextureSpecification& spec)
+  Ref<TextureArray> TextureFactory::Create(const TextureArraySpecification& spec)
   {
     switch (Renderer::GetCurrentRendererAPI())
     {
-      case RendererType::OpenGL: return CreateRef<OpenGLCharTexture>(spec);
+      case RendererType::OpenGL: return CreateRef<OpenGLTextureArray>(spec);
+      case RendererType::Null: return CreateRef<NullTextureArray>(spec);
       case RendererType::Invalid:
       default:
         IK_LOG_CRITICAL(LogModule::Renderer, "Renderer API Type is not set or set as invalid."
@@ -102,6 +113,7 @@ namespace IKan
     switch (Renderer::GetCurrentRendererAPI())
     {
       case RendererType::OpenGL: return CreateRef<OpenGLImage>(spec);
+      case RendererType::Null: return CreateRef<NullImage>(spec);
       case RendererType::Invalid:
       default:
         IK_LOG_CRITICAL(LogModule::Renderer, "Renderer API Type is not set or set as invalid."
@@ -124,6 +136,7 @@ namespace IKan
     switch (Renderer::GetCurrentRendererAPI())
     {
       case RendererType::OpenGL: return CreateRef<OpenGLVertexBuffer>(data, size);
+      case RendererType::Null: return CreateRef<NullVertexBuffer>(data, size);
       case RendererType::Invalid:
       default:
         IK_LOG_CRITICAL(LogModule::Renderer, "Renderer API Type is not set or set as invalid."
@@ -139,6 +152,7 @@ namespace IKan
     switch (Renderer::GetCurrentRendererAPI())
     {
       case RendererType::OpenGL: return CreateRef<OpenGLVertexBuffer>(size);
+      case RendererType::Null: return CreateRef<NullVertexBuffer>(size);
       case RendererType::Invalid:
       default:
         IK_LOG_CRITICAL(LogModule::Renderer, "Renderer API Type is not set or set as invalid."
@@ -154,6 +168,7 @@ namespace IKan
     switch (Renderer::GetCurrentRendererAPI())
     {
       case RendererType::OpenGL: return CreateRef<OpenGLIndexBuffer>(data, size);
+      case RendererType::Null: return CreateRef<NullIndexBuffer>(data, size);
       case RendererType::Invalid:
       default:
         IK_LOG_CRITICAL(LogModule::Renderer, "Renderer API Type is not set or set as invalid."
@@ -169,6 +184,7 @@ namespace IKan
     switch (Renderer::GetCurrentRendererAPI())
     {
       case RendererType::OpenGL: return CreateRef<OpenGLIndexBuffer>(data, count * SizeOfSingleIndices);
+      case RendererType::Null: return CreateRef<NullIndexBuffer>(data, count * SizeOfSingleIndices);
       case RendererType::Invalid:
       default:
         IK_LOG_CRITICAL(LogModule::Renderer, "Renderer API Type is not set or set as invalid."
@@ -183,6 +199,7 @@ namespace IKan
     switch (Renderer::GetCurrentRendererAPI())
     {
       case RendererType::OpenGL: return CreateRef<OpenGLShader>(shaderFilePath);
+      case RendererType::Null: return CreateRef<NullShader>(shaderFilePath);
       case RendererType::Invalid:
       default:
         IK_LOG_CRITICAL(LogModule::Renderer, "Renderer API Type is not set or set as invalid."
@@ -198,6 +215,7 @@ namespace IKan
     switch (Renderer::GetCurrentRendererAPI())
     {
       case RendererType::OpenGL: return CreateRef<OpenGLPipeline>(spec);
+      case RendererType::Null: return CreateRef<NullPipeline>(spec);
       case RendererType::Invalid:
       default:
         IK_LOG_CRITICAL(LogModule::Renderer, "Renderer API Type is not set or set as invalid."
@@ -213,6 +231,7 @@ namespace IKan
     switch (Renderer::GetCurrentRendererAPI())
     {
       case RendererType::OpenGL: return CreateRef<OpenGLFrameBuffer>(spec);
+      case RendererType::Null: return CreateRef<NullFrameBuffer>(spec);
       case RendererType::Invalid:
       default:
         IK_LOG_CRITICAL(LogModule::Renderer, "Renderer API Type is not set or set as invalid."
@@ -116,6 +116,10 @@ void MaterialAsset::Set##title##Map(Ref<Image> tex) { std::string uniform = "u_"
   {
     return m_material;
   }
+  uint64_t MaterialAsset::GetCPUMemorySize() const
+  {
+    return sizeof(MaterialAsset) + (m_material ? sizeof(Material) + m_material->GetUniformStorageSize() : 0);
+  }
   
   // Material Table --------------------------------------------------------------------------------------------------
   
@@ -66,7 +66,7 @@ namespace IKan
     }
   }
   
-  ShaderUniformDeclaration* Material::FindUniformDeclaration(const std::string& name)
+  ShaderUniformDeclaration* Material::FindUniformDeclaration(const std::string& name) const
   {
     IK_PERFORMANCE("ShaderMaterial::FindUniformDeclaration");
     if (m_vsUniformStorageBuffer)
@@ -122,6 +122,30 @@ namespace IKan
     assert(false);
   }
   
+  Buffer& Material::GetUniformBufferTarget(const ShaderUniformDeclaration* uniformDeclaration, UniformStorage& storage) const
+  {
+    IK_PERFORMANCE("ShaderMaterial::GetUniformBufferTarget");
+    switch (uniformDeclaration->GetDomain())
+    {
+      case ShaderDomain::Vertex:    return storage.vsUniformStorageBuffer;
+      case ShaderDomain::Fragment:  return storage.fsUniformStorageBuffer;
+      case ShaderDomain::Geometry:  return storage.gsUniformStorageBuffer;
+      case ShaderDomain::None:
+      default: IK_ASSERT(false, "Invalid uniform declaration domain! Material does not support this shader type.");
+    }
+    assert(false);
+  }
+  
+  Material::UniformStorage Material::CreateUniformStorage() const
+  {
+    IK_PERFORMANCE("ShaderMaterial::CreateUniformStorage");
+    UniformStorage storage;
+    storage.vsUniformStorageBuffer = m_vsUniformStorageBuffer;
+    storage.fsUniformStorageBuffer = m_fsUniformStorageBuffer;
+    storage.gsUniformStorageBuffer = m_gsUniformStorageBuffer;
+    return storage;
+  }
+  
   ShaderResourceDeclaration* Material::FindResourceDeclaration(const std::string& name)
   {
     IK_PERFORMANCE("ShaderMaterial::FindResourceDeclaration");
@@ -159,6 +183,33 @@ namespace IKan
     BindTextures();
   }
   
+  void Material::Bind(const UniformStorage& storage) const
+  {
+    IK_PERFORMANCE("ShaderMaterial::Bind");
+    m_shader->Bind();
+    UploadUniforms(storage);
+    BindTextures();
+  }
+  
+  void Material::UploadUniforms(const UniformStorage& storage) const
+  {
+    IK_PERFORMANCE("ShaderMaterial::UploadUniforms");
+    if (storage.vsUniformStorageBuffer)
+    {
+      m_shader->SetVSMaterialUniformBuffer(storage.vsUniformStorageBuffer);
+    }
+    
+    if (storage.fsUniformStorageBuffer)
+    {
+      m_shader->SetFSMaterialUniformBuffer(storage.fsUniformStorageBuffer);
+    }
+    
+    if (storage.gsUniformStorageBuffer)
+    {
+      m_shader->SetGSMaterialUniformBuffer(storage.gsUniformStorageBuffer);
+    }
+  }
+  
   void Material::Unbind()
   {
     IK_PERFORMANCE("ShaderMaterial::Unbind");
@@ -170,6 +221,10 @@ namespace IKan
   {
     return m_shader;
   }
+  uint64_t Material::GetUniformStorageSize() const
+  {
+    return m_vsUniformStorageBuffer.size + m_fsUniformStorageBuffer.size + m_gsUniformStorageBuffer.size;
+  }
   
   void Material::Set(const std::string& name, const Ref<Image>& image)
   {
@@ -223,7 +278,7 @@ namespace IKan
     return nullptr;
   }
   
-  void Material::BindTextures()
+  void Material::BindTextures() const
   {
     IK_PERFORMANCE("ShaderMaterial::BindImages");
     for (size_t i = 0; i < m_images.size(); i++)
@@ -245,7 +300,45 @@ namespace IKan
     }
   }
   
-  void Material::UnbindTextures()
+  uint32_t Material::BindTextures(std::vector<const Texture*>& boundTextures, uint32_t& skippedBinds) const
+  {
+    IK_PERFORMANCE("ShaderMaterial::BindTextures");
+    uint32_t binds = 0;
+    auto bindAtSlot = [&boundTextures, &binds, &skippedBinds](const Texture* texture, size_t slot) {
+      if (boundTextures.size() <= slot)
+      {
+        boundTextures.resize(slot + 1, nullptr);
+      }
+      
+      if (boundTextures[slot] == texture)
+      {
+        skippedBinds++;
+        return;
+      }
+      texture->Bind((uint32_t)slot);
+      boundTextures[slot] = texture;
+      binds++;
+    };
+    
+    for (size_t i = 0; i < m_images.size(); i++)
+    {
+      if (m_images[i])
+      {
+        bindAtSlot(m_images[i].get(), i);
+      }
+    }
+    
+    for (size_t i = 0; i < m_texture.size(); i++)
+    {
+      if (m_texture[i])
+      {
+        bindAtSlot(m_texture[i].get(), i);
+      }
+    }
+    return binds;
+  }
+  
+  void Material::UnbindTextures() const
   {
     IK_PERFORMANCE("ShaderMaterial::UnbindImages");
     for (size_t i = 0; i < m_images.size(); i++)
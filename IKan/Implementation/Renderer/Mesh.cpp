@@ -12,6 +12,17 @@
 #include <assimp/scene.h>           // Output data structure
 #include <assimp/postprocess.h>     // Post processing flags
 
+#include <glm/gtc/packing.hpp>
+
+#include <fstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "Core/HashGenerator.hpp"
+#include "Project/Project.hpp"
+
 namespace IKan
 {
 #define MESH_INFO(...) IK_LOG_INFO(LogModule::Mesh, __VA_ARGS__);
@@ -32,6 +43,122 @@ namespace IKan
       result[0][3] = matrix.d1; result[1][3] = matrix.d2; result[2][3] = matrix.d3; result[3][3] = matrix.d4;
       return result;
     }
+    
+    /// This function encodes the unit vector with octahedral mapping in two 16 bit snorms. Zero vector is encoded as
+    /// +Z axis
+    /// - Parameter vector: vector to be encoded
+    static uint32_t OctahedralEncode(const glm::vec3& vector)
+    {
+      const float sum = glm::abs(vector.x) + glm::abs(vector.y) + glm::abs(vector.z);
+      if (sum == 0.0f)
+      {
+        return glm::packSnorm2x16(glm::vec2(0.0f));
+      }
+      
+      // Project on octahedron and fold the lower hemisphere over the diagonals
+      glm::vec3 n = vector / sum;
+      glm::vec2 encoded = glm::vec2(n.x, n.y);
+      if (n.z < 0.0f)
+      {
+        const glm::vec2 signs = glm::vec2(n.x >= 0.0f ? 1.0f : -1.0f, n.y >= 0.0f ? 1.0f : -1.0f);
+        encoded = (1.0f - glm::abs(glm::vec2(n.y, n.x))) * signs;
+      }
+      return glm::packSnorm2x16(encoded);
+    }
+    
+    /// This function appends the vertex bytes in packed vertex data
+    /// - Parameters:
+    ///   - packedVertices: packed vertex data
+    ///   - vertex: vertex
+    template<typename VertexT> static void AppendVertex(std::vector<std::byte>& packedVertices, const VertexT& vertex)
+    {
+      const std::byte* bytes = reinterpret_cast<const std::byte*>(&vertex);
+      packedVertices.insert(packedVertices.end(), bytes, bytes + sizeof(VertexT));
+    }
+    
+    /// This class maps the file in memory for reading. File is unmapped on destruction
+    class MappedFile
+    {
+    public:
+      /// This constructor maps the file. Data is null if file can not be mapped
+      /// - Parameter filePath: file path
+      MappedFile(const std::filesystem::path& filePath)
+      {
+        int32_t fileDescriptor = open(filePath.c_str(), O_RDONLY);
+        if (fileDescriptor < 0)
+        {
+          return;
+        }
+        
+        struct stat fileStat;
+        if (0 == fstat(fileDescriptor, &fileStat) and fileStat.st_size > 0)
+        {
+          void* data = mmap(nullptr, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+          if (data != MAP_FAILED)
+          {
+            m_data = static_cast<const std::byte*>(data);
+            m_size = (size_t)fileStat.st_size;
+          }
+        }
+        close(fileDescriptor);
+      }
+      /// This destructor unmaps the file
+      ~MappedFile()
+      {
+        if (m_data)
+        {
+          munmap(const_cast<std::byte*>(m_data), m_size);
+        }
+      }
+      
+      /// This function returns the mapped data
+      const std::byte* Data() const { return m_data; }
+      /// This function returns the size of mapped data
+      size_t Size() const { return m_size; }
+      
+      DELETE_COPY_MOVE_CONSTRUCTORS(MappedFile);
+      
+    private:
+      const std::byte* m_data {nullptr};
+      size_t m_size {0};
+    };
+    
+    /// This function returns the 64 bit FNV-1a hash of file content. Returns 0 if file can not be read
+    /// - Parameter filePath: file path
+    static uint64_t HashFile(const std::filesystem::path& filePath)
+    {
+      IK_PROFILE();
+      MappedFile file(filePath);
+      if (!file.Data())
+      {
+        return 0;
+      }
+      
+      constexpr uint64_t FNV_PRIME = 1099511628211ull;
+      uint64_t hash = 14695981039346656037ull;
+      for (size_t byteIdx = 0; byteIdx < file.Size(); byteIdx++)
+      {
+        hash ^= static_cast<uint64_t>(file.Data()[byteIdx]);
+        hash *= FNV_PRIME;
+      }
+      return hash;
+    }
+    
+    /// This function returns the cooked file path of mesh. Cooked files are stored in project cache directory, or
+    /// next to source file if no project is active
+    /// - Parameter filePath: source file path
+    static std::filesystem::path GetCookedMeshPath(const std::filesystem::path& filePath)
+    {
+      if (!Project::GetActive())
+      {
+        return std::filesystem::path(filePath).concat(CookedMeshExtension);
+      }
+      
+      // Source path hash avoids the clash of meshes with same name in different directories
+      std::stringstream fileName;
+      fileName << filePath.stem().string() << "_" << std::hex << Hash::GenerateFNV(filePath.string()) << CookedMeshExtension;
+      return Project::GetCacheDirectory() / "Meshes" / fileName.str();
+    }
   } // namespace MeshUtils
   
   static const uint32_t s_MeshImportFlags =
@@ -43,17 +170,75 @@ namespace IKan
   aiProcess_OptimizeMeshes |          // Batch draws where possible
   aiProcess_ValidateDataStructure;    // Validation
   
-  Ref<Mesh> Mesh::Create(const std::filesystem::path &filePath)
+  // Cooked Mesh -----------------------------------------------------------------------------------------------------
+  // File layout: | Header | Submesh table | Names | Positions | Indices | Packed vertices |
+  // All sections are 4 byte aligned. Version must be incremented when layout or vertex packing changes
+  static constexpr uint32_t s_cookedMeshMagic = 0x484D4B49; // 'IKMH'
+  static constexpr uint32_t s_cookedMeshVersion = 1;
+  
+  /// This structure stores the header of cooked mesh file
+  struct CookedMeshHeader
+  {
+    uint32_t magic {s_cookedMeshMagic};
+    uint32_t version {s_cookedMeshVersion};
+    uint64_t sourceHash {0};
+    uint32_t importFlags {s_MeshImportFlags};
+    uint32_t vertexFormat {0};
+    uint32_t submeshCount {0};
+    uint32_t nameBytes {0};
+    uint32_t vertexCount {0};
+    uint32_t triangleCount {0};
+    uint32_t packedVertexBytes {0};
+    uint32_t padding {0};
+    glm::vec3 boundsMin {0.0f}, boundsMax {0.0f};
+  };
+  
+  /// This structure stores the submesh in cooked mesh file. Names are stored in names section in submesh order
+  struct CookedSubMesh
+  {
+    uint32_t baseVertex, baseIndex, materialIndex, indexCount, vertexCount;
+    uint32_t nodeNameSize, meshNameSize;
+    glm::vec3 boundsMin, boundsMax;
+    glm::mat4 transform;
+  };
+  
+  Ref<Mesh> Mesh::Create(const std::filesystem::path &filePath, MeshVertexFormat vertexFormat)
   {
-    return CreateRef<Mesh>(filePath);
+    return CreateRef<Mesh>(filePath, vertexFormat);
   }
   
-  Mesh::Mesh(const std::filesystem::path& filePath)
-  : m_filePath(filePath)
+  Mesh::Mesh(const std::filesystem::path& filePath, MeshVertexFormat vertexFormat)
+  : m_filePath(filePath), m_vertexFormat(vertexFormat)
   {
     IK_PROFILE();
     MESH_INFO("Loading mesh from file {0}", m_filePath.c_str());
     
+    // Load the cooked mesh if source is not changed. Else import via assimp and cook it for next loads
+    const uint64_t sourceHash = MeshUtils::HashFile(m_filePath);
+    const std::filesystem::path cookedPath = MeshUtils::GetCookedMeshPath(m_filePath);
+    if (LoadCookedMesh(cookedPath, sourceHash))
+    {
+      return;
+    }
+    
+    ImportMesh();
+    WriteCookedMesh(cookedPath, sourceHash);
+    
+    // Packed vertices are copied by vertex buffer, so released here
+    LoadGraphicsdata(m_packedVertices.data(), uint32_t(m_packedVertices.size()));
+    m_packedVertices.clear();
+    m_packedVertices.shrink_to_fit();
+  }
+  
+  Mesh::~Mesh()
+  {
+    IK_PROFILE();
+    MESH_WARN("Destroying mesh from file {0}", m_filePath.c_str());
+  }
+  
+  void Mesh::ImportMesh()
+  {
+    IK_PROFILE();
     // read file via ASSIMP
     Assimp::Importer importer;
     m_scene = importer.ReadFile(m_filePath, s_MeshImportFlags);
@@ -63,7 +248,6 @@ namespace IKan
     
     StoreVerticesAndIndices();
     TraverseNodes(m_scene->mRootNode);
-    LoadGraphicsdata();
     
     for (const auto& submesh : m_submeshes)
     {
@@ -78,12 +262,152 @@ namespace IKan
       m_boundingBox.max.y = glm::max(m_boundingBox.max.y, max.y);
       m_boundingBox.max.z = glm::max(m_boundingBox.max.z, max.z);
     }
+    
+    // Scene is owned by importer
+    m_scene = nullptr;
   }
   
-  Mesh::~Mesh()
+  bool Mesh::LoadCookedMesh(const std::filesystem::path& cookedPath, uint64_t sourceHash)
   {
     IK_PROFILE();
-    MESH_WARN("Destroying mesh from file {0}", m_filePath.c_str());
+    MeshUtils::MappedFile file(cookedPath);
+    if (!file.Data() or file.Size() < sizeof(CookedMeshHeader))
+    {
+      return false;
+    }
+    
+    // 1. Validate the header. Cooked file is stale if source file, import flags or vertex format is changed
+    CookedMeshHeader header;
+    memcpy(&header, file.Data(), sizeof(CookedMeshHeader));
+    if (header.magic != s_cookedMeshMagic or header.version != s_cookedMeshVersion or header.sourceHash != sourceHash or
+        header.importFlags != s_MeshImportFlags or header.vertexFormat != static_cast<uint32_t>(m_vertexFormat))
+    {
+      MESH_LOG("  Cooked mesh {0} is stale", cookedPath.filename().string());
+      return false;
+    }
+    
+    const size_t submeshOffset = sizeof(CookedMeshHeader);
+    const size_t nameOffset = submeshOffset + header.submeshCount * sizeof(CookedSubMesh);
+    const size_t positionOffset = nameOffset + header.nameBytes;
+    const size_t indexOffset = positionOffset + header.vertexCount * sizeof(glm::vec3);
+    const size_t vertexOffset = indexOffset + header.triangleCount * sizeof(Index);
+    if (vertexOffset + header.packedVertexBytes != file.Size())
+    {
+      MESH_WARN("  Cooked mesh {0} is corrupted", cookedPath.filename().string());
+      return false;
+    }
+    
+    // 2. Submeshes and their names. Names of each submesh should be inside names section
+    const char* names = reinterpret_cast<const char*>(file.Data() + nameOffset);
+    uint64_t usedNameBytes = 0;
+    m_submeshes.resize(header.submeshCount);
+    for (uint32_t submeshIdx = 0; submeshIdx < header.submeshCount; submeshIdx++)
+    {
+      CookedSubMesh cookedSubmesh;
+      memcpy(&cookedSubmesh, file.Data() + submeshOffset + submeshIdx * sizeof(CookedSubMesh), sizeof(CookedSubMesh));
+      
+      usedNameBytes += static_cast<uint64_t>(cookedSubmesh.nodeNameSize) + cookedSubmesh.meshNameSize;
+      if (usedNameBytes > header.nameBytes or nameOffset + usedNameBytes > file.Size())
+      {
+        MESH_WARN("  Cooked mesh {0} is corrupted. Names are outside the names section", cookedPath.filename().string());
+        m_submeshes.clear();
+        return false;
+      }
+      
+      SubMesh& submesh = m_submeshes[submeshIdx];
+      submesh.baseVertex = cookedSubmesh.baseVertex;
+      submesh.baseIndex = cookedSubmesh.baseIndex;
+      submesh.materialIndex = cookedSubmesh.materialIndex;
+      submesh.indexCount = cookedSubmesh.indexCount;
+      submesh.vertexCount = cookedSubmesh.vertexCount;
+      submesh.boundingBox = AABB(cookedSubmesh.boundsMin, cookedSubmesh.boundsMax);
+      submesh.transform = cookedSubmesh.transform;
+      submesh.nodeName.assign(names, cookedSubmesh.nodeNameSize);
+      names += cookedSubmesh.nodeNameSize;
+      submesh.meshName.assign(names, cookedSubmesh.meshNameSize);
+      names += cookedSubmesh.meshNameSize;
+    }
+    m_boundingBox = AABB(header.boundsMin, header.boundsMax);
+    
+    // 3. Positions and indices are kept on CPU for picking. Packed vertices are uploaded directly from mapped file
+    m_vertices.resize(header.vertexCount);
+    memcpy(m_vertices.data(), file.Data() + positionOffset, header.vertexCount * sizeof(glm::vec3));
+    m_indices.resize(header.triangleCount);
+    memcpy(m_indices.data(), file.Data() + indexOffset, header.triangleCount * sizeof(Index));
+    
+    LoadGraphicsdata(file.Data() + vertexOffset, header.packedVertexBytes);
+    
+    MESH_LOG("  Loaded cooked mesh          | {0}", cookedPath.filename().string());
+    MESH_LOG("  Number of Submesh           | {0}", m_submeshes.size());
+    MESH_LOG("  Number of Vertices          | {0}", m_vertices.size());
+    MESH_LOG("  Number of Indices           | {0}", m_indices.size());
+    return true;
+  }
+  
+  void Mesh::WriteCookedMesh(const std::filesystem::path& cookedPath, uint64_t sourceHash) const
+  {
+    IK_PROFILE();
+    std::error_code error;
+    std::filesystem::create_directories(cookedPath.parent_path(), error);
+    
+    // Write in temporary file and replace the cooked file, so that reader never sees the partial file
+    std::filesystem::path tempPath = std::filesystem::path(cookedPath).concat(".tmp");
+    std::ofstream stream(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!stream)
+    {
+      MESH_WARN("  Can not write cooked mesh {0}", cookedPath.string());
+      return;
+    }
+    
+    CookedMeshHeader header;
+    header.sourceHash = sourceHash;
+    header.vertexFormat = static_cast<uint32_t>(m_vertexFormat);
+    header.submeshCount = static_cast<uint32_t>(m_submeshes.size());
+    header.vertexCount = static_cast<uint32_t>(m_vertices.size());
+    header.triangleCount = static_cast<uint32_t>(m_indices.size());
+    header.packedVertexBytes = static_cast<uint32_t>(m_packedVertices.size());
+    header.boundsMin = m_boundingBox.min;
+    header.boundsMax = m_boundingBox.max;
+    
+    std::string names;
+    std::vector<CookedSubMesh> cookedSubmeshes;
+    cookedSubmeshes.reserve(m_submeshes.size());
+    for (const SubMesh& submesh : m_submeshes)
+    {
+      cookedSubmeshes.push_back({submesh.baseVertex, submesh.baseIndex, submesh.materialIndex, submesh.indexCount,
+        submesh.vertexCount, static_cast<uint32_t>(submesh.nodeName.size()), static_cast<uint32_t>(submesh.meshName.size()),
+        submesh.boundingBox.min, submesh.boundingBox.max, submesh.transform});
+      names += submesh.nodeName;
+      names += submesh.meshName;
+    }
+    
+    // Keep the next sections 4 byte aligned
+    names.resize((names.size() + 3) & ~size_t(3), '\0');
+    header.nameBytes = static_cast<uint32_t>(names.size());
+    
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(CookedMeshHeader));
+    stream.write(reinterpret_cast<const char*>(cookedSubmeshes.data()), (std::streamsize)(cookedSubmeshes.size() * sizeof(CookedSubMesh)));
+    stream.write(names.data(), (std::streamsize)names.size());
+    stream.write(reinterpret_cast<const char*>(m_vertices.data()), (std::streamsize)(m_vertices.size() * sizeof(glm::vec3)));
+    stream.write(reinterpret_cast<const char*>(m_indices.data()), (std::streamsize)(m_indices.size() * sizeof(Index)));
+    stream.write(reinterpret_cast<const char*>(m_packedVertices.data()), (std::streamsize)m_packedVertices.size());
+    stream.close();
+    
+    if (stream.fail())
+    {
+      MESH_WARN("  Can not write cooked mesh {0}", cookedPath.string());
+      std::filesystem::remove(tempPath, error);
+      return;
+    }
+    
+    std::filesystem::rename(tempPath, cookedPath, error);
+    if (error)
+    {
+      MESH_WARN("  Can not replace cooked mesh {0}: {1}", cookedPath.string(), error.message());
+      std::filesystem::remove(tempPath, error);
+      return;
+    }
+    MESH_LOG("  Cooked mesh in file         | {0}", cookedPath.filename().string());
   }
   
   void Mesh::StoreVerticesAndIndices()
@@ -127,56 +451,41 @@ namespace IKan
       
       for (size_t i = 0; i < mesh->mNumVertices; i++)
       {
-        StaticVertex vertex;
-        vertex.position =
-        {
-          mesh->mVertices[i].x,
-          mesh->mVertices[i].y,
-          mesh->mVertices[i].z
-        };
+        const glm::vec3 position = {mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z};
+        m_vertices.push_back(position);
         
-        m_vertices.push_back(vertex.position);
+        aabb.min = glm::min(position, aabb.min);
+        aabb.max = glm::max(position, aabb.max);
         
-        vertex.normal =
-        {
-          mesh->mNormals[i].x,
-          mesh->mNormals[i].y,
-          mesh->mNormals[i].z
-        };
-        
-        aabb.min.x = glm::min(vertex.position.x, aabb.min.x);
-        aabb.min.y = glm::min(vertex.position.y, aabb.min.y);
-        aabb.min.z = glm::min(vertex.position.z, aabb.min.z);
-        aabb.max.x = glm::max(vertex.position.x, aabb.max.x);
-        aabb.max.y = glm::max(vertex.position.y, aabb.max.y);
-        aabb.max.z = glm::max(vertex.position.z, aabb.max.z);
+        const uint32_t normal = MeshUtils::OctahedralEncode({mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z});
         
+        uint32_t tangent = MeshUtils::OctahedralEncode(glm::vec3(0.0f));
+        uint32_t biTangent = tangent;
         if (mesh->HasTangentsAndBitangents())
         {
-          vertex.tangent =
-          {
-            mesh->mTangents[i].x,
-            mesh->mTangents[i].y,
-            mesh->mTangents[i].z
-          };
-          vertex.biTangent =
-          {
-            mesh->mBitangents[i].x,
-            mesh->mBitangents[i].y,
-            mesh->mBitangents[i].z
-          };
+          tangent = MeshUtils::OctahedralEncode({mesh->mTangents[i].x, mesh->mTangents[i].y, mesh->mTangents[i].z});
+          biTangent = MeshUtils::OctahedralEncode({mesh->mBitangents[i].x, mesh->mBitangents[i].y, mesh->mBitangents[i].z});
         }
         
+        uint32_t textureCoords = glm::packHalf2x16(glm::vec2(0.0f));
         if (mesh->HasTextureCoords(0))
         {
-          vertex.textureCoords =
+          textureCoords = glm::packHalf2x16({mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y});
+        }
+        
+        if (m_vertexFormat == MeshVertexFormat::CompactHalfPosition)
+        {
+          const CompactHalfVertex vertex =
           {
-            mesh->mTextureCoords[0][i].x,
-            mesh->mTextureCoords[0][i].y
+            {glm::packHalf1x16(position.x), glm::packHalf1x16(position.y), glm::packHalf1x16(position.z), 0},
+            normal, textureCoords, tangent, biTangent
           };
+          MeshUtils::AppendVertex(m_packedVertices, vertex);
+        }
+        else
+        {
+          MeshUtils::AppendVertex(m_packedVertices, CompactVertex {position, normal, textureCoords, tangent, biTangent});
         }
-        
-        m_staticVertices.push_back(vertex);
       } // for (size_t i = 0; i < mesh->mNumVertices; i++)
       
       // Indices
@@ -191,15 +500,12 @@ namespace IKan
           mesh->mFaces[i].mIndices[2]
         };
         m_indices.push_back(index);
-        
-        m_triangleCache[(uint32_t)m].emplace_back(m_staticVertices[index.V1 + submesh.baseVertex],
-                                                  m_staticVertices[index.V2 + submesh.baseVertex],
-                                                  m_staticVertices[index.V3 + submesh.baseVertex]);
       }
     } // for (size_t m = 0; m < m_scene->mNumMeshes; m++)
     
     MESH_LOG("  Number of Num Meshes        | {0}", m_scene->mNumMeshes);
-    MESH_LOG("  Number of Static Vertices   | {0}", m_staticVertices.size());
+    MESH_LOG("  Number of Vertices          | {0}", m_vertices.size());
+    MESH_LOG("  Packed Vertex Size          | {0} KB", m_packedVertices.size() / 1024);
     MESH_LOG("  Number of Indices           | {0}", m_indices.size());
     MESH_LOG("  Number of Faces             | {0}", numFaces);
   }
@@ -221,12 +527,11 @@ namespace IKan
     }
   }
   
-  void Mesh::LoadGraphicsdata()
+  void Mesh::LoadGraphicsdata(const void* vertexData, uint32_t vertexDataSize)
   {
     IK_PROFILE();
     // Create Vertex Buffer
-    m_vertexBuffer = VertexBufferFactory::Create((void*)(m_staticVertices.data()),
-                                                 uint32_t(m_staticVertices.size() * sizeof(StaticVertex)));
+    m_vertexBuffer = VertexBufferFactory::Create(const_cast<void*>(vertexData), vertexDataSize);
     
     // Create Pipeline specification
     PipelineSpecification pipelineSpec;
@@ -234,11 +539,15 @@ namespace IKan
     
     pipelineSpec.vertexLayout =
     {
-      { "a_Position",  ShaderDataType::Float3 },
-      { "a_Normal",    ShaderDataType::Float3 },
-      { "a_TexCoord",  ShaderDataType::Float2 },
-      { "a_Tangent",   ShaderDataType::Float3 },
-      { "a_Bitangent", ShaderDataType::Float3 },
+      { "a_Position",  m_vertexFormat == MeshVertexFormat::CompactHalfPosition ? ShaderDataType::Half4 : ShaderDataType::Float3 },
+      { "a_Normal",    ShaderDataType::Short2, true },
+      { "a_TexCoord",  ShaderDataType::Half2 },
+      { "a_Tangent",   ShaderDataType::Short2, true },
+      { "a_Bitangent", ShaderDataType::Short2, true },
+    };
+    pipelineSpec.instanceLayout =
+    {
+      { "a_InstanceTransform", ShaderDataType::Mat4 },
     };
     
     // Create the Pipeline instnace
@@ -249,13 +558,24 @@ namespace IKan
   {
     return m_submeshes;
   }
+  const AABB& Mesh::GetBoundingBox() const
+  {
+    return m_boundingBox;
+  }
   const Ref<Pipeline>& Mesh::GetPipeline() const
   {
     return m_pipeline;
   }
-  const std::vector<Triangle>& Mesh::GetTriangleCache(uint32_t submeshIndex) const
+  const MeshBVH& Mesh::GetBVH(uint32_t submeshIndex) const
   {
-    return m_triangleCache.at(submeshIndex);
+    std::scoped_lock<std::mutex> lock(m_bvhMutex);
+    Scope<MeshBVH>& bvh = m_bvhCache[submeshIndex];
+    if (!bvh)
+    {
+      bvh = CreateScope<MeshBVH>(m_vertices, m_indices, m_submeshes.at(submeshIndex));
+      MESH_LOG("Building BVH of submesh {0} of {1} ({2} nodes)", submeshIndex, m_filePath.filename().string(), bvh->GetNodeCount());
+    }
+    return *bvh;
   }
   const std::vector<glm::vec3>& Mesh::GetVertices() const
   {
@@ -265,4 +585,26 @@ namespace IKan
   {
     return m_indices;
   }
+  MeshVertexFormat Mesh::GetVertexFormat() const
+  {
+    return m_vertexFormat;
+  }
+  uint64_t Mesh::GetCPUMemorySize() const
+  {
+    return m_vertices.capacity() * sizeof(glm::vec3) + m_indices.capacity() * sizeof(Index) +
+    m_submeshes.capacity() * sizeof(SubMesh) + m_packedVertices.capacity();
+  }
+  uint64_t Mesh::GetGPUMemorySize() const
+  {
+    uint64_t size = 0;
+    if (m_vertexBuffer)
+    {
+      size += m_vertexBuffer->GetSize();
+    }
+    if (m_indexBuffer)
+    {
+      size += m_indexBuffer->GetSize();
+    }
+    return size;
+  }
 } // namespace IKan
@@ -0,0 +1,291 @@
+//
+//  MeshBVH.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "MeshBVH.hpp"
+
+#include "Renderer/Mesh.hpp"
+
+namespace IKan
+{
+  namespace MeshBVHUtils
+  {
+    /// Number of bins along split axis for surface area heuristic
+    static constexpr uint32_t SAHBins = 12;
+    /// Maximum triangles in leaf
+    static constexpr uint32_t MaxLeafTriangles = 4;
+    
+    /// This function returns the empty AABB that can be grown with points
+    static AABB EmptyAABB()
+    {
+      return AABB(glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX));
+    }
+    /// This function grows the AABB to enclose the point
+    /// - Parameters:
+    ///   - aabb: AABB to be grown
+    ///   - point: point
+    static void Grow(AABB& aabb, const glm::vec3& point)
+    {
+      aabb.min = glm::min(aabb.min, point);
+      aabb.max = glm::max(aabb.max, point);
+    }
+    /// This function returns the half surface area of AABB. Returns 0 for empty AABB
+    /// - Parameter aabb: AABB
+    static float HalfArea(const AABB& aabb)
+    {
+      const glm::vec3 extent = glm::max(aabb.max - aabb.min, glm::vec3(0.0f));
+      return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+    }
+  } // namespace MeshBVHUtils
+  
+  MeshBVH::MeshBVH(const std::vector<glm::vec3>& positions, const std::vector<Index>& indices, const SubMesh& submesh)
+  {
+    IK_PROFILE();
+    const uint32_t triangleCount = submesh.indexCount / 3;
+    if (0 == triangleCount)
+    {
+      return;
+    }
+    
+    // Indices of submesh are relative to its base vertex
+    const uint32_t firstTriangle = submesh.baseIndex / 3;
+    m_triangles.reserve(triangleCount);
+    std::vector<glm::vec3> centroids;
+    centroids.reserve(triangleCount);
+    for (uint32_t triangleIdx = firstTriangle; triangleIdx < firstTriangle + triangleCount; triangleIdx++)
+    {
+      const Index& index = indices.at(triangleIdx);
+      const TrianglePositions& triangle = m_triangles.emplace_back(TrianglePositions {
+        positions.at(submesh.baseVertex + index.V1),
+        positions.at(submesh.baseVertex + index.V2),
+        positions.at(submesh.baseVertex + index.V3)
+      });
+      centroids.push_back((triangle.v0 + triangle.v1 + triangle.v2) / 3.0f);
+    }
+    
+    // Binary tree never has more than 2N - 1 nodes
+    m_nodes.reserve(triangleCount * 2);
+    Node& root = m_nodes.emplace_back();
+    root.leftFirst = 0;
+    root.count = triangleCount;
+    UpdateBounds(0);
+    Subdivide(0, centroids);
+  }
+  
+  void MeshBVH::UpdateBounds(uint32_t nodeIndex)
+  {
+    Node& node = m_nodes[nodeIndex];
+    node.bounds = MeshBVHUtils::EmptyAABB();
+    for (uint32_t triangleIdx = node.leftFirst; triangleIdx < node.leftFirst + node.count; triangleIdx++)
+    {
+      const TrianglePositions& triangle = m_triangles[triangleIdx];
+      MeshBVHUtils::Grow(node.bounds, triangle.v0);
+      MeshBVHUtils::Grow(node.bounds, triangle.v1);
+      MeshBVHUtils::Grow(node.bounds, triangle.v2);
+    }
+  }
+  
+  void MeshBVH::Subdivide(uint32_t nodeIndex, std::vector<glm::vec3>& centroids)
+  {
+    using namespace MeshBVHUtils;
+    
+    // Note: Node reference is not kept as nodes vector is appended
+    const uint32_t first = m_nodes[nodeIndex].leftFirst;
+    const uint32_t count = m_nodes[nodeIndex].count;
+    if (count <= MaxLeafTriangles)
+    {
+      return;
+    }
+    
+    // 1. Bounds of centroids. Split is along the axes of this bounds
+    AABB centroidBounds = EmptyAABB();
+    for (uint32_t triangleIdx = first; triangleIdx < first + count; triangleIdx++)
+    {
+      Grow(centroidBounds, centroids[triangleIdx]);
+    }
+    
+    // 2. Find the cheapest split plane of all axes with binned SAH
+    struct Bin
+    {
+      AABB bounds = EmptyAABB();
+      uint32_t count {0};
+    };
+    
+    float bestCost = FLT_MAX;
+    int32_t bestAxis = -1;
+    float bestSplit = 0.0f;
+    for (int32_t axis = 0; axis < 3; axis++)
+    {
+      const float boundsMin = centroidBounds.min[axis], boundsMax = centroidBounds.max[axis];
+      if (boundsMin == boundsMax)
+      {
+        continue;
+      }
+      
+      std::array<Bin, SAHBins> bins;
+      const float scale = SAHBins / (boundsMax - boundsMin);
+      for (uint32_t triangleIdx = first; triangleIdx < first + count; triangleIdx++)
+      {
+        const uint32_t binIdx = std::min(SAHBins - 1, static_cast<uint32_t>((centroids[triangleIdx][axis] - boundsMin) * scale));
+        const TrianglePositions& triangle = m_triangles[triangleIdx];
+        bins[binIdx].count++;
+        Grow(bins[binIdx].bounds, triangle.v0);
+        Grow(bins[binIdx].bounds, triangle.v1);
+        Grow(bins[binIdx].bounds, triangle.v2);
+      }
+      
+      // Sweep from both sides to get area and count left and right of each plane between bins
+      std::array<float, SAHBins - 1> leftArea, rightArea;
+      std::array<uint32_t, SAHBins - 1> leftCount, rightCount;
+      AABB leftBox = EmptyAABB(), rightBox = EmptyAABB();
+      uint32_t leftSum = 0, rightSum = 0;
+      for (uint32_t planeIdx = 0; planeIdx < SAHBins - 1; planeIdx++)
+      {
+        leftSum += bins[planeIdx].count;
+        leftCount[planeIdx] = leftSum;
+        Grow(leftBox, bins[planeIdx].bounds.min);
+        Grow(leftBox, bins[planeIdx].bounds.max);
+        leftArea[planeIdx] = HalfArea(leftBox);
+        
+        rightSum += bins[SAHBins - 1 - planeIdx].count;
+        rightCount[SAHBins - 2 - planeIdx] = rightSum;
+        Grow(rightBox, bins[SAHBins - 1 - planeIdx].bounds.min);
+        Grow(rightBox, bins[SAHBins - 1 - planeIdx].bounds.max);
+        rightArea[SAHBins - 2 - planeIdx] = HalfArea(rightBox);
+      }
+      
+      const float binWidth = (boundsMax - boundsMin) / SAHBins;
+      for (uint32_t planeIdx = 0; planeIdx < SAHBins - 1; planeIdx++)
+      {
+        const float cost = leftCount[planeIdx] * leftArea[planeIdx] + rightCount[planeIdx] * rightArea[planeIdx];
+        if (leftCount[planeIdx] > 0 and rightCount[planeIdx] > 0 and cost < bestCost)
+        {
+          bestCost = cost;
+          bestAxis = axis;
+          bestSplit = boundsMin + binWidth * (planeIdx + 1);
+        }
+      }
+    }
+    
+    // 3. Keep leaf if split is not cheaper than intersecting all triangles
+    const float leafCost = count * HalfArea(m_nodes[nodeIndex].bounds);
+    if (bestAxis == -1 or bestCost >= leafCost)
+    {
+      return;
+    }
+    
+    // 4. Partition the triangles in place
+    uint32_t i = first, j = first + count - 1;
+    while (i <= j)
+    {
+      if (centroids[i][bestAxis] < bestSplit)
+      {
+        i++;
+      }
+      else
+      {
+        std::swap(m_triangles[i], m_triangles[j]);
+        std::swap(centroids[i], centroids[j]);
+        if (j == 0)
+        {
+          break;
+        }
+        j--;
+      }
+    }
+    
+    const uint32_t leftCount = i - first;
+    if (leftCount == 0 or leftCount == count)
+    {
+      return;
+    }
+    
+    // 5. Create children and subdivide them
+    const uint32_t leftChildIdx = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.push_back({{}, first, leftCount});
+    m_nodes.push_back({{}, i, count - leftCount});
+    m_nodes[nodeIndex].leftFirst = leftChildIdx;
+    m_nodes[nodeIndex].count = 0;
+    
+    UpdateBounds(leftChildIdx);
+    UpdateBounds(leftChildIdx + 1);
+    Subdivide(leftChildIdx, centroids);
+    Subdivide(leftChildIdx + 1, centroids);
+  }
+  
+  bool MeshBVH::Intersect(const Ray& ray, float& t) const
+  {
+    IK_PERFORMANCE("MeshBVH::Intersect");
+    if (m_nodes.empty())
+    {
+      return false;
+    }
+    
+    float nodeDistance;
+    if (!ray.IntersectsAABB(m_nodes[0].bounds, nodeDistance))
+    {
+      return false;
+    }
+    
+    bool hit = false;
+    float nearest = FLT_MAX;
+    
+    // Depth of tree is bounded by log of triangles for SAH splits, but stack is grown if ever needed
+    std::vector<uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+    while (!stack.empty())
+    {
+      const Node& node = m_nodes[stack.back()];
+      stack.pop_back();
+      
+      if (node.count > 0)
+      {
+        for (uint32_t triangleIdx = node.leftFirst; triangleIdx < node.leftFirst + node.count; triangleIdx++)
+        {
+          const TrianglePositions& triangle = m_triangles[triangleIdx];
+          float distance;
+          if (ray.IntersectsTriangle(triangle.v0, triangle.v1, triangle.v2, distance) and distance < nearest)
+          {
+            nearest = distance;
+            hit = true;
+          }
+        }
+        continue;
+      }
+      
+      // Visit near child first. Skip the children farther than nearest hit
+      float leftDistance, rightDistance;
+      const bool hitLeft = ray.IntersectsAABB(m_nodes[node.leftFirst].bounds, leftDistance) and leftDistance < nearest;
+      const bool hitRight = ray.IntersectsAABB(m_nodes[node.leftFirst + 1].bounds, rightDistance) and rightDistance < nearest;
+      if (hitLeft and hitRight)
+      {
+        const bool leftIsNear = leftDistance <= rightDistance;
+        stack.push_back(leftIsNear ? node.leftFirst + 1 : node.leftFirst);
+        stack.push_back(leftIsNear ? node.leftFirst : node.leftFirst + 1);
+      }
+      else if (hitLeft)
+      {
+        stack.push_back(node.leftFirst);
+      }
+      else if (hitRight)
+      {
+        stack.push_back(node.leftFirst + 1);
+      }
+    }
+    
+    if (hit)
+    {
+      t = nearest;
+    }
+    return hit;
+  }
+  
+  uint32_t MeshBVH::GetNodeCount() const
+  {
+    return static_cast<uint32_t>(m_nodes.size());
+  }
+} // namespace IKan
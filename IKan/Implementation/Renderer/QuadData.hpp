@@ -12,16 +12,58 @@
 
 namespace IKan 
 {
-  /// This structure stores the quad data for single batch
+  /// This structure stores the quad data for single batch. Each quad is uploaded as one instance and corners of quad
+  /// are expanded in vertex shader
   struct QuadBatchData : Shape2DData
   {
+    /// This structure stores the per instance data of quad
+    struct Instance
+    {
+      glm::vec3 axisX; // Transformed X axis of quad (first column of transform)
+      glm::vec3 axisY; // Transformed Y axis of quad (second column of transform)
+      glm::vec3 position;
+      uint32_t color {0xffffffff}; // RGBA8
+      uint32_t texture {NoTextureLayer << 16}; // Texture slot in lower 16 bits and layer in upper 16 bits
+      uint32_t textureScale {0xffffffff}; // Size of image relative to size of layer as UNorm16 x and y
+      float tilingFactor {1.0f};
+      int32_t pixelID {-1};
+    };
+    static_assert(sizeof(Instance) == 56, "Invalid quad instance size");
+    
+    // Constants -----------------------------------------------------------------------------------------------------
+    static constexpr uint32_t NoTextureLayer = 0xffff; // Layer of textures bound in texture slots
+    
+    /// Corners of quad expanded for each instance
+    static constexpr glm::vec2 Corners[VertexForSingleElement] =
+    {
+      { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f }
+    };
+    
     // Member Variables ----------------------------------------------------------------------------------------------
-    /// Base pointer of Vertex Data. This is start of Batch data for single draw call
-    Vertex* vertexBufferBasePtr = nullptr;
-    /// Incrememntal Vetrtex Data Pointer to store all the batch data in Buffer
-    Vertex* vertexBufferPtr = nullptr;
+    /// Base pointer of Instance Data. This is start of Batch data for single draw call
+    Instance* instanceBufferBasePtr = nullptr;
+    /// Incrememntal Instance Data Pointer to store all the batch data in Buffer
+    Instance* instanceBufferPtr = nullptr;
+    /// Number of quads in batch
+    uint32_t instanceCountInBatch {0};
+    
+    Ref<VertexBuffer> instanceBuffer;
 
     // Member Functions ----------------------------------------------------------------------------------------------
+    /// This function packs the texture slot and texture array layer of quad
+    /// - Parameter textureIndex: texture index as x and texture layer as y (-1 if texture is in texture slot)
+    static uint32_t PackTexture(const glm::vec2& textureIndex)
+    {
+      const uint32_t textureLayer = textureIndex.y < 0.0f ? NoTextureLayer : (uint32_t)textureIndex.y;
+      return (uint32_t)textureIndex.x | (textureLayer << 16);
+    }
+    /// This function packs the size of image relative to size of texture array layer
+    /// - Parameter textureScale: texture scale
+    static uint32_t PackTextureScale(const glm::vec2& textureScale)
+    {
+      return glm::packUnorm2x16(textureScale);
+    }
+    
     void Initialize(uint32_t quads)
     {
       IK_PROFILE();
@@ -40,22 +82,29 @@ namespace IKan
       // Initialize common shape data
       Shape2DData::Initialize(quads);
       
-      // Allocating the memory for vertex Buffer Pointer
-      vertexBufferBasePtr = new Shape2DData::Vertex[maxVerticesPerBatch];
+      // Allocating the memory for instance Buffer Pointer
+      instanceBufferBasePtr = new Instance[maxElementPerBatch];
       
-      // Create vertes Buffer
-      const uint32_t vertexBufferSize = maxVerticesPerBatch * sizeof(Shape2DData::Vertex);
-      vertexBuffer = VertexBufferFactory::Create(vertexBufferSize);
+      // Create instance buffer before vertex buffer, as pipeline reads the vertex attributes from last bound buffer
+      const uint32_t instanceBufferSize = maxElementPerBatch * sizeof(Instance);
+      instanceBuffer = VertexBufferFactory::Create(instanceBufferSize);
+      vertexBuffer = VertexBufferFactory::Create((void*)Corners, sizeof(Corners));
       
       // Create Pipeline specification
       PipelineSpecification pipelineSpec;
       pipelineSpec.debugName = "Quad Pipeline";
       pipelineSpec.vertexLayout =
       {
+        { "a_Corner",       ShaderDataType::Float2 },
+      };
+      pipelineSpec.instanceLayout =
+      {
+        { "a_AxisX",        ShaderDataType::Float3 },
+        { "a_AxisY",        ShaderDataType::Float3 },
         { "a_Position",     ShaderDataType::Float3 },
-        { "a_Color",        ShaderDataType::Float4 },
-        { "a_TexCoords",    ShaderDataType::Float2 },
-        { "a_TexIndex",     ShaderDataType::Float },
+        { "a_Color",        ShaderDataType::UByte4, true },
+        { "a_Texture",      ShaderDataType::Int },
+        { "a_TextureScale", ShaderDataType::Int },
         { "a_TilingFactor", ShaderDataType::Float },
         { "a_ObjectID",     ShaderDataType::Int },
       };
@@ -65,25 +114,14 @@ namespace IKan
       // Create the Pipeline instnace
       pipeline = PipelineFactory::Create(pipelineSpec);
 
-      // Create Index Buffer
-      uint32_t* indices = new uint32_t[maxIndicesPerBatch];
-      uint32_t offset = 0;
-      for (size_t i = 0; i < maxIndicesPerBatch; i += Shape2DData::IndicesForSingleElement)
-      {
-        indices[i + 0] = offset + 0;
-        indices[i + 1] = offset + 1;
-        indices[i + 2] = offset + 2;
-        
-        indices[i + 3] = offset + 2;
-        indices[i + 4] = offset + 3;
-        indices[i + 5] = offset + 0;
-        
-        offset += 4;
-      }
+      // Create Index Buffer of single quad. Same indices are used for all instances
+      uint32_t indices[IndicesForSingleElement] = { 0, 1, 2, 2, 3, 0 };
+      indexBuffer = IndexBufferFactory::CreateWithCount(indices, IndicesForSingleElement);
       
-      // Create Index Buffer in GPU for storing Indices. Once stores the date in GPU, we do not Need this Buffer
-      indexBuffer = IndexBufferFactory::CreateWithCount(indices, maxIndicesPerBatch);
-      delete[] indices;
+      // Instance buffer is never changed, so it is attached to pipeline once
+      pipeline->Bind();
+      pipeline->SetInstanceBuffer(instanceBuffer, 0);
+      pipeline->Unbind();
       
       // Increase the stat
       RendererStatistics::Get()._2d.maxQuads = maxElementPerBatch;
@@ -91,8 +129,7 @@ namespace IKan
       // Debug Logs
       BATCH_INFO("Initializing Batch Renderer for Quad Data ");
       BATCH_INFO("  Max Quads per Batch            | {0}", maxElementPerBatch);
-      BATCH_INFO("  Vertex Buffer used             | {0} B", vertexBufferSize);
-      BATCH_INFO("  Index Buffer used              | {0} B", maxIndicesPerBatch * sizeof(uint32_t));
+      BATCH_INFO("  Instance Buffer used           | {0} B", instanceBufferSize);
       BATCH_INFO("  Shader Used                    | {0}", pipelineSpec.shader->GetName());
     }
     
@@ -104,8 +141,7 @@ namespace IKan
       {
         BATCH_WARN("Destrying Batch Renderer for Quad Data ");
         BATCH_WARN("  Max Quads per Batch           | {0}", maxElementPerBatch);
-        BATCH_WARN("  Vertex Buffer used            | {0} B", maxVerticesPerBatch * sizeof(Shape2DData::Vertex));
-        BATCH_WARN("  Index Buffer used             | {0} B", maxIndicesPerBatch * sizeof(uint32_t));
+        BATCH_WARN("  Instance Buffer used          | {0} B", maxElementPerBatch * sizeof(Instance));
         BATCH_WARN("  Shader Used                   | {0}", shader->GetName());
         
         // Decrease the stat
@@ -113,8 +149,9 @@ namespace IKan
       }
 
       Shape2DData::Destroy();
-      delete [] vertexBufferBasePtr;
-      vertexBufferBasePtr = nullptr;
+      instanceBuffer.reset();
+      delete [] instanceBufferBasePtr;
+      instanceBufferBasePtr = nullptr;
     }
     
     void StartBatch(const glm::mat4& camViewProjMat)
@@ -132,29 +169,28 @@ namespace IKan
     {
       IK_PERFORMANCE("Quad::ResetBatch");
       
-      indexCountInBatch = 0;
+      instanceCountInBatch = 0;
       textureSlotIndex = 1;
-      vertexBufferPtr = vertexBufferBasePtr;
+      arraySlotIndex = 0;
+      instanceBufferPtr = instanceBufferBasePtr;
     }
     
     void Flush()
     {
       IK_PERFORMANCE("Quad::Flush");
-      if (indexCountInBatch)
+      if (instanceCountInBatch)
       {
-        // Set the vertex buffer data
-        uint32_t dataSize = (uint32_t)((uint8_t*)vertexBufferPtr - (uint8_t*)vertexBufferBasePtr);
-        vertexBuffer->SetData(vertexBufferBasePtr, dataSize);
+        // Set the instance buffer data
+        instanceBuffer->SetData(instanceBufferBasePtr, instanceCountInBatch * sizeof(Instance));
         
         // Bind Textures
-        for (uint32_t i = 0; i < textureSlotIndex; i++)
-        {
-          textureSlots[i]->Bind(i);
-        }
+        BindTextures();
         
         // Render the Data
         shader->Bind();
-        Renderer::DrawIndexed(pipeline, indexCountInBatch);
+        pipeline->Bind();
+        Renderer::DrawIndexedBaseVertexInstanced(IndicesForSingleElement, nullptr, 0, instanceCountInBatch);
+        pipeline->Unbind();
       }
       ResetBatch();
     }
@@ -7,120 +7,212 @@
 
 #include "RenderCommandQueue.hpp"
 
+#include "Renderer/RendererStats.hpp"
+
 namespace IKan
 {
-  RenderCommandQueue::RenderCommandQueue(uint8_t commandBufferSizeMB)
+  namespace RenderCommandQueueUtils
+  {
+    /// This structure stores the header of each command in queue
+    /// - Note: Size of header is same as command alignment so that payload just after header is also aligned
+    struct alignas(RenderCommandQueue::CommandAlignment) CommandHeader
+    {
+      RenderCommandQueue::RenderCommandFn function {nullptr};
+      uint32_t size {0};
+    };
+    static_assert(sizeof(CommandHeader) == RenderCommandQueue::CommandAlignment, "Invalid command header size");
+
+    /// This function aligns the size to the command alignment
+    /// - Parameter size: size to be aligned
+    static constexpr uint64_t AlignSize(uint64_t size)
+    {
+      return (size + RenderCommandQueue::CommandAlignment - 1) & ~(static_cast<uint64_t>(RenderCommandQueue::CommandAlignment) - 1);
+    }
+
+    /// This structure stores the size of secondary queues executed from a command of primary queue (parallel recordings
+    /// and asset uploads). Only the outermost queue writes the frame statistics, so secondary queues are added to it
+    struct NestedExecution
+    {
+      uint32_t depth {0};
+      uint64_t bytes {0};
+      uint32_t commands {0};
+    };
+    static thread_local NestedExecution t_nestedExecution;
+  } // namespace RenderCommandQueueUtils
+
+  RenderCommandQueue::RenderCommandQueue(uint8_t pageSizeMB)
+  : m_pageSize(static_cast<uint64_t>(pageSizeMB) * 1024 * 1024)
   {
     IK_PROFILE();
-    
-    m_commandBufferSize = commandBufferSizeMB * 1024 * 1024;
-    m_commandBuffer = new uint8_t[m_commandBufferSize];
-    m_commandBufferPtr = m_commandBuffer;
-    memset(m_commandBuffer, 0, m_commandBufferSize);
-    
-    IK_LOG_INFO(LogModule::Renderer, "Creating Renderer command queue. (Size {0} MB)", commandBufferSizeMB);
+    IK_ASSERT(m_pageSize > 0, "Invalid page size of command queue");
+
+    // Note: Page is not memset. Commands are always written before they are read
+    m_firstPage = CreatePage(m_pageSize);
+    m_currentPage = m_firstPage;
+
+    IK_LOG_INFO(LogModule::Renderer, "Creating Renderer command queue. (Page Size {0} MB)", pageSizeMB);
   }
-  
+
   RenderCommandQueue::~RenderCommandQueue()
   {
     IK_PROFILE();
-    delete[] m_commandBuffer;
-    IK_LOG_WARN(LogModule::Renderer, "Destroying Renderer command queue");
+    Page* page = m_firstPage;
+    while (page)
+    {
+      Page* next = page->next;
+      delete[] page->buffer;
+      delete page;
+      page = next;
+      RendererStatistics::Get().commandQueue.pages--;
+    }
+    RendererStatistics::Get().commandQueue.reservedBytes -= m_reservedBytes;
+    IK_LOG_WARN(LogModule::Renderer, "Destroying Renderer command queue (Size {0} KB)", m_reservedBytes / 1024);
   }
-  
+
+  RenderCommandQueue::Page* RenderCommandQueue::CreatePage(uint64_t size)
+  {
+    Page* page = new Page();
+    page->buffer = new uint8_t[size];
+    page->size = size;
+
+    m_reservedBytes += size;
+    RendererStatistics::Get().commandQueue.reservedBytes += size;
+    RendererStatistics::Get().commandQueue.pages++;
+    return page;
+  }
+
   void* RenderCommandQueue::Allocate(RenderCommandFn fn, uint32_t size)
   {
     IK_PERFORMANCE("RenderCommandQueue::Allocate");
-    IK_ASSERT(m_commandBuffer, "Command Buffer is not allocated");
-    
-    // Check memory overflow
+    IK_ASSERT(m_currentPage, "Command Buffer is not allocated");
+    using namespace RenderCommandQueueUtils;
+
+    // 1. Size of command in queue. Header and payload are aligned so next command is also aligned
+    //    |<         CommandHeader         >|<            Payload            >|
+    //    |< RenderCommandFn >|<  size  >|..|< Function to be written by Renderer::Submit >|..|
+    const uint64_t commandSize = sizeof(CommandHeader) + AlignSize(size);
+
+    // 2. Move to next page if command can not fit in current page. Create new page if no page is left. Page is created
+    //    with bigger size if command is bigger than page size
+    //    |-- Page 0 (used) --|..| -> |-- Page 1 --------| -> nullptr
+    if (m_currentPage->used + commandSize > m_currentPage->size)
     {
-      [[maybe_unused]] uint64_t memoryUsed = static_cast<uint64_t>(m_commandBufferPtr - m_commandBuffer);
-      [[maybe_unused]] uint64_t memoryFree = m_commandBufferSize - memoryUsed;;
-      
-      // TODO: IKan: Resize?
-      IK_ASSERT(memoryFree > 0, "Memory Overflow for Commands");
+      while (m_currentPage->next and commandSize > m_currentPage->next->size)
+      {
+        m_currentPage = m_currentPage->next;
+      }
+
+      if (m_currentPage->next)
+      {
+        m_currentPage = m_currentPage->next;
+      }
+      else
+      {
+        Page* newPage = CreatePage(std::max(m_pageSize, commandSize));
+        m_currentPage->next = newPage;
+        m_currentPage = newPage;
+        IK_LOG_TRACE(LogModule::Renderer, "Growing Renderer command queue. (Reserved {0} KB)", m_reservedBytes / 1024);
+      }
     }
-    
-    // 1. Stores the Render Command fucntion pointer in the queue. 'This is lambda that calls the Rendere Command
-    //    submited in Renderer::Submit()'
-    //    |--------------------------------------------------------------------------------------| // 10 MB memory
-    //    ^
-    // m_commandBufferPtr
-    //    |< RenderCommandFn >|
-    *(RenderCommandFn*)m_commandBufferPtr = fn;
-    
-    // 2. Update the pointer after size of RenderCommandFn pointer
-    //    |--------------------------------------------------------------------------------------| // 10 MB memory
-    //                        ^
-    //                m_commandBufferPtr // Shifter the pointer after RenderCommandFn pointer
-    //    |< RenderCommandFn >|
-    m_commandBufferPtr += sizeof(RenderCommandFn);
-    
-    // 3. Store the size of Render command function in queue (Submitted in Renderer::Submit())
-    //    |--------------------------------------------------------------------------------------| // 10 MB memory
-    //                        ^
-    //                m_commandBufferPtr
-    //    |< RenderCommandFn >|<  size  >|
-    *(uint32_t*)m_commandBufferPtr = size;
-    
-    // 4. Update the pointer after size of uint32_t which stores the size of Render Command function
-    //    |--------------------------------------------------------------------------------------| // 10 MB memory
-    //                                   ^
-    //                            m_commandBufferPtr // Shifter the pointer after size of uint32 which stores the size
-    //    |< RenderCommandFn >|<  size  >|
-    m_commandBufferPtr += sizeof(uint32_t);
-    
-    // 5. Stores the current memory address where Renderer::Submit() will store the actual render command function
-    //    |--------------------------------------------------------------------------------------| // 10 MB memory
-    //                                   ^
-    //                            m_commandBufferPtr
-    //                                memory
-    //    |< RenderCommandFn >|<  size  >|
-    void* memory = m_commandBufferPtr;
-    
-    // 6. Update the pointer just after the function
-    //    |--------------------------------------------------------------------------------------| // 10 MB memory
-    //                                   ^                                              ^
-    //                                memory                                      m_commandBufferPtr
-    //    |< RenderCommandFn >|<  size  >|< Function to be written by Renderer::Submit >|
-    m_commandBufferPtr += size;
-    
-    // 7. Increment the Command count
+
+    // 3. Store the Render Command fucntion pointer and size of function in header. 'This is lambda that calls the
+    //    Rendere Command submited in Renderer::Submit()'
+    uint8_t* commandPtr = m_currentPage->buffer + m_currentPage->used;
+    CommandHeader* header = reinterpret_cast<CommandHeader*>(commandPtr);
+    header->function = fn;
+    header->size = size;
+
+    // 4. Update the page and queue data
+    m_currentPage->used += commandSize;
+    m_usedBytes += commandSize;
     m_commandCount++;
-    
-    // 8. Return the memory address where actual function to be written by Renderer::Submit()
-    return memory;
+
+    // 5. Return the memory address just after header where actual function to be written by Renderer::Submit()
+    return commandPtr + sizeof(CommandHeader);
   }
-  
+
   void RenderCommandQueue::Execute()
   {
     IK_PERFORMANCE("RenderCommandQueue::Execute");
-    // 1. Store the start address of command queue
-    uint8_t* buffer = m_commandBuffer;
-    for (uint32_t commandIdx = 0; commandIdx < m_commandCount; commandIdx++)
+    using namespace RenderCommandQueueUtils;
+    t_nestedExecution.depth++;
+
+    // 1. Execute all pages in order. Note: Commands submitted while executing are appended to the queue, so 'used'
+    //    size and next page are read again for each command. Pages skipped by a bigger command are empty
+    for (Page* page = m_firstPage; page; page = page->next)
     {
-      // 2. Get the RenderCommandFn pointer
-      RenderCommandFn function = *(RenderCommandFn*)buffer;
-      
-      // 3. Shift the pointer after RenderCommandFn to get size of function
-      buffer += sizeof(RenderCommandFn);
-      
-      // 4. Get the size of function
-      uint32_t size = *(uint32_t*)buffer;
-      
-      // 5. Shift the pointer after size of uint32_t to get actual render function
-      buffer += sizeof(uint32_t);
-      
-      // 6. execute the function
-      function(buffer);
-      
-      // 7. Shift the pointer after Render function
-      buffer += size;
+      uint64_t offset = 0;
+      while (offset < page->used)
+      {
+        // 2. Get the header of command
+        const CommandHeader* header = reinterpret_cast<const CommandHeader*>(page->buffer + offset);
+
+        // 3. Execute the function stored just after header
+        header->function(page->buffer + offset + sizeof(CommandHeader), true /* execute */);
+
+        // 4. Shift the offset after the Render function
+        offset += sizeof(CommandHeader) + AlignSize(header->size);
+      }
+    }
+
+    // Update the statistics of this frame. Secondary queue is accumulated in the queue executing it
+    t_nestedExecution.depth--;
+    if (t_nestedExecution.depth > 0)
+    {
+      t_nestedExecution.bytes += m_usedBytes;
+      t_nestedExecution.commands += m_commandCount;
+    }
+    else
+    {
+      RendererStatistics::CommandQueue& stats = RendererStatistics::Get().commandQueue;
+      stats.frameBytes = m_usedBytes + t_nestedExecution.bytes;
+      stats.frameCommands = m_commandCount + t_nestedExecution.commands;
+      stats.highWaterMark = std::max(stats.highWaterMark, stats.frameBytes);
+      t_nestedExecution.bytes = 0;
+      t_nestedExecution.commands = 0;
+    }
+
+    ResetPages();
+  }
+
+  void RenderCommandQueue::Discard()
+  {
+    IK_PROFILE();
+    using namespace RenderCommandQueueUtils;
+    for (Page* page = m_firstPage; page; page = page->next)
+    {
+      uint64_t offset = 0;
+      while (offset < page->used)
+      {
+        const CommandHeader* header = reinterpret_cast<const CommandHeader*>(page->buffer + offset);
+        header->function(page->buffer + offset + sizeof(CommandHeader), false /* execute */);
+        offset += sizeof(CommandHeader) + AlignSize(header->size);
+      }
     }
-    
-    // Reset the command queue
-    m_commandBufferPtr = m_commandBuffer;
+    ResetPages();
+  }
+
+  void RenderCommandQueue::ResetPages()
+  {
+    for (Page* page = m_firstPage; page; page = page->next)
+    {
+      page->used = 0;
+    }
+    m_currentPage = m_firstPage;
+    m_usedBytes = 0;
     m_commandCount = 0;
   }
+
+  uint64_t RenderCommandQueue::GetUsedBytes() const
+  {
+    return m_usedBytes;
+  }
+  uint64_t RenderCommandQueue::GetReservedBytes() const
+  {
+    return m_reservedBytes;
+  }
+  uint32_t RenderCommandQueue::GetCommandCount() const
+  {
+    return m_commandCount;
+  }
 } // namespace IKan
@@ -0,0 +1,195 @@
+//
+//  RenderThread.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "RenderThread.hpp"
+
+#include "Renderer/Renderer.hpp"
+#include "Renderer/Graphics/RendererContext.hpp"
+
+namespace IKan
+{
+  /// Stores the ID of render thread. Default ID never matches any running thread
+  static std::thread::id s_renderThreadID;
+
+  RenderThread::RenderThread(ThreadingPolicy threadingPolicy)
+  : m_threadingPolicy(threadingPolicy)
+  {
+    IK_PROFILE();
+    IK_LOG_INFO(LogModule::Renderer, "Creating Render Thread. ({0})",
+                m_threadingPolicy == ThreadingPolicy::MultiThreaded ? "Multi Threaded" : "Single Threaded");
+  }
+
+  RenderThread::~RenderThread()
+  {
+    IK_PROFILE();
+    if (m_isRunning)
+    {
+      Terminate();
+    }
+    IK_LOG_WARN(LogModule::Renderer, "Destroying Render Thread");
+  }
+
+  // Fundamentals -----------------------------------------------------------------------------------------------------
+  void RenderThread::Run(RendererContext* context)
+  {
+    IK_PROFILE();
+    m_isRunning = true;
+    if (m_threadingPolicy == ThreadingPolicy::SingleThreaded)
+    {
+      return;
+    }
+
+    // Render thread owns the context from now. Main thread acquires it only while render thread is idle
+    IK_ASSERT(context, "Renderer context is NULL");
+    m_context = context;
+    m_context->ReleaseCurrent();
+
+    m_thread = std::thread(&Renderer::RenderThreadFunc, this);
+    s_renderThreadID = m_thread.get_id();
+    IK_LOG_INFO(LogModule::Renderer, "Render Thread is running");
+  }
+
+  void RenderThread::Terminate()
+  {
+    IK_PROFILE();
+    if (m_threadingPolicy == ThreadingPolicy::SingleThreaded)
+    {
+      m_isRunning = false;
+      return;
+    }
+
+    // Render the last recorded frame before stopping the thread
+    BlockUntilRenderComplete();
+    Pump();
+
+    // Wake up the render thread for the last time, so that it can exit the loop
+    m_isRunning = false;
+    Set(State::Kick);
+
+    if (m_thread.joinable())
+    {
+      m_thread.join();
+    }
+    s_renderThreadID = std::thread::id();
+
+    // Give the context back to main thread
+    AcquireContext();
+    IK_LOG_WARN(LogModule::Renderer, "Render Thread is terminated");
+  }
+
+  // Synchronization --------------------------------------------------------------------------------------------------
+  void RenderThread::Wait(State waitForState)
+  {
+    if (m_threadingPolicy == ThreadingPolicy::SingleThreaded)
+    {
+      return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_conditionVariable.wait(lock, [this, waitForState]() { return m_state == waitForState; });
+  }
+
+  void RenderThread::WaitAndSet(State waitForState, State setToState)
+  {
+    if (m_threadingPolicy == ThreadingPolicy::SingleThreaded)
+    {
+      return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_conditionVariable.wait(lock, [this, waitForState]() { return m_state == waitForState; });
+    m_state = setToState;
+    m_conditionVariable.notify_all();
+  }
+
+  void RenderThread::Set(State setToState)
+  {
+    if (m_threadingPolicy == ThreadingPolicy::SingleThreaded)
+    {
+      return;
+    }
+
+    {
+      std::scoped_lock<std::mutex> lock(m_mutex);
+      m_state = setToState;
+    }
+    m_conditionVariable.notify_all();
+  }
+
+  // Frame Controller -------------------------------------------------------------------------------------------------
+  void RenderThread::NextFrame()
+  {
+    IK_PERFORMANCE("RenderThread::NextFrame");
+    if (m_threadingPolicy == ThreadingPolicy::MultiThreaded)
+    {
+      Renderer::SwapQueues();
+    }
+  }
+
+  void RenderThread::BlockUntilRenderComplete()
+  {
+    IK_PERFORMANCE("RenderThread::BlockUntilRenderComplete");
+    if (m_threadingPolicy == ThreadingPolicy::MultiThreaded)
+    {
+      Wait(State::Idle);
+    }
+  }
+
+  void RenderThread::Kick()
+  {
+    IK_PERFORMANCE("RenderThread::Kick");
+    if (m_threadingPolicy == ThreadingPolicy::MultiThreaded)
+    {
+      Set(State::Kick);
+    }
+    else
+    {
+      Renderer::WaitAndRender();
+    }
+  }
+
+  void RenderThread::Pump()
+  {
+    NextFrame();
+    Kick();
+    BlockUntilRenderComplete();
+  }
+
+  // Render Thread APIs -----------------------------------------------------------------------------------------------
+  void RenderThread::AcquireContext()
+  {
+    if (m_context)
+    {
+      m_context->MakeCurrent();
+    }
+  }
+
+  void RenderThread::ReleaseContext()
+  {
+    if (m_context)
+    {
+      m_context->ReleaseCurrent();
+    }
+  }
+
+  // Getters ----------------------------------------------------------------------------------------------------------
+  bool RenderThread::IsRunning() const
+  {
+    return m_isRunning;
+  }
+
+  ThreadingPolicy RenderThread::GetThreadingPolicy() const
+  {
+    return m_threadingPolicy;
+  }
+
+  // Static APIs ------------------------------------------------------------------------------------------------------
+  bool RenderThread::IsCurrentThreadRenderThread()
+  {
+    return std::this_thread::get_id() == s_renderThreadID;
+  }
+} // namespace IKan
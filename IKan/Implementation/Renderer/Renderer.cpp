@@ -7,6 +7,8 @@
 
 #include "Renderer.hpp"
 
+#include "Renderer/RenderThread.hpp"
+#include "Core/JobSystem.hpp"
 #include "Renderer/Renderer2D.hpp"
 #include "Renderer/Graphics/RendererAPI.hpp"
 #include "Renderer/Graphics/Shader.hpp"
@@ -25,6 +27,7 @@ namespace IKan
       switch (rendererType)
       {
         case RendererType::OpenGL: return "OpenGL";
+        case RendererType::Null: return "Null";
         case RendererType::Invalid:
         default:
           IK_ASSERT(false, "Invalid Renderer Type");
@@ -34,11 +37,20 @@ namespace IKan
   } // namespace RendererUtils
 
   // Renderer Data ---------------------------------------------------------------------------------------------------
+  /// This structure stores the secondary queues used by parallel recording for one frame. Queues are reused in frames
+  struct ParallelRecordingData
+  {
+    std::vector<Scope<RenderCommandQueue>> queues;
+    uint32_t usedQueues {0};
+  };
+
   /// This structure stores the renderer data
   struct RendererData
   {
     RendererType rendererType {RendererType::Invalid};
-    Scope<RenderCommandQueue> commandQueue;
+    Scope<RenderCommandQueue> commandQueues[RENDER_COMMAND_QUEUE_COUNT];
+    ParallelRecordingData parallelRecordings[RENDER_COMMAND_QUEUE_COUNT];
+    uint32_t submissionQueueIndex {0};
     Scope<RendererAPI> rendererAPI;
 
     /// This function destroys the renderer data
@@ -47,13 +59,26 @@ namespace IKan
       rendererType = RendererType::Invalid;
       rendererAPI.reset();
 
-      // Execute all commands before destory
-      commandQueue->Execute();
-      commandQueue.reset();
+      // Execute all commands before destory. Starting from the oldest queue
+      for (uint32_t queueIdx = 1; queueIdx <= RENDER_COMMAND_QUEUE_COUNT; queueIdx++)
+      {
+        Scope<RenderCommandQueue>& commandQueue = commandQueues[(submissionQueueIndex + queueIdx) % RENDER_COMMAND_QUEUE_COUNT];
+        commandQueue->Execute();
+        commandQueue.reset();
+      }
+      for (ParallelRecordingData& parallelRecording : parallelRecordings)
+      {
+        parallelRecording.queues.clear();
+        parallelRecording.usedQueues = 0;
+      }
+      submissionQueueIndex = 0;
     }
   };
   static RendererData s_rendererData;
 
+  /// Stores the secondary queue being recorded by this thread in Renderer::RecordParallel() or Renderer::RecordDeferred()
+  static thread_local RenderCommandQueue* t_recordingQueue {nullptr};
+
   // Renderer Capabilities -------------------------------------------------------------------------------------------
   RendererCapabilities& RendererCapabilities::Get()
   {
@@ -76,8 +101,11 @@ namespace IKan
       IK_ASSERT(false , "Renderer API type is not set")
     }
     
-    // Create Render Command Queue before using any Renderer APIs
-    s_rendererData.commandQueue = CreateScope<RenderCommandQueue>();
+    // Create Render Command Queues before using any Renderer APIs
+    for (Scope<RenderCommandQueue>& commandQueue : s_rendererData.commandQueues)
+    {
+      commandQueue = CreateScope<RenderCommandQueue>();
+    }
     
     // Create Renderer API instance
     s_rendererData.rendererAPI = RendererAPIFactory::Create();
@@ -119,13 +147,124 @@ namespace IKan
   void Renderer::WaitAndRender()
   {
     IK_PERFORMANCE("Renderer::WaitAndRender");
-    IK_ASSERT(s_rendererData.commandQueue, "Render Command Queue is NULL");
-    s_rendererData.commandQueue->Execute();
+    IK_ASSERT(!RenderThread::IsCurrentThreadRenderThread(), "Use WaitAndRender(RenderThread*) on render thread");
+    
+    const Scope<RenderCommandQueue>& commandQueue = s_rendererData.commandQueues[GetRenderQueueSubmissionIndex()];
+    IK_ASSERT(commandQueue, "Render Command Queue is NULL");
+    commandQueue->Execute();
+    s_rendererData.parallelRecordings[GetRenderQueueSubmissionIndex()].usedQueues = 0;
+  }
+  void Renderer::WaitAndRender(RenderThread* renderThread)
+  {
+    IK_ASSERT(renderThread, "Render Thread is NULL");
+    
+    // Wait for main thread to kick the render thread
+    {
+      IK_PERFORMANCE("Renderer::WaitAndRender::WaitForKick");
+      renderThread->WaitAndSet(RenderThread::State::Kick, RenderThread::State::Busy);
+    }
+    
+    // Execute the commands recorded in last frame
+    {
+      IK_PERFORMANCE("Renderer::WaitAndRender::Execute");
+      renderThread->AcquireContext();
+      
+      const Scope<RenderCommandQueue>& commandQueue = s_rendererData.commandQueues[GetRenderQueueIndex()];
+      IK_ASSERT(commandQueue, "Render Command Queue is NULL");
+      commandQueue->Execute();
+      s_rendererData.parallelRecordings[GetRenderQueueIndex()].usedQueues = 0;
+      
+      renderThread->ReleaseContext();
+    }
+    
+    // Fence: Main thread waits for idle state before swapping the queues
+    renderThread->Set(RenderThread::State::Idle);
+  }
+  void Renderer::RenderThreadFunc(RenderThread* renderThread)
+  {
+    IK_LOG_INFO(LogModule::Renderer, "Starting Render Thread loop");
+    while (renderThread->IsRunning())
+    {
+      WaitAndRender(renderThread);
+    }
+    IK_LOG_WARN(LogModule::Renderer, "Ending Render Thread loop");
+  }
+  void Renderer::SwapQueues()
+  {
+    s_rendererData.submissionQueueIndex = (s_rendererData.submissionQueueIndex + 1) % RENDER_COMMAND_QUEUE_COUNT;
+  }
+  uint32_t Renderer::GetRenderQueueIndex()
+  {
+    return (s_rendererData.submissionQueueIndex + RENDER_COMMAND_QUEUE_COUNT - 1) % RENDER_COMMAND_QUEUE_COUNT;
+  }
+  uint32_t Renderer::GetRenderQueueSubmissionIndex()
+  {
+    return s_rendererData.submissionQueueIndex;
+  }
+  void Renderer::RecordParallel(uint32_t chunkCount, const std::function<void(uint32_t)>& recordFunc)
+  {
+    IK_PERFORMANCE("Renderer::RecordParallel");
+    if (0 == chunkCount)
+    {
+      return;
+    }
+    
+    // Record serially in current queue. Render thread executes the commands in place and nested recordings are already
+    // recorded in a secondary queue
+    if (1 == chunkCount or t_recordingQueue or RenderThread::IsCurrentThreadRenderThread())
+    {
+      for (uint32_t chunkIdx = 0; chunkIdx < chunkCount; chunkIdx++)
+      {
+        recordFunc(chunkIdx);
+      }
+      return;
+    }
+    
+    // 1. Reserve the secondary queues of this frame. Queues are created on calling thread
+    const uint32_t submissionIndex = GetRenderQueueSubmissionIndex();
+    ParallelRecordingData& parallelRecording = s_rendererData.parallelRecordings[submissionIndex];
+    const uint32_t firstQueue = parallelRecording.usedQueues;
+    parallelRecording.usedQueues += chunkCount;
+    while (parallelRecording.queues.size() < parallelRecording.usedQueues)
+    {
+      parallelRecording.queues.emplace_back(CreateScope<RenderCommandQueue>());
+    }
+    
+    // 2. Record each chunk in its own queue
+    JobSystem::ParallelFor(chunkCount, [&parallelRecording, &recordFunc, firstQueue](uint32_t chunkIdx) {
+      t_recordingQueue = parallelRecording.queues[firstQueue + chunkIdx].get();
+      recordFunc(chunkIdx);
+      t_recordingQueue = nullptr;
+    });
+    
+    // 3. Merge the chunks in order. Secondary queues are executed at this point of submission queue
+    Renderer::Submit([submissionIndex, firstQueue, chunkCount]() {
+      IK_PERFORMANCE("Renderer::RecordParallel::Execute");
+      ParallelRecordingData& parallelRecording = s_rendererData.parallelRecordings[submissionIndex];
+      for (uint32_t chunkIdx = 0; chunkIdx < chunkCount; chunkIdx++)
+      {
+        parallelRecording.queues[firstQueue + chunkIdx]->Execute();
+      }
+    });
+  }
+  void Renderer::RecordDeferred(RenderCommandQueue& queue, const std::function<void()>& recordFunc)
+  {
+    IK_PERFORMANCE("Renderer::RecordDeferred");
+    RenderCommandQueue* previousQueue = t_recordingQueue;
+    t_recordingQueue = &queue;
+    recordFunc();
+    t_recordingQueue = previousQueue;
   }
   RenderCommandQueue* Renderer::GetRenderCommandQueue()
   {
-    IK_ASSERT(s_rendererData.commandQueue, "Render Command Queue is NULL");
-    return s_rendererData.commandQueue.get();
+    if (t_recordingQueue)
+    {
+      return t_recordingQueue;
+    }
+    
+    const uint32_t queueIndex = RenderThread::IsCurrentThreadRenderThread() ? GetRenderQueueIndex() : GetRenderQueueSubmissionIndex();
+    IK_ASSERT(s_rendererData.commandQueues[queueIndex], "Render Command Queue is NULL");
+    return s_rendererData.commandQueues[queueIndex].get();
   }
   
   // Renderer Controller ---------------------------------------------------------------------------------------------
@@ -183,4 +322,9 @@ namespace IKan
     IK_PERFORMANCE("Renderer::DrawIndexedBaseVertex");
     s_rendererData.rendererAPI->DrawIndexedBaseVertex(indexCount, indicesData, baseVertex);
   }
+  void Renderer::DrawIndexedBaseVertexInstanced(uint32_t indexCount, void* indicesData, uint32_t baseVertex, uint32_t instanceCount)
+  {
+    IK_PERFORMANCE("Renderer::DrawIndexedBaseVertexInstanced");
+    s_rendererData.rendererAPI->DrawIndexedBaseVertexInstanced(indexCount, indicesData, baseVertex, instanceCount);
+  }
 } // namespace IKan
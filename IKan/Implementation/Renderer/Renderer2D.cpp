@@ -11,14 +11,100 @@
 #include "Renderer/CircleData.hpp"
 #include "Renderer/LineData.hpp"
 #include "Renderer/TextData.hpp"
+#include "Renderer/TextLayout.hpp"
+#include "Renderer/TextureArrayCache.hpp"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) and defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 namespace IKan
 {
-  static constexpr glm::vec2 TextureCoords[] =
+  namespace Renderer2DUtils
   {
-    { 0.0f, 1.0f }, { 1.0f, 1.0f }, { 1.0f, 0.0f }, { 0.0f, 0.0f }
-  };
-
+    /// This function copies the axes and position of transforms in quad instances. Each column is copied as 16 byte
+    /// vector, so the store also writes first float of next member. Members are written in order, so only color after
+    /// position is overwritten, which is written by caller after this function
+    /// - Parameters:
+    ///   - instances: quad instances
+    ///   - transforms: transform matrices of quads
+    ///   - count: number of quads
+    static void CopyQuadTransforms(QuadBatchData::Instance* instances, const glm::mat4* transforms, uint32_t count)
+    {
+      static_assert(offsetof(QuadBatchData::Instance, axisY) == 12 and offsetof(QuadBatchData::Instance, position) == 24 and
+                    offsetof(QuadBatchData::Instance, color) == 36, "Invalid quad instance layout");
+      
+      for (uint32_t i = 0; i < count; i++)
+      {
+        const float* transform = glm::value_ptr(transforms[i]);
+        float* instance = glm::value_ptr(instances[i].axisX);
+#if defined(__SSE2__)
+        _mm_storeu_ps(instance + 0, _mm_loadu_ps(transform + 0));
+        _mm_storeu_ps(instance + 3, _mm_loadu_ps(transform + 4));
+        _mm_storeu_ps(instance + 6, _mm_loadu_ps(transform + 12));
+#elif defined(__ARM_NEON) and defined(__aarch64__)
+        vst1q_f32(instance + 0, vld1q_f32(transform + 0));
+        vst1q_f32(instance + 3, vld1q_f32(transform + 4));
+        vst1q_f32(instance + 6, vld1q_f32(transform + 12));
+#else
+        instances[i].axisX = glm::vec3(transforms[i][0]);
+        instances[i].axisY = glm::vec3(transforms[i][1]);
+        instances[i].position = glm::vec3(transforms[i][3]);
+#endif
+      }
+    }
+    
+    /// This function packs the colors as RGBA8 in quad instances
+    /// - Parameters:
+    ///   - instances: quad instances
+    ///   - colors: colors of quads
+    ///   - count: number of quads
+    static void PackQuadColors(QuadBatchData::Instance* instances, const glm::vec4* colors, uint32_t count)
+    {
+      uint32_t i = 0;
+#if defined(__SSE2__)
+      // Four colors are packed together. Channels are narrowed from 32 bits to 8 bits with saturation
+      const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f), scale = _mm_set1_ps(255.0f);
+      for (; i + 4 <= count; i += 4)
+      {
+        __m128i channels[4];
+        for (uint32_t j = 0; j < 4; j++)
+        {
+          const __m128 color = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(glm::value_ptr(colors[i + j])), zero), one);
+          channels[j] = _mm_cvtps_epi32(_mm_mul_ps(color, scale));
+        }
+        
+        alignas(16) uint32_t packedColors[4];
+        _mm_store_si128((__m128i*)packedColors, _mm_packus_epi16(_mm_packs_epi32(channels[0], channels[1]),
+                                                                 _mm_packs_epi32(channels[2], channels[3])));
+        for (uint32_t j = 0; j < 4; j++)
+        {
+          instances[i + j].color = packedColors[j];
+        }
+      }
+#elif defined(__ARM_NEON) and defined(__aarch64__)
+      // Two colors are packed together. Channels are narrowed from 32 bits to 8 bits
+      const float32x4_t zero = vdupq_n_f32(0.0f), one = vdupq_n_f32(1.0f);
+      for (; i + 2 <= count; i += 2)
+      {
+        const float32x4_t color0 = vminq_f32(vmaxq_f32(vld1q_f32(glm::value_ptr(colors[i])), zero), one);
+        const float32x4_t color1 = vminq_f32(vmaxq_f32(vld1q_f32(glm::value_ptr(colors[i + 1])), zero), one);
+        const uint16x8_t channels = vcombine_u16(vmovn_u32(vcvtnq_u32_f32(vmulq_n_f32(color0, 255.0f))),
+                                                 vmovn_u32(vcvtnq_u32_f32(vmulq_n_f32(color1, 255.0f))));
+        const uint32x2_t packedColors = vreinterpret_u32_u8(vmovn_u16(channels));
+        instances[i].color = vget_lane_u32(packedColors, 0);
+        instances[i + 1].color = vget_lane_u32(packedColors, 1);
+      }
+#endif
+      for (; i < count; i++)
+      {
+        instances[i].color = glm::packUnorm4x8(colors[i]);
+      }
+    }
+  } // namespace Renderer2DUtils
+  
   /// This stucture stores the Renderer 2D Data
   struct Renderer2DData
   {
@@ -29,6 +115,8 @@ namespace IKan
     CircleBatchData circleData;
     LineBatchData lineData;
     TextData textData;
+    TextLayoutCache textLayoutCache;
+    TextureArrayCache textureArrayCache;
     FullScreenQuad fullScreenQuad;
 
     void Destroy()
@@ -39,11 +127,97 @@ namespace IKan
       circleData.Destroy();
       lineData.Destroy();
       textData.Destroy();
+      textLayoutCache.Clear();
+      textureArrayCache.Clear();
       fullScreenQuad.Destroy();
     }
   };
   static Renderer2DData s_data;
   
+  /// This function returns the slot of texture in batch and layer of texture if it is stored in texture array. Texture
+  /// is added in first free slot
+  /// - Parameters:
+  ///   - batchData: quad or circle batch data
+  ///   - texture: texture of shape
+  ///   - textureIndex: texture index as x and texture layer as y (-1 if texture is in texture slot)
+  ///   - textureScale: size of image relative to size of texture array layer (1 if texture is in texture slot)
+  /// - Returns: false if all slots are used and texture is not in batch
+  template<typename BatchData>
+  static bool TryGetTextureIndex(BatchData& batchData, const Ref<Texture>& texture, glm::vec2& textureIndex, glm::vec2& textureScale)
+  {
+    textureScale = glm::vec2(1.0f);
+    if (!texture)
+    {
+      textureIndex = {0.0f, -1.0f};
+      return true;
+    }
+    
+    // Images are stored in texture arrays, so all images of same size class and sampler use single slot
+    if (const TextureArrayCache::Layer* layer = s_data.textureArrayCache.Get(texture))
+    {
+      const Ref<TextureArray>& textureArray = s_data.textureArrayCache.arrays[layer->arrayIndex].textureArray;
+      textureScale = layer->scale;
+      for (uint32_t i = 0; i < batchData.arraySlotIndex; i++)
+      {
+        if (batchData.arraySlots[i] == textureArray)
+        {
+          textureIndex = {(float)i, (float)layer->layer};
+          return true;
+        }
+      }
+      
+      if (batchData.arraySlotIndex >= Shape2DData::MaxTextureArraySlots)
+      {
+        return false;
+      }
+      batchData.arraySlots[batchData.arraySlotIndex] = textureArray;
+      textureIndex = {(float)batchData.arraySlotIndex++, (float)layer->layer};
+      return true;
+    }
+    
+    // Find if texture is already loaded in current batch
+    for (uint32_t i = 1; i < batchData.textureSlotIndex; i++)
+    {
+      if (batchData.textureSlots[i].get() == texture.get())
+      {
+        textureIndex = {(float)i, -1.0f};
+        return true;
+      }
+    }
+    
+    if (batchData.textureSlotIndex >= Shape2DData::MaxTextureSlots)
+    {
+      return false;
+    }
+    
+    // Loading the current texture in the first free slot slot
+    batchData.textureSlots[batchData.textureSlotIndex] = texture;
+    textureIndex = {(float)batchData.textureSlotIndex++, -1.0f};
+    return true;
+  }
+  
+  /// This function returns the slot of texture in batch and layer of texture if it is stored in texture array. Batch is
+  /// flushed if all slots are used
+  /// - Parameters:
+  ///   - batchData: quad or circle batch data
+  ///   - texture: texture of shape
+  ///   - textureScale: size of image relative to size of texture array layer (1 if texture is in texture slot)
+  /// - Returns: texture index as x and texture layer as y (-1 if texture is in texture slot)
+  template<typename BatchData>
+  static glm::vec2 GetTextureIndex(BatchData& batchData, const Ref<Texture>& texture, glm::vec2& textureScale)
+  {
+    glm::vec2 textureIndex;
+    if (!TryGetTextureIndex(batchData, texture, textureIndex, textureScale))
+    {
+      // If number of slots increases max then start new batch
+      BATCH_WARN("Starts the new batch as texture slots ({0}) and texture array slots ({1}) are used in the previous batch",
+                 batchData.textureSlotIndex, batchData.arraySlotIndex);
+      batchData.Flush();
+      TryGetTextureIndex(batchData, texture, textureIndex, textureScale);
+    }
+    return textureIndex;
+  }
+  
   void Renderer2D::Initialize()
   {
     IK_PROFILE();
@@ -108,6 +282,8 @@ namespace IKan
     s_data.lineData.StartBatch(s_data.cameraViewProjectionMatrix);
 
     s_data.textData.StartBatch(s_data.cameraViewProjectionMatrix);
+    s_data.textLayoutCache.NextBatch();
+    s_data.textureArrayCache.NextBatch();
   }
   
   void Renderer2D::EndBatch()
@@ -122,66 +298,129 @@ namespace IKan
   void Renderer2D::SubmitQuad(const glm::mat4& transform, const glm::vec4& color, const Ref<Texture>& texture, float tilingFactor, int32_t objectID)
   {
     IK_PERFORMANCE("Renderer2D::SubmitQuad (With Transform)");
-    SubmitQuadImpl(transform, color, texture, tilingFactor, TextureCoords, objectID );
+    SubmitQuadImpl(glm::vec3(transform[0]), glm::vec3(transform[1]), glm::vec3(transform[3]), color, texture, tilingFactor, objectID);
   }
   void Renderer2D::SubmitQuad(const glm::vec3& position, const glm::vec2& scale, const glm::vec3& rotation, const glm::vec4& color, 
                               const Ref<Texture>& texture, float tilingFactor, int32_t objectID)
   {
     IK_PERFORMANCE("Renderer2D::SubmitQuad (With PSR)");
     const glm::mat4& transform = Utils::Math::GetTransformMatrix(position, rotation, glm::vec3(scale, 0.0f));
-    SubmitQuadImpl(transform, color, texture, tilingFactor, TextureCoords, objectID);
-  }
-  void Renderer2D::SubmitFixedViewQuad(const glm::mat4& transform, const Ref<Texture>& texture, const glm::vec4& color,
-                                       float tilingFactor, int32_t objectID)
-  {
-    IK_PERFORMANCE("Renderer2D::DrawTextureQuad (With Transform)");
-    glm::vec3 position, rotation, scale;
-    Utils::Math::DecomposeTransform(transform, position, rotation, scale);
-    SubmitFixedViewQuad(position, scale, texture, color, tilingFactor, objectID);
+    SubmitQuadImpl(glm::vec3(transform[0]), glm::vec3(transform[1]), glm::vec3(transform[3]), color, texture, tilingFactor, objectID);
   }
-  
-  void Renderer2D::SubmitFixedViewQuad(const glm::vec3& position, const glm::vec2& scale, const Ref<Texture>& texture,
-                                       const glm::vec4& color, float tilingFactor, int32_t objectID)
+  void Renderer2D::SubmitQuads(std::span<const glm::mat4> transforms, std::span<const glm::vec4> colors,
+                               std::span<const Ref<Texture>> textures, std::span<const uint16_t> textureIndices,
+                               float tilingFactor, int32_t objectID)
   {
-    IK_PERFORMANCE("Renderer2D::DrawTextureQuad (With PSR)");
-    // If number of indices increase in batch then start new batch
-    if (s_data.quadData.indexCountInBatch >= s_data.quadData.maxIndicesPerBatch)
+    IK_PERFORMANCE("Renderer2D::SubmitQuads");
+    IK_ASSERT(colors.empty() or colors.size() == transforms.size(), "Invalid number of colors!");
+    IK_ASSERT(textureIndices.empty() or textureIndices.size() == transforms.size(), "Invalid number of texture indices!");
+    
+    QuadBatchData& quadData = s_data.quadData;
+    if (transforms.empty() or quadData.maxElementPerBatch == 0)
     {
-      BATCH_WARN("Starts the new batch as number of indices ({0}) increases in the previous batch", s_data.quadData.indexCountInBatch);
-      s_data.quadData.Flush();
+      return;
     }
     
-    float textureIndex = 0.0f;
-    if (texture)
+    static constexpr uint32_t Unresolved = UINT32_MAX;
+    static const Ref<Texture> NoTexture;
+    
+    /// Packed texture slot and scale of texture in current batch
+    struct PackedTexture
     {
-      // Find if texture is already loaded in current batch
-      for (size_t i = 1; i < s_data.quadData.textureSlotIndex; i++)
+      uint32_t texture {Unresolved};
+      uint32_t scale {0};
+    };
+    
+    // Packed texture of each texture in current batch. Texture is added in batch when first quad uses it
+    std::vector<PackedTexture> packedTextures(std::max<size_t>(textures.size(), 1));
+    
+    for (size_t quadIdx = 0; quadIdx < transforms.size(); )
+    {
+      if (quadData.instanceCountInBatch >= quadData.maxElementPerBatch)
       {
-        if (s_data.quadData.textureSlots[i].get() == texture.get())
+        quadData.Flush();
+        std::fill(packedTextures.begin(), packedTextures.end(), PackedTexture());
+      }
+      
+      QuadBatchData::Instance* instances = quadData.instanceBufferPtr;
+      uint32_t chunkSize = static_cast<uint32_t>(std::min<size_t>(transforms.size() - quadIdx,
+                                                                  quadData.maxElementPerBatch - quadData.instanceCountInBatch));
+      
+      // Textures are added in batch before quads are written. Chunk ends at quad whose texture needs new batch
+      bool isSlotsFull = false;
+      for (uint32_t i = 0; i < chunkSize; i++)
+      {
+        const uint16_t textureIdx = textureIndices.empty() ? 0 : textureIndices[quadIdx + i];
+        IK_ASSERT(textureIdx < packedTextures.size(), "Invalid texture index!");
+        
+        PackedTexture& packedTexture = packedTextures[textureIdx];
+        if (packedTexture.texture == Unresolved)
         {
-          // Found the current textue in the batch
-          textureIndex = (float)i;
-          break;
+          glm::vec2 textureIndex, textureScale;
+          if (!TryGetTextureIndex(quadData, textures.empty() ? NoTexture : textures[textureIdx], textureIndex, textureScale))
+          {
+            chunkSize = i;
+            isSlotsFull = true;
+            break;
+          }
+          packedTexture.texture = QuadBatchData::PackTexture(textureIndex);
+          packedTexture.scale = QuadBatchData::PackTextureScale(textureScale);
         }
+        
+        instances[i].texture      = packedTexture.texture;
+        instances[i].textureScale = packedTexture.scale;
+        instances[i].tilingFactor = tilingFactor;
+        instances[i].pixelID      = objectID;
       }
       
-      // If current texture slot is not pre loaded then load the texture in proper slot
-      if (textureIndex == 0.0f)
+      // Colors are packed after transforms, as transform copy writes over color
+      Renderer2DUtils::CopyQuadTransforms(instances, &transforms[quadIdx], chunkSize);
+      if (colors.empty())
       {
-        // If number of slots increases max then start new batch
-        if (s_data.quadData.textureSlotIndex >= Texture2DSpecification::MaxTextureSlotsInShader)
+        for (uint32_t i = 0; i < chunkSize; i++)
         {
-          BATCH_WARN("Starts the new batch as number of texture slot ({0}) increases in the previous batch", s_data.quadData.textureSlotIndex);
-          s_data.quadData.Flush();
+          instances[i].color = 0xffffffff;
         }
-        
-        // Loading the current texture in the first free slot slot
-        textureIndex = (float)s_data.quadData.textureSlotIndex;
-        s_data.quadData.textureSlots[s_data.quadData.textureSlotIndex] = texture;
-        s_data.quadData.textureSlotIndex++;
+      }
+      else
+      {
+        Renderer2DUtils::PackQuadColors(instances, &colors[quadIdx], chunkSize);
+      }
+      
+      quadData.instanceBufferPtr += chunkSize;
+      quadData.instanceCountInBatch += chunkSize;
+      quadIdx += chunkSize;
+      
+      if (isSlotsFull)
+      {
+        BATCH_WARN("Starts the new batch as texture slots ({0}) and texture array slots ({1}) are used in the previous batch",
+                   quadData.textureSlotIndex, quadData.arraySlotIndex);
+        quadData.Flush();
+        std::fill(packedTextures.begin(), packedTextures.end(), PackedTexture());
       }
     }
     
+    // Update Stats
+    RendererStatistics& stats = RendererStatistics::Get();
+    stats.indexCount += Shape2DData::IndicesForSingleElement * static_cast<uint32_t>(transforms.size());
+    stats.vertexCount += Shape2DData::VertexForSingleElement * static_cast<uint32_t>(transforms.size());
+    stats._2d.quads += static_cast<uint32_t>(transforms.size());
+  }
+  
+  void Renderer2D::SubmitFixedViewQuad(const glm::mat4& transform, const Ref<Texture>& texture, const glm::vec4& color,
+                                       float tilingFactor, int32_t objectID)
+  {
+    IK_PERFORMANCE("Renderer2D::DrawTextureQuad (With Transform)");
+    glm::vec3 position, rotation, scale;
+    Utils::Math::DecomposeTransform(transform, position, rotation, scale);
+    SubmitFixedViewQuad(position, scale, texture, color, tilingFactor, objectID);
+  }
+  
+  void Renderer2D::SubmitFixedViewQuad(const glm::vec3& position, const glm::vec2& scale, const Ref<Texture>& texture,
+                                       const glm::vec4& color, float tilingFactor, int32_t objectID)
+  {
+    IK_PERFORMANCE("Renderer2D::DrawTextureQuad (With PSR)");
+    
     // get the fixed view from camera view matrix
     glm::vec3 camRightWS =
     {
@@ -197,26 +436,7 @@ namespace IKan
       s_data.cameraViewMatrix[2][1]
     };
     
-    for (size_t i = 0; i < Shape2DData::VertexForSingleElement; i++)
-    {
-      s_data.quadData.vertexBufferPtr->position     = position + camRightWS *
-      s_data.quadData.vertexBasePosition[i].x * scale.x + camUpWS *
-      s_data.quadData.vertexBasePosition[i].y * -scale.y;
-      
-      s_data.quadData.vertexBufferPtr->color            = color;
-      s_data.quadData.vertexBufferPtr->textureCoords    = TextureCoords[i];
-      s_data.quadData.vertexBufferPtr->textureIndex     = textureIndex;
-      s_data.quadData.vertexBufferPtr->tilingFactor     = tilingFactor;
-      s_data.quadData.vertexBufferPtr->pixelID          = objectID;
-      s_data.quadData.vertexBufferPtr++;
-    }
-    
-    s_data.quadData.indexCountInBatch += Shape2DData::IndicesForSingleElement;
-    
-    // Update Stats
-    RendererStatistics::Get().indexCount += Shape2DData::IndicesForSingleElement;
-    RendererStatistics::Get().vertexCount += Shape2DData::VertexForSingleElement;
-    RendererStatistics::Get()._2d.quads++;
+    SubmitQuadImpl(camRightWS * scale.x, camUpWS * -scale.y, position, color, texture, tilingFactor, objectID);
   }
   void Renderer2D::DrawFullscreenQuad(const Ref<Texture>& texture, uint32_t slot, bool overrideShader)
   {
@@ -244,61 +464,33 @@ namespace IKan
     }
   }
   
-  void Renderer2D::SubmitQuadImpl(const glm::mat4& transform, const glm::vec4& color, const Ref<Texture>& texture,
-                                  float tilingFactor, const glm::vec2* textureCoords, int32_t objectID)
+  void Renderer2D::SubmitQuadImpl(const glm::vec3& axisX, const glm::vec3& axisY, const glm::vec3& position, const glm::vec4& color,
+                                  const Ref<Texture>& texture, float tilingFactor, int32_t objectID)
   {
     IK_PERFORMANCE("Renderer2D::SubmitQuadImpl");
     
-    // If number of indices increase in batch then start new batch
-    if (s_data.quadData.indexCountInBatch >= s_data.quadData.maxIndicesPerBatch)
+    // If number of instances increase in batch then start new batch
+    if (s_data.quadData.instanceCountInBatch >= s_data.quadData.maxElementPerBatch)
     {
-      BATCH_WARN("Starts the new batch as number of indices ({0}) increases in the previous batch", s_data.quadData.indexCountInBatch);
+      BATCH_WARN("Starts the new batch as number of quads ({0}) increases in the previous batch", s_data.quadData.instanceCountInBatch);
       s_data.quadData.Flush();
     }
     
-    float textureIndex = 0.0f;
-    if (texture)
-    {
-      // Find if texture is already loaded in current batch
-      for (size_t i = 1; i < s_data.quadData.textureSlotIndex; i++)
-      {
-        if (s_data.quadData.textureSlots[i].get() == texture.get())
-        {
-          // Found the current textue in the batch
-          textureIndex = (float)i;
-          break;
-        }
-      }
-      
-      // If current texture slot is not pre loaded then load the texture in proper slot
-      if (textureIndex == 0.0f)
-      {
-        // If number of slots increases max then start new batch
-        if (s_data.quadData.textureSlotIndex >= Texture2DSpecification::MaxTextureSlotsInShader)
-        {
-          BATCH_WARN("Starts the new batch as number of texture slot ({0}) increases in the previous batch", s_data.quadData.textureSlotIndex);
-          s_data.quadData.Flush();
-        }
-        
-        // Loading the current texture in the first free slot slot
-        textureIndex = (float)s_data.quadData.textureSlotIndex;
-        s_data.quadData.textureSlots[s_data.quadData.textureSlotIndex] = texture;
-        s_data.quadData.textureSlotIndex++;
-      }
-    }
+    glm::vec2 textureScale;
+    const glm::vec2 textureIndex = GetTextureIndex(s_data.quadData, texture, textureScale);
     
-    for (size_t i = 0; i < Shape2DData::VertexForSingleElement; i++)
-    {
-      s_data.quadData.vertexBufferPtr->position        = transform * s_data.quadData.vertexBasePosition[i];
-      s_data.quadData.vertexBufferPtr->color           = color;
-      s_data.quadData.vertexBufferPtr->textureCoords   = textureCoords[i];
-      s_data.quadData.vertexBufferPtr->textureIndex    = textureIndex;
-      s_data.quadData.vertexBufferPtr->tilingFactor    = tilingFactor;
-      s_data.quadData.vertexBufferPtr->pixelID         = objectID;
-      s_data.quadData.vertexBufferPtr++;
-    }
+    // Corners are expanded in vertex shader, so only quad axes are stored
+    QuadBatchData::Instance& instance = *s_data.quadData.instanceBufferPtr++;
+    instance.axisX        = axisX;
+    instance.axisY        = axisY;
+    instance.position     = position;
+    instance.color        = glm::packUnorm4x8(color);
+    instance.texture      = QuadBatchData::PackTexture(textureIndex);
+    instance.textureScale = QuadBatchData::PackTextureScale(textureScale);
+    instance.tilingFactor = tilingFactor;
+    instance.pixelID      = objectID;
     
-    s_data.quadData.indexCountInBatch += Shape2DData::IndicesForSingleElement;
+    s_data.quadData.instanceCountInBatch++;
     
     // Update Stats
     RendererStatistics::Get().indexCount += Shape2DData::IndicesForSingleElement;
@@ -341,44 +533,17 @@ namespace IKan
       s_data.circleData.Flush();
     }
     
-    float textureIndex = 0.0f;
-    if (texture)
-    {
-      // Find if texture is already loaded in current batch
-      for (size_t i = 1; i < s_data.circleData.textureSlotIndex; i++)
-      {
-        if (s_data.circleData.textureSlots[i].get() == texture.get())
-        {
-          // Found the current textue in the batch
-          textureIndex = (float)i;
-          break;
-        }
-      }
-      
-      // If current texture slot is not pre loaded then load the texture in proper slot
-      if (textureIndex == 0.0f)
-      {
-        // If number of slots increases max then start new batch
-        if (s_data.circleData.textureSlotIndex >= Texture2DSpecification::MaxTextureSlotsInShader)
-        {
-          BATCH_INFO("Starts the new batch as number of texture slot ({0}) increases in the previous batch", s_data.circleData.textureSlotIndex);
-          EndBatch();
-          s_data.circleData.ResetBatch();
-        }
-        
-        // Loading the current texture in the first free slot slot
-        textureIndex = (float)s_data.circleData.textureSlotIndex;
-        s_data.circleData.textureSlots[s_data.circleData.textureSlotIndex] = texture;
-        s_data.circleData.textureSlotIndex++;
-      }
-    }
+    glm::vec2 textureScale;
+    const glm::vec2 textureIndex = GetTextureIndex(s_data.circleData, texture, textureScale);
     
     for (size_t i = 0; i < Shape2DData::VertexForSingleElement; i++)
     {
       s_data.circleData.vertexBufferPtr->position        = transform * s_data.circleData.vertexBasePosition[i];
       s_data.circleData.vertexBufferPtr->color           = tintColor;
       s_data.circleData.vertexBufferPtr->textureCoords   = 2.0f * s_data.circleData.vertexBasePosition[i];
-      s_data.circleData.vertexBufferPtr->textureIndex    = textureIndex;
+      s_data.circleData.vertexBufferPtr->textureIndex    = textureIndex.x;
+      s_data.circleData.vertexBufferPtr->textureLayer    = textureIndex.y;
+      s_data.circleData.vertexBufferPtr->textureScale    = textureScale;
       s_data.circleData.vertexBufferPtr->tilingFactor    = tilingFactor;
       s_data.circleData.vertexBufferPtr->localPosition   = 2.0f * s_data.circleData.vertexBasePosition[i];
       s_data.circleData.vertexBufferPtr->thickness       = thickness;
@@ -488,65 +653,58 @@ namespace IKan
       IK_LOG_WARN(LogModule::Renderer2D, "Font is null using default font");
     }
     
-    float originalPosX = position.x;
-    float slot = 0.0f;
-    for (std::string::const_iterator c = text.begin(); c != text.end(); c++)
+    TextData& textData = s_data.textData;
+    TextLayout& layout = s_data.textLayoutCache.Get(text, font, scale);
+    layout.Resolve(position, color, objectID);
+    
+    for (TextLayout::Run& run : layout.runs)
     {
-      if (s_data.textData.numSlotsUsed >= Texture2DSpecification::MaxTextureSlotsInShader)
-      {
-        s_data.textData.Flush();
-      }
-      
-      Ref<CharTexture> ch = font->GetCharTexture(*c);
-      
-      if (*c == '\n')
-      {
-        position.y -= scale.y * 40;
-        position.x = originalPosX;
-        continue;
-      }
-      
-      float xpos = position.x + ch->GetBearing().x * scale.x;
-      float ypos = position.y - (ch->GetSize().y - ch->GetBearing().y) * scale.y;
-      float zpos = position.z;
-      
-      float w = ch->GetSize().x * scale.x;
-      float h = ch->GetSize().y * scale.y;
-      
-      // update VBO for each character
-      glm::vec3 vertexPosition[TextData::VertexForSingleChar] =
+      uint32_t firstVertex = run.firstVertex;
+      uint32_t remainingVertices = run.vertexCount;
+      while (remainingVertices > 0)
       {
-        { xpos,     ypos + h, zpos },
-        { xpos,     ypos    , zpos },
-        { xpos + w, ypos    , zpos },
+        // Find if atlas page is already used in current batch
+        uint32_t slot = 0;
+        while (slot < textData.numSlotsUsed and textData.atlasPages[slot].get() != run.page.get())
+        {
+          slot++;
+        }
         
-        { xpos,     ypos + h, zpos },
-        { xpos + w, ypos    , zpos },
-        { xpos + w, ypos + h, zpos },
-      };
-      
-      // Each Vertex of Char
-      slot = (float)s_data.textData.numSlotsUsed;
-      for (size_t i = 0; i < TextData::VertexForSingleChar; i++)
-      {
-        s_data.textData.vertexBufferPtr->position      = vertexPosition[i];
-        s_data.textData.vertexBufferPtr->color         = color;
-        s_data.textData.vertexBufferPtr->textureIndex  = slot;
-        s_data.textData.vertexBufferPtr->textureCoord  = s_data.textData.baseTextureCoords[i];
-        s_data.textData.vertexBufferPtr->objectID      = objectID;
-        s_data.textData.vertexBufferPtr++;
+        // If number of slots or vertices increases max then start new batch
+        if ((slot == textData.numSlotsUsed and slot >= Texture2DSpecification::MaxTextureSlotsInShader) or
+            textData.vertexCount == TextData::MaxVerticesPerBatch)
+        {
+          textData.Flush();
+          slot = 0;
+        }
+        if (slot == textData.numSlotsUsed)
+        {
+          textData.atlasPages[textData.numSlotsUsed++] = run.page;
+        }
+        
+        // Run is split if it does not fit in current batch. Parts of split run can use different slots
+        const uint32_t vertexCount = std::min(remainingVertices, TextData::MaxVerticesPerBatch - textData.vertexCount);
+        TextData::Vertex* runVertices = layout.vertices.data() + firstVertex;
+        if (run.slot != slot or vertexCount != run.vertexCount)
+        {
+          run.slot = vertexCount == run.vertexCount ? slot : UINT32_MAX;
+          for (uint32_t i = 0; i < vertexCount; i++)
+          {
+            runVertices[i].textureIndex = (float)slot;
+          }
+        }
+        
+        std::memcpy(textData.vertexBufferPtr, runVertices, vertexCount * sizeof(TextData::Vertex));
+        textData.vertexBufferPtr += vertexCount;
+        textData.vertexCount += vertexCount;
+        
+        firstVertex += vertexCount;
+        remainingVertices -= vertexCount;
       }
-      
-      // now advance cursors for next glyph (note that advance is number of
-      // 1/64 pixels) bitshift by 6 to get value in pixels (2^6 = 64 (divide
-      // amount of 1/64th pixels by 64 to get amount of pixels))
-      position.x += (ch->GetAdvance() >> 6) * scale.x;
-      
-      // Renderer Vertex count stat
-      RendererStatistics::Get().vertexCount += TextData::VertexForSingleChar;
-      
-      s_data.textData.charTextures[s_data.textData.numSlotsUsed] = ch;
-      s_data.textData.numSlotsUsed++;
     }
+    
+    // Renderer stats
+    RendererStatistics::Get().vertexCount += layout.charCount * TextData::VertexForSingleChar;
+    RendererStatistics::Get()._2d.chars += layout.charCount;
   }
 } // namespace IKan
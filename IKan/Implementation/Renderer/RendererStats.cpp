@@ -20,6 +20,20 @@ namespace IKan
     _2d.circles = 0;
     _2d.lines = 0;
     _2d.chars = 0;
+    _2d.textLayoutHits = 0;
+    _2d.textLayoutMisses = 0;
+    
+    stateChanges.shaderBinds = 0;
+    stateChanges.materialBinds = 0;
+    stateChanges.pipelineBinds = 0;
+    stateChanges.textureBinds = 0;
+    stateChanges.skippedShaderBinds = 0;
+    stateChanges.skippedMaterialBinds = 0;
+    stateChanges.skippedPipelineBinds = 0;
+    stateChanges.skippedTextureBinds = 0;
+    
+    culling.visibleSubmeshes = 0;
+    culling.culledSubmeshes = 0;
   }
   
   void RendererStatistics::ResetAll()
@@ -34,6 +48,9 @@ namespace IKan
     _2d.maxQuads = 0;
     _2d.maxCircles = 0;
     _2d.maxLines = 0;
+    _2d.maxChars = 0;
+    
+    commandQueue.highWaterMark = 0;
   }
   
   RendererStatistics& RendererStatistics::Get()
@@ -7,6 +7,7 @@
 
 #include "SceneRenderer.hpp"
 #include "Assets/AssetManager.hpp"
+#include "Renderer/RendererStats.hpp"
 
 namespace IKan
 {
@@ -23,8 +24,79 @@ namespace IKan
     inline static uint32_t s_numRenderers {0};
     inline static SceneRendererCamera s_sceneCamera;
     inline static Ref<Material> s_defaultMaterial;
+    
+    // Parallel recording of draw list --------------------------
+    /// Minimum instanced batches to record the commands in parallel
+    static constexpr uint32_t ParallelRecordingThreshold = 256;
+    /// Number of instanced batches recorded by each parallel chunk
+    static constexpr uint32_t BatchesPerRecordingChunk = 128;
   };
   
+  namespace SceneRendererUtils
+  {
+    // Bits of each field in draw sort key
+    static constexpr uint32_t ShaderKeyBits = 12, MaterialKeyBits = 16, MeshKeyBits = 16, DepthKeyBits = 20;
+    
+    /// This function packs the draw sort key. Indices are wrapped to their bits, wrapped indices only reduce the
+    /// batching as binds are tracked with actual resources
+    /// - Parameters:
+    ///   - shaderIndex: per frame shader index
+    ///   - materialIndex: per frame material index
+    ///   - meshIndex: per frame mesh index
+    ///   - depth: normalized depth from camera in [0, 1]
+    static uint64_t PackSortKey(uint32_t shaderIndex, uint32_t materialIndex, uint32_t meshIndex, float depth)
+    {
+      const uint64_t depthKey = static_cast<uint64_t>(std::clamp(depth, 0.0f, 1.0f) * ((1 << DepthKeyBits) - 1));
+      uint64_t key = shaderIndex & ((1 << ShaderKeyBits) - 1);
+      key = (key << MaterialKeyBits) | (materialIndex & ((1 << MaterialKeyBits) - 1));
+      key = (key << MeshKeyBits) | (meshIndex & ((1 << MeshKeyBits) - 1));
+      key = (key << DepthKeyBits) | depthKey;
+      return key;
+    }
+    
+    /// This function sorts the entries by key with LSD radix sort of 8 bit digits. Digits same for all keys are skipped
+    /// - Parameters:
+    ///   - entries: entries to be sorted
+    ///   - scratch: scratch buffer for sorting. Reused to avoid allocation each frame
+    template<typename Entry> static void RadixSort(std::vector<Entry>& entries, std::vector<Entry>& scratch)
+    {
+      IK_PERFORMANCE("SceneRendererUtils::RadixSort");
+      if (entries.size() < 2)
+      {
+        return;
+      }
+      
+      scratch.resize(entries.size());
+      for (uint32_t shift = 0; shift < 64; shift += 8)
+      {
+        std::array<uint32_t, 256> offsets {};
+        for (const Entry& entry : entries)
+        {
+          offsets[(entry.key >> shift) & 0xFF]++;
+        }
+        
+        if (offsets[(entries[0].key >> shift) & 0xFF] == entries.size())
+        {
+          continue;
+        }
+        
+        uint32_t offset = 0;
+        for (uint32_t& digitOffset : offsets)
+        {
+          uint32_t count = digitOffset;
+          digitOffset = offset;
+          offset += count;
+        }
+        
+        for (const Entry& entry : entries)
+        {
+          scratch[offsets[(entry.key >> shift) & 0xFF]++] = entry;
+        }
+        entries.swap(scratch);
+      }
+    }
+  } // namespace SceneRendererUtils
+  
   // Scene Renderer Data ---------------------------------------------------------------------------------------------
   void SceneRendererData::Initialize()
   {
@@ -98,23 +170,45 @@ namespace IKan
   void SceneRenderer::EndScene()
   {
     IK_PERFORMANCE("SceneRenderer::EndScene");
+    
+    // Sort the draws to group them by shader, material and mesh. Front to back inside group
+    SceneRendererUtils::RadixSort(m_sortedDrawList, m_sortScratch);
+    
+    // Cull the submeshes outside camera and batch the visible ones
+    const glm::mat4 viewProjection = SceneRendererData::s_sceneCamera.camera.GetUnReversedProjectionMatrix() * SceneRendererData::s_sceneCamera.viewMatrix;
+    CullDrawList(Frustum(viewProjection));
+    BuildDrawBatches();
+    
+    // Frame uniforms are written once for each material and uploaded when material is bound
+    m_frameMaterialUniforms.clear();
+    m_frameMaterialUniforms.reserve(m_frameMaterials.size());
+    for (const Ref<Material>& material : m_frameMaterials)
+    {
+      Material::UniformStorage& uniformStorage = m_frameMaterialUniforms.emplace_back(material->CreateUniformStorage());
+      material->Set(uniformStorage, "u_ViewProjection", viewProjection);
+      material->Set(uniformStorage, "u_CameraPosition", SceneRendererData::s_sceneCamera.position);
+    }
+    
     m_geometryRenderPass->Bind();
     {
       Renderer::Clear({0.2f, 0.2f, 0.2f, 1.0f});
       
       // Geometry pass
       {
-        for (const auto& meshData : m_meshDrawList)
+        const uint32_t batchCount = static_cast<uint32_t>(m_drawBatches.size());
+        if (!m_parallelRecording or batchCount < SceneRendererData::ParallelRecordingThreshold)
         {
-          // TODO: Get index from somewhere
-          if (meshData.materilTable->HasMaterial(0))
-          {
-            RenderMeshGeometry(meshData.mesh, meshData.transform, meshData.tilingFactor, meshData.materilTable->GetMaterial(0)->GetMaterial());
-          }
-          else
-          {
-            RenderMeshGeometry(meshData.mesh, meshData.transform, meshData.tilingFactor, SceneRendererData::s_defaultMaterial);
-          }
+          RenderDrawList(0, batchCount);
+        }
+        else
+        {
+          // Record contiguous chunks of batches in parallel. Chunks are merged in order, so command stream is same as
+          // serial recording except the binds at start of each chunk
+          const uint32_t chunkCount = (batchCount + SceneRendererData::BatchesPerRecordingChunk - 1) / SceneRendererData::BatchesPerRecordingChunk;
+          Renderer::RecordParallel(chunkCount, [this, batchCount](uint32_t chunkIdx) {
+            const uint32_t begin = chunkIdx * SceneRendererData::BatchesPerRecordingChunk;
+            RenderDrawList(begin, std::min(begin + SceneRendererData::BatchesPerRecordingChunk, batchCount));
+          });
         }
       }
 
@@ -125,39 +219,198 @@ namespace IKan
     }
     m_geometryRenderPass->Unbind();
     
-    // Clear draw list
+    // Clear draw list and per frame data
     {
       m_meshDrawList.clear();
+      m_sortedDrawList.clear();
+      m_drawBatches.clear();
+      m_shaderIndexMap.clear();
+      m_materialIndexMap.clear();
+      m_meshIndexMap.clear();
+      m_frameMaterials.clear();
+      m_frameMaterialUniforms.clear();
     }
   }
   
-  void SceneRenderer::RenderMeshGeometry(Ref<Mesh> mesh, const glm::mat4& transform, float tilingFactor, Ref<Material> material)
+  void SceneRenderer::CullDrawList(const Frustum& frustum)
   {
-    IK_PERFORMANCE("SceneRenderer::RenderMeshGeometry");
-    if (!material)
+    IK_PERFORMANCE("SceneRenderer::CullDrawList");
+    m_submeshDrawOffsets.clear();
+    m_submeshTransforms.clear();
+    
+    // World transform of each submesh draw in sorted order
+    for (const DrawSortEntry& sortEntry : m_sortedDrawList)
     {
-      return;
+      const MeshDrawData& meshData = m_meshDrawList[sortEntry.drawIndex];
+      m_submeshDrawOffsets.push_back(static_cast<uint32_t>(m_submeshTransforms.size()));
+      for (const SubMesh& submesh : meshData.mesh->GetSubMeshes())
+      {
+        m_submeshTransforms.push_back(meshData.transform * submesh.transform);
+      }
     }
+    
+    // World AABBs in SoA packets
+    const uint32_t boxCount = static_cast<uint32_t>(m_submeshTransforms.size());
+    m_cullingPackets.resize((boxCount + AABBPacket::Width - 1) / AABBPacket::Width);
+    for (uint32_t sortIdx = 0; sortIdx < m_sortedDrawList.size(); sortIdx++)
+    {
+      const std::vector<SubMesh>& submeshes = m_meshDrawList[m_sortedDrawList[sortIdx].drawIndex].mesh->GetSubMeshes();
+      for (uint32_t submeshIdx = 0; submeshIdx < submeshes.size(); submeshIdx++)
+      {
+        const uint32_t boxIdx = m_submeshDrawOffsets[sortIdx] + submeshIdx;
+        m_cullingPackets[boxIdx / AABBPacket::Width].Set(boxIdx % AABBPacket::Width, submeshes[submeshIdx].boundingBox.Transformed(m_submeshTransforms[boxIdx]));
+      }
+    }
+    
+    const uint32_t visibleCount = frustum.Cull(m_cullingPackets, boxCount, m_submeshVisibility);
+    
+    RendererStatistics::Culling& stats = RendererStatistics::Get().culling;
+    stats.visibleSubmeshes += visibleCount;
+    stats.culledSubmeshes += boxCount - visibleCount;
+  }
+  
+  void SceneRenderer::BuildDrawBatches()
+  {
+    IK_PERFORMANCE("SceneRenderer::BuildDrawBatches");
+    m_drawBatches.clear();
+    m_instanceTransforms.clear();
+    
+    const uint32_t drawCount = static_cast<uint32_t>(m_sortedDrawList.size());
+    uint32_t batchEnd = 0;
+    for (uint32_t batchBegin = 0; batchBegin < drawCount; batchBegin = batchEnd)
+    {
+      // Draws of batch are consecutive in sorted list. Compare the data as sort key indices can be wrapped
+      const MeshDrawData& firstDraw = m_meshDrawList[m_sortedDrawList[batchBegin].drawIndex];
+      for (batchEnd = batchBegin + 1; batchEnd < drawCount; batchEnd++)
+      {
+        const MeshDrawData& meshData = m_meshDrawList[m_sortedDrawList[batchEnd].drawIndex];
+        if (meshData.mesh != firstDraw.mesh or meshData.materialIndex != firstDraw.materialIndex or
+            meshData.tilingFactor != firstDraw.tilingFactor)
+        {
+          break;
+        }
+      }
+      
+      // One batch for each submesh having any visible instance
+      const uint32_t submeshCount = static_cast<uint32_t>(firstDraw.mesh->GetSubMeshes().size());
+      for (uint32_t submeshIdx = 0; submeshIdx < submeshCount; submeshIdx++)
+      {
+        const uint32_t instanceOffset = static_cast<uint32_t>(m_instanceTransforms.size());
+        for (uint32_t sortIdx = batchBegin; sortIdx < batchEnd; sortIdx++)
+        {
+          const uint32_t boxIdx = m_submeshDrawOffsets[sortIdx] + submeshIdx;
+          if (m_submeshVisibility[boxIdx])
+          {
+            m_instanceTransforms.push_back(m_submeshTransforms[boxIdx]);
+          }
+        }
         
-    material->Set("u_TilingFactor", tilingFactor);
-    material->Set("u_ViewProjection", SceneRendererData::s_sceneCamera.camera.GetUnReversedProjectionMatrix() * SceneRendererData::s_sceneCamera.viewMatrix);
-    material->Set("u_CameraPosition", SceneRendererData::s_sceneCamera.position);
-    material->Set("u_NormalMatrix", glm::transpose(glm::inverse(glm::mat3(transform))));
+        const uint32_t instanceCount = static_cast<uint32_t>(m_instanceTransforms.size()) - instanceOffset;
+        if (instanceCount > 0)
+        {
+          m_drawBatches.push_back({batchBegin, submeshIdx, instanceCount, instanceOffset});
+        }
+      }
+    }
     
-    RenderSubmesh(mesh, transform, material);
+    if (m_instanceTransforms.empty())
+    {
+      return;
+    }
+    
+    // Grow the instance buffer if needed. Old buffer is kept alive by commands already recorded
+    const uint32_t instanceCount = static_cast<uint32_t>(m_instanceTransforms.size());
+    if (instanceCount > m_instanceBufferCapacity)
+    {
+      m_instanceBufferCapacity = std::max(instanceCount, m_instanceBufferCapacity * 2);
+      m_instanceBuffer = VertexBufferFactory::Create(m_instanceBufferCapacity * static_cast<uint32_t>(sizeof(glm::mat4)));
+    }
+    m_instanceBuffer->SetData(m_instanceTransforms.data(), instanceCount * static_cast<uint32_t>(sizeof(glm::mat4)));
   }
-  void SceneRenderer::RenderSubmesh(Ref<Mesh> mesh, const glm::mat4& transform, Ref<Material> material)
-  {
-    IK_PERFORMANCE("SceneRenderer::RenderSubmesh");
-    mesh->GetPipeline()->Bind();
-    for (const SubMesh& submesh : mesh->GetSubMeshes())
-    {
-      material->Set("u_Transform", transform * submesh.transform);
-      material->Bind();
-      Renderer::DrawIndexedBaseVertex(submesh.indexCount, (void*)(sizeof(uint32_t) * submesh.baseIndex), submesh.baseVertex);
-    } // for each submeshes
-    material->Unbind();
-    mesh->GetPipeline()->Unbind();
+  
+  void SceneRenderer::RenderDrawList(uint32_t begin, uint32_t end) const
+  {
+    IK_PERFORMANCE("SceneRenderer::RenderDrawList");
+    if (begin >= end)
+    {
+      return;
+    }
+    
+    // State bound by previous batches of this range
+    const Shader* boundShader {nullptr};
+    const Material* boundMaterial {nullptr};
+    const Pipeline* boundPipeline {nullptr};
+    std::vector<const Texture*> boundTextures;
+    
+    uint32_t shaderBinds = 0, materialBinds = 0, pipelineBinds = 0, textureBinds = 0;
+    uint32_t skippedShaderBinds = 0, skippedMaterialBinds = 0, skippedPipelineBinds = 0, skippedTextureBinds = 0;
+    
+    for (uint32_t batchIdx = begin; batchIdx < end; batchIdx++)
+    {
+      const DrawBatch& batch = m_drawBatches[batchIdx];
+      const MeshDrawData& meshData = m_meshDrawList[m_sortedDrawList[batch.firstDraw].drawIndex];
+      const Ref<Material>& material = m_frameMaterials[meshData.materialIndex];
+      const Ref<Shader>& shader = material->GetShader();
+      const Ref<Pipeline>& pipeline = meshData.mesh->GetPipeline();
+      
+      // Shader
+      if (shader.get() != boundShader)
+      {
+        shader->Bind();
+        boundShader = shader.get();
+        shaderBinds++;
+      }
+      else
+      {
+        skippedShaderBinds++;
+      }
+      
+      // Material. Uploads all the uniforms of material with frame data
+      if (material.get() != boundMaterial)
+      {
+        material->UploadUniforms(m_frameMaterialUniforms[meshData.materialIndex]);
+        textureBinds += material->BindTextures(boundTextures, skippedTextureBinds);
+        boundMaterial = material.get();
+        materialBinds++;
+      }
+      else
+      {
+        skippedMaterialBinds++;
+      }
+      
+      // Mesh pipeline
+      if (pipeline.get() != boundPipeline)
+      {
+        pipeline->Bind();
+        boundPipeline = pipeline.get();
+        pipelineBinds++;
+      }
+      else
+      {
+        skippedPipelineBinds++;
+      }
+      
+      // Instanced draw of submesh. Transforms are read from instance buffer
+      const SubMesh& submesh = meshData.mesh->GetSubMeshes()[batch.submeshIndex];
+      shader->SetUniformFloat1("u_TilingFactor", meshData.tilingFactor);
+      pipeline->SetInstanceBuffer(m_instanceBuffer, batch.instanceOffset * static_cast<uint32_t>(sizeof(glm::mat4)));
+      Renderer::DrawIndexedBaseVertexInstanced(submesh.indexCount, (void*)(sizeof(uint32_t) * submesh.baseIndex), submesh.baseVertex, batch.instanceCount);
+    }
+    
+    // Unbind the last state of this range
+    const MeshDrawData& lastMeshData = m_meshDrawList[m_sortedDrawList[m_drawBatches[end - 1].firstDraw].drawIndex];
+    m_frameMaterials[lastMeshData.materialIndex]->Unbind();
+    lastMeshData.mesh->GetPipeline()->Unbind();
+    
+    RendererStatistics::StateChanges& stats = RendererStatistics::Get().stateChanges;
+    stats.shaderBinds += shaderBinds;
+    stats.materialBinds += materialBinds;
+    stats.pipelineBinds += pipelineBinds;
+    stats.textureBinds += textureBinds;
+    stats.skippedShaderBinds += skippedShaderBinds;
+    stats.skippedMaterialBinds += skippedMaterialBinds;
+    stats.skippedPipelineBinds += skippedPipelineBinds;
+    stats.skippedTextureBinds += skippedTextureBinds;
   }
   
   void SceneRenderer::SetViewportSize(uint32_t width, uint32_t height)
@@ -179,6 +432,10 @@ namespace IKan
   {
     m_debugRenderer = func;
   }
+  void SceneRenderer::SetParallelRecording(bool enable)
+  {
+    m_parallelRecording = enable;
+  }
 
   Ref<Texture> SceneRenderer::GetFinalImage() const
   {
@@ -189,13 +446,40 @@ namespace IKan
   {
     IK_PERFORMANCE("SceneRenderer::SubmitMesh");
     
-    const auto& mesh = AssetManager::GetAsset<Mesh>(meshHandle);
+    // Placeholder mesh is drawn until mesh is loaded on worker thread
+    const Ref<Mesh> mesh = AssetManager::GetAssetAsync<Mesh>(meshHandle);
     if (!mesh)
     {
       return;
     }
     
-    m_meshDrawList.push_back({mesh, materilTable, tilingFactor, transform});
+    // TODO: Get index from somewhere
+    const Ref<Material>& material = materilTable and materilTable->HasMaterial(0) ? materilTable->GetMaterial(0)->GetMaterial() : SceneRendererData::s_defaultMaterial;
+    if (!material)
+    {
+      return;
+    }
+    
+    // Per frame indices of resources for sort key
+    const uint32_t shaderIndex = GetFrameIndex(m_shaderIndexMap, material->GetShader().get());
+    const uint32_t meshIndex = GetFrameIndex(m_meshIndexMap, mesh.get());
+    const uint32_t materialIndex = GetFrameIndex(m_materialIndexMap, material.get());
+    if (materialIndex == m_frameMaterials.size())
+    {
+      m_frameMaterials.push_back(material);
+    }
+    
+    // Depth of mesh origin, normalized with far plane
+    const SceneRendererCamera& sceneCamera = SceneRendererData::s_sceneCamera;
+    const float depth = sceneCamera.far > 0.0f ? glm::distance(glm::vec3(transform[3]), sceneCamera.position) / sceneCamera.far : 0.0f;
+    
+    m_sortedDrawList.push_back({SceneRendererUtils::PackSortKey(shaderIndex, materialIndex, meshIndex, depth), static_cast<uint32_t>(m_meshDrawList.size())});
+    m_meshDrawList.push_back({mesh, materialIndex, tilingFactor, transform});
+  }
+  
+  uint32_t SceneRenderer::GetFrameIndex(std::unordered_map<const void*, uint32_t>& indexMap, const void* resource)
+  {
+    return indexMap.try_emplace(resource, static_cast<uint32_t>(indexMap.size())).first->second;
   }
 
 } // namespace IKan
@@ -24,34 +24,40 @@ namespace IKan
 
     // Fixed Constants
     static constexpr uint32_t VertexForSingleChar = 6;
+    static constexpr uint32_t MaxCharsPerBatch = 2048;
+    static constexpr uint32_t MaxVerticesPerBatch = VertexForSingleChar * MaxCharsPerBatch;
+    
+    /// Base Texture coordinate for Char rendering
+    static constexpr glm::vec2 BaseTextureCoords[VertexForSingleChar] =
+    {
+      { 0.0f, 0.0f }, { 0.0f, 1.0f }, { 1.0f, 1.0f }, { 0.0f, 0.0f }, { 1.0f, 1.0f }, { 1.0f, 0.0f }
+    };
 
     /// Renderer Data storage
     Ref<Pipeline> pipeline;
     Ref<VertexBuffer> vertexBuffer;
     Ref<Shader> shader;
 
-    /// Stores the Char Textures in array
-    std::array<Ref<CharTexture>, Texture2DSpecification::MaxTextureSlotsInShader> charTextures;
+    /// Stores the glyph atlas pages used in batch. Text of all fonts is rendered in single draw call till slots are full
+    std::array<Ref<Texture>, Texture2DSpecification::MaxTextureSlotsInShader> atlasPages;
 
     /// Base pointer of Vertex Data. This is start of Batch data for single draw call
     Vertex* vertexBufferBasePtr = nullptr;
     /// Incrememntal Vetrtex Data Pointer to store all the batch data in Buffer
     Vertex* vertexBufferPtr = nullptr;
     
-    /// Store the Base Texture coordinga
-    glm::vec2 baseTextureCoords[VertexForSingleChar];
-    
     uint32_t numSlotsUsed = 0;
+    uint32_t vertexCount = 0;
 
     void Initialize()
     {
       IK_PROFILE();
       
       // Allocating the memory for vertex Buffer Pointer
-      vertexBufferBasePtr = new TextData::Vertex[TextData::VertexForSingleChar * Texture2DSpecification::MaxTextureSlotsInShader];
+      vertexBufferBasePtr = new TextData::Vertex[TextData::MaxVerticesPerBatch];
       
       // Create vertes Buffer
-      vertexBuffer = VertexBufferFactory::Create(sizeof(TextData::Vertex) * TextData::VertexForSingleChar * Texture2DSpecification::MaxTextureSlotsInShader);
+      vertexBuffer = VertexBufferFactory::Create(sizeof(TextData::Vertex) * TextData::MaxVerticesPerBatch);
       
       // Create Pipeline specification
       PipelineSpecification pipelineSpec;
@@ -70,17 +76,12 @@ namespace IKan
       // Create the Pipeline instnace
       pipeline = PipelineFactory::Create(pipelineSpec);
       
-      // Base Texture coordinate for Char rendering
-      baseTextureCoords[0] = { 0.0f, 0.0f };
-      baseTextureCoords[1] = { 0.0f, 1.0f };
-      baseTextureCoords[2] = { 1.0f, 1.0f };
-      baseTextureCoords[3] = { 0.0f, 0.0f };
-      baseTextureCoords[4] = { 1.0f, 1.0f };
-      baseTextureCoords[5] = { 1.0f, 0.0f };
+      // Increase the stat
+      RendererStatistics::Get()._2d.maxChars = MaxCharsPerBatch;
       
       IK_LOG_INFO(LogModule::TextRenderer, "Initialized the Text Renderer ");
-      IK_LOG_INFO(LogModule::TextRenderer, "  Vertex Buffer Used             | {0} B",
-                  TextData::VertexForSingleChar * sizeof(TextData::Vertex) * Texture2DSpecification::MaxTextureSlotsInShader);
+      IK_LOG_INFO(LogModule::TextRenderer, "  Max Chars per Batch            | {0}", TextData::MaxCharsPerBatch);
+      IK_LOG_INFO(LogModule::TextRenderer, "  Vertex Buffer Used             | {0} B", TextData::MaxVerticesPerBatch * sizeof(TextData::Vertex));
       IK_LOG_INFO(LogModule::TextRenderer, "  Shader used                    | {0}", shader->GetName());
     }
     
@@ -89,13 +90,14 @@ namespace IKan
       IK_PROFILE();
       
       IK_LOG_WARN(LogModule::TextRenderer, "Shutting down the Text Renderer ");
-      IK_LOG_WARN(LogModule::TextRenderer, "  Vertex Buffer Used            | {0} B",
-                  TextData::VertexForSingleChar * sizeof(TextData::Vertex) * Texture2DSpecification::MaxTextureSlotsInShader);
+      IK_LOG_WARN(LogModule::TextRenderer, "  Max Chars per Batch           | {0}", TextData::MaxCharsPerBatch);
+      IK_LOG_WARN(LogModule::TextRenderer, "  Vertex Buffer Used            | {0} B", TextData::MaxVerticesPerBatch * sizeof(TextData::Vertex));
       IK_LOG_WARN(LogModule::TextRenderer, "  Shader used                   | {0}", shader->GetName());
       
       vertexBuffer.reset();
       pipeline.reset();
       shader.reset();
+      atlasPages = {};
       
       delete [] vertexBufferBasePtr;
       vertexBufferBasePtr = nullptr;
@@ -117,6 +119,7 @@ namespace IKan
       IK_PERFORMANCE("Text::ResetBatch");
       vertexBufferPtr = vertexBufferBasePtr;
       numSlotsUsed = 0;
+      vertexCount = 0;
     }
     
     void Flush()
@@ -131,9 +134,9 @@ namespace IKan
         shader->Bind();
         for (uint32_t j = 0; j < numSlotsUsed; j ++)
         {
-          charTextures[j]->Bind(j);
+          atlasPages[j]->Bind(j);
         }
-        Renderer::DrawArrays(pipeline, VertexForSingleChar * numSlotsUsed);
+        Renderer::DrawArrays(pipeline, vertexCount);
       }
       ResetBatch();
     }
@@ -0,0 +1,260 @@
+//
+//  TextLayout.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "Renderer/TextData.hpp"
+#include "Renderer/RendererStats.hpp"
+#include "Renderer/UI/Font.hpp"
+
+namespace IKan
+{
+  /// This structure stores the positioned glyph quads of text. Vertices are resolved for last submitted position, color
+  /// and object ID, so submitting unchanged text again only copies the vertices in batch
+  struct TextLayout
+  {
+    /// This structure stores the vertices of text using same atlas page
+    struct Run
+    {
+      Ref<Texture> page;
+      uint32_t firstVertex {0};
+      uint32_t vertexCount {0};
+      uint32_t slot {UINT32_MAX}; // Texture slot stored in vertices
+    };
+
+    // Member Variables ----------------------------------------------------------------------------------------------
+    std::string text {};
+    Ref<Font> font;
+    glm::vec2 scale {0.0f};
+
+    std::vector<Run> runs;
+    std::vector<glm::vec3> localPositions; // Position of vertices relative to text position
+    std::vector<TextData::Vertex> vertices;
+    uint32_t charCount {0}; // Visible chars only
+
+    // Resolved data of vertices
+    glm::vec3 position {0.0f};
+    glm::vec4 color {0.0f};
+    int32_t objectID {-1};
+
+    uint64_t lastUsedBatch {0};
+
+    // Member Functions ----------------------------------------------------------------------------------------------
+    /// This function creates the glyph quads of text. Vertices are resolved at origin
+    void Build()
+    {
+      IK_PERFORMANCE("TextLayout::Build");
+      runs.clear();
+      localPositions.clear();
+      vertices.clear();
+      charCount = 0;
+
+      const GlyphAtlas& atlas = font->GetAtlas();
+      std::vector<uint32_t> glyphPages;
+
+      glm::vec2 pen {0.0f};
+      const Font::Glyph* previousGlyph = nullptr;
+      for (size_t offset = 0; offset < text.size(); )
+      {
+        const char32_t codePoint = Utils::String::DecodeUTF8(text, offset);
+        if (codePoint == '\n')
+        {
+          pen.y -= font->GetLineHeight() * scale.y;
+          pen.x = 0.0f;
+          previousGlyph = nullptr;
+          continue;
+        }
+
+        const Font::Glyph& glyph = font->GetGlyph(codePoint);
+        if (previousGlyph)
+        {
+          pen.x += font->GetKerning(*previousGlyph, glyph) * scale.x;
+        }
+        previousGlyph = &glyph;
+
+        if (glyph.visible)
+        {
+          float xpos = pen.x + glyph.bearing.x * scale.x;
+          float ypos = pen.y - (glyph.size.y - glyph.bearing.y) * scale.y;
+
+          float w = glyph.size.x * scale.x;
+          float h = glyph.size.y * scale.y;
+
+          glm::vec3 vertexPosition[TextData::VertexForSingleChar] =
+          {
+            { xpos,     ypos + h, 0.0f },
+            { xpos,     ypos    , 0.0f },
+            { xpos + w, ypos    , 0.0f },
+
+            { xpos,     ypos + h, 0.0f },
+            { xpos + w, ypos    , 0.0f },
+            { xpos + w, ypos + h, 0.0f },
+          };
+
+          // Base texture coordinates are mapped to region of glyph in atlas page
+          const glm::vec2 regionSize = glyph.region.uvMax - glyph.region.uvMin;
+          for (size_t i = 0; i < TextData::VertexForSingleChar; i++)
+          {
+            TextData::Vertex& vertex = vertices.emplace_back();
+            vertex.position = vertexPosition[i];
+            vertex.color = color;
+            vertex.textureCoord = glyph.region.uvMin + TextData::BaseTextureCoords[i] * regionSize;
+            vertex.textureIndex = 0.0f;
+            vertex.objectID = objectID;
+          }
+          glyphPages.push_back(glyph.region.page);
+          charCount++;
+        }
+
+        // now advance cursors for next glyph
+        pen.x += glyph.advance * scale.x;
+      }
+
+      // Group the glyphs by atlas page, so that each page is copied in batch at once
+      std::vector<TextData::Vertex> groupedVertices;
+      groupedVertices.reserve(vertices.size());
+      std::vector<uint32_t> pages = glyphPages;
+      std::sort(pages.begin(), pages.end());
+      pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+      for (uint32_t page : pages)
+      {
+        Run& run = runs.emplace_back();
+        run.page = atlas.GetPage(page);
+        run.firstVertex = static_cast<uint32_t>(groupedVertices.size());
+        for (size_t glyphIdx = 0; glyphIdx < glyphPages.size(); glyphIdx++)
+        {
+          if (glyphPages[glyphIdx] == page)
+          {
+            auto glyphVertices = vertices.begin() + static_cast<ptrdiff_t>(glyphIdx * TextData::VertexForSingleChar);
+            groupedVertices.insert(groupedVertices.end(), glyphVertices, glyphVertices + TextData::VertexForSingleChar);
+          }
+        }
+        run.vertexCount = static_cast<uint32_t>(groupedVertices.size()) - run.firstVertex;
+      }
+      vertices = std::move(groupedVertices);
+
+      localPositions.reserve(vertices.size());
+      for (const TextData::Vertex& vertex : vertices)
+      {
+        localPositions.push_back(vertex.position);
+      }
+      position = glm::vec3(0.0f);
+    }
+
+    /// This function updates the vertices if text is submitted with different data than last time
+    /// - Parameters:
+    ///   - newPosition: text position
+    ///   - newColor: text color
+    ///   - newObjectID: pixel ID
+    void Resolve(const glm::vec3& newPosition, const glm::vec4& newColor, int32_t newObjectID)
+    {
+      if (newPosition != position)
+      {
+        position = newPosition;
+        for (size_t i = 0; i < vertices.size(); i++)
+        {
+          vertices[i].position = localPositions[i] + position;
+        }
+      }
+
+      if (newColor != color or newObjectID != objectID)
+      {
+        color = newColor;
+        objectID = newObjectID;
+        for (TextData::Vertex& vertex : vertices)
+        {
+          vertex.color = color;
+          vertex.objectID = objectID;
+        }
+      }
+    }
+  };
+
+  /// This structure stores the layouts of text submitted recently. Layouts are found with hash of text, font and scale
+  struct TextLayoutCache
+  {
+    /// This structure stores the key of text layout
+    struct Key
+    {
+      size_t textHash {0};
+      const Font* font {nullptr};
+      glm::vec2 scale {0.0f};
+
+      bool operator==(const Key& other) const
+      {
+        return textHash == other.textHash and font == other.font and scale == other.scale;
+      }
+    };
+
+    /// This structure computes the hash of text layout key
+    struct KeyHash
+    {
+      size_t operator()(const Key& key) const
+      {
+        size_t hash = key.textHash;
+        hash ^= std::hash<const Font*>{}(key.font) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<float>{}(key.scale.x) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<float>{}(key.scale.y) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+      }
+    };
+
+    // Fixed Constants
+    static constexpr uint64_t EvictionInterval = 256; // Batches after which unused layouts are removed
+
+    // Member Variables ----------------------------------------------------------------------------------------------
+    std::unordered_map<Key, TextLayout, KeyHash> layouts;
+    uint64_t batchIndex {0};
+
+    // Member Functions ----------------------------------------------------------------------------------------------
+    /// This function returns the layout of text. Layout is created if text is not submitted recently
+    /// - Parameters:
+    ///   - text: text to be rendered
+    ///   - font: font of text
+    ///   - scale: scale of text
+    TextLayout& Get(const std::string& text, const Ref<Font>& font, const glm::vec2& scale)
+    {
+      IK_PERFORMANCE("TextLayoutCache::Get");
+      TextLayout& layout = layouts[Key {std::hash<std::string>{}(text), font.get(), scale}];
+      layout.lastUsedBatch = batchIndex;
+
+      // Text is compared as different texts can have same hash
+      if (layout.font == font and layout.text == text)
+      {
+        RendererStatistics::Get()._2d.textLayoutHits++;
+        return layout;
+      }
+
+      RendererStatistics::Get()._2d.textLayoutMisses++;
+      layout.text = text;
+      layout.font = font;
+      layout.scale = scale;
+      layout.Build();
+      return layout;
+    }
+
+    /// This function starts the new batch and removes the layouts not used in last eviction interval
+    void NextBatch()
+    {
+      if (++batchIndex % EvictionInterval != 0)
+      {
+        return;
+      }
+
+      for (auto it = layouts.begin(); it != layouts.end(); )
+      {
+        it = batchIndex - it->second.lastUsedBatch > EvictionInterval ? layouts.erase(it) : std::next(it);
+      }
+    }
+
+    /// This function removes all the layouts
+    void Clear()
+    {
+      layouts.clear();
+    }
+  };
+} // namespace IKan
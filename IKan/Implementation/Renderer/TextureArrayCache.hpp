@@ -0,0 +1,257 @@
+//
+//  TextureArrayCache.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include <bit>
+
+#include "Renderer/BatchData.hpp"
+
+namespace IKan
+{
+  /// This structure stores the image textures of 2D shapes in layers of texture arrays. Images are grouped by power of
+  /// two size class and sampler, so shapes using any of them are rendered with single texture slot instead of one slot
+  /// per image. Image is copied at origin of layer and shader scales the texture coordinates to size of image
+  struct TextureArrayCache
+  {
+    /// This structure stores the layer of texture copied in array
+    struct Layer
+    {
+      std::weak_ptr<Texture> texture; // Layer is reused once texture is destroyed
+      uint32_t arrayIndex {UINT32_MAX}; // UINT32_MAX if texture can not be stored in array
+      uint32_t layer {0};
+      glm::vec2 scale {1.0f}; // Size of texture relative to size of layer
+    };
+
+    /// This structure stores the texture array of one size class and sampler
+    struct Array
+    {
+      Ref<TextureArray> textureArray;
+      glm::uvec2 size {0};
+      TextureFilter minFilter {TextureFilter::Linear};
+      TextureFilter magFilter {TextureFilter::Linear};
+      uint32_t maxLayers {0};
+      uint32_t usedLayers {0};
+      std::vector<uint32_t> freeLayers;
+    };
+
+    // Fixed Constants
+    static constexpr uint64_t MaxArrayBytes = 64 * 1024 * 1024;
+    static constexpr uint32_t MaxLayersInArray = 256;
+    static constexpr uint32_t InitialLayersInArray = 4;
+    static constexpr uint32_t MinLayerSize = 32;
+    static constexpr uint32_t MaxLayerSize = 2048;
+
+    // Member Variables ----------------------------------------------------------------------------------------------
+    std::unordered_map<const Texture*, Layer> layers;
+    std::vector<Array> arrays;
+    /// Layers of destroyed textures. Shapes of current batch may still use them, so they are freed in next batch
+    std::vector<Layer> releasedLayers;
+
+    // Member Functions ----------------------------------------------------------------------------------------------
+    /// This function returns the layer of texture. Texture is copied in array when used first time
+    /// - Parameter texture: texture of shape
+    /// - Returns: nullptr if texture is not an image (Render targets change every frame, so they are not copied) or
+    ///            image can not be sampled from array (Bigger than max layer or not repeated)
+    const Layer* Get(const Ref<Texture>& texture)
+    {
+      auto it = layers.find(texture.get());
+      if (it != layers.end())
+      {
+        // Texture is stored with same address, but it may be a new texture allocated after older is destroyed
+        if (!it->second.texture.expired())
+        {
+          return it->second.arrayIndex == UINT32_MAX ? nullptr : &it->second;
+        }
+        Release(it->second);
+        layers.erase(it);
+      }
+
+      IK_PERFORMANCE("TextureArrayCache::Add");
+      Layer& layer = layers[texture.get()];
+      layer.texture = texture;
+
+      const Image* image = dynamic_cast<const Image*>(texture.get());
+      const uint32_t width = texture->GetWidth(), height = texture->GetHeight();
+      if (!image or !IsSupported(image->GetSpecification()) or width == 0 or height == 0 or width > MaxLayerSize or
+          height > MaxLayerSize)
+      {
+        return nullptr;
+      }
+
+      const Imagespecification& spec = image->GetSpecification();
+      const glm::uvec2 size {GetSizeClass(width), GetSizeClass(height)};
+      if (!Allocate(size, spec, layer))
+      {
+        // Destroyed textures are removed only when their size class is full. Their layers are free from next batch
+        RemoveExpired();
+        AddArray(size, spec);
+        [[maybe_unused]] bool allocated = Allocate(size, spec, layer);
+        IK_ASSERT(allocated);
+      }
+
+      layer.scale = glm::vec2(width, height) / glm::vec2(size);
+      arrays[layer.arrayIndex].textureArray->CopyToLayer(texture, layer.layer);
+      return &layer;
+    }
+
+    /// This function frees the layers released in previous batch. Should be called at start of batch
+    void NextBatch()
+    {
+      for (const Layer& layer : releasedLayers)
+      {
+        arrays[layer.arrayIndex].freeLayers.push_back(layer.layer);
+      }
+      releasedLayers.clear();
+    }
+
+    /// This function removes all the arrays
+    void Clear()
+    {
+      layers.clear();
+      arrays.clear();
+      releasedLayers.clear();
+    }
+
+  private:
+    /// This function checks if image can be sampled from array. Arrays have no mipmaps and coordinates are repeated
+    /// inside image by shader, so other images use texture slots
+    /// - Parameter spec: image specification
+    static bool IsSupported(const Imagespecification& spec)
+    {
+      auto isFilterSupported = [](TextureFilter filter) {
+        return filter == TextureFilter::Linear or filter == TextureFilter::Nearest;
+      };
+      return spec.Xwrap == TextureWrap::Repeat and spec.Ywrap == TextureWrap::Repeat and
+             isFilterSupported(spec.minFilter) and isFilterSupported(spec.magFilter);
+    }
+
+    /// This function returns the size class of texture dimension
+    /// - Parameter dimension: width or height of texture
+    static uint32_t GetSizeClass(uint32_t dimension)
+    {
+      return std::bit_ceil(std::max(dimension, MinLayerSize));
+    }
+
+    /// This function finds the free layer in arrays of size class and sampler. Array is grown if it is full
+    /// - Parameters:
+    ///   - size: size class of texture
+    ///   - spec: image specification
+    ///   - layer: layer to be updated
+    /// - Returns: false if all arrays of size class and sampler are full
+    bool Allocate(const glm::uvec2& size, const Imagespecification& spec, Layer& layer)
+    {
+      for (uint32_t arrayIdx = 0; arrayIdx < arrays.size(); arrayIdx++)
+      {
+        Array& array = arrays[arrayIdx];
+        if (array.size != size or array.minFilter != spec.minFilter or array.magFilter != spec.magFilter)
+        {
+          continue;
+        }
+
+        if (!array.freeLayers.empty())
+        {
+          layer.layer = array.freeLayers.back();
+          array.freeLayers.pop_back();
+        }
+        else if (array.usedLayers < array.maxLayers)
+        {
+          if (array.usedLayers == array.textureArray->GetLayerCount())
+          {
+            GrowArray(array);
+          }
+          layer.layer = array.usedLayers++;
+        }
+        else
+        {
+          continue;
+        }
+        layer.arrayIndex = arrayIdx;
+        return true;
+      }
+      return false;
+    }
+
+    /// This function creates new array for textures of size class and sampler. Array starts with few layers and grows
+    /// till max layers of size class
+    /// - Parameters:
+    ///   - size: size class of texture
+    ///   - spec: image specification
+    void AddArray(const glm::uvec2& size, const Imagespecification& spec)
+    {
+      IK_PROFILE();
+      const uint64_t layerBytes = static_cast<uint64_t>(size.x) * size.y * 4;
+
+      Array& array = arrays.emplace_back();
+      array.size = size;
+      array.minFilter = spec.minFilter;
+      array.magFilter = spec.magFilter;
+      array.maxLayers = static_cast<uint32_t>(std::clamp<uint64_t>(MaxArrayBytes / layerBytes, 1, MaxLayersInArray));
+      array.textureArray = CreateTextureArray(array, std::min(InitialLayersInArray, array.maxLayers));
+
+      BATCH_TRACE("Added texture array of {0} layers (Max {1}) for {2} x {3} textures", array.textureArray->GetLayerCount(),
+                  array.maxLayers, size.x, size.y);
+    }
+
+    /// This function doubles the layers of array. Layers are copied in new array on GPU. Batch still having older array
+    /// in its slot renders from older array
+    /// - Parameter array: array to be grown
+    void GrowArray(Array& array)
+    {
+      IK_PROFILE();
+      const uint32_t layerCount = std::min(array.textureArray->GetLayerCount() * 2, array.maxLayers);
+      Ref<TextureArray> textureArray = CreateTextureArray(array, layerCount);
+      textureArray->CopyLayers(array.textureArray, array.usedLayers);
+      array.textureArray = textureArray;
+
+      BATCH_TRACE("Grown texture array of {0} x {1} textures to {2} layers", array.size.x, array.size.y, layerCount);
+    }
+
+    /// This function creates the texture array of array size and sampler
+    /// - Parameters:
+    ///   - array: array data
+    ///   - layerCount: number of layers
+    static Ref<TextureArray> CreateTextureArray(const Array& array, uint32_t layerCount)
+    {
+      TextureArraySpecification spec;
+      spec.title = "Renderer2D Array " + std::to_string(array.size.x) + "x" + std::to_string(array.size.y);
+      spec.width = array.size.x;
+      spec.height = array.size.y;
+      spec.layers = layerCount;
+      spec.minFilter = array.minFilter;
+      spec.magFilter = array.magFilter;
+      return TextureFactory::Create(spec);
+    }
+
+    /// This function releases the layer of texture. Layer is freed in next batch
+    /// - Parameter layer: layer of texture
+    void Release(const Layer& layer)
+    {
+      if (layer.arrayIndex != UINT32_MAX)
+      {
+        releasedLayers.push_back(layer);
+      }
+    }
+
+    /// This function releases the layers of destroyed textures
+    void RemoveExpired()
+    {
+      for (auto it = layers.begin(); it != layers.end(); )
+      {
+        if (it->second.texture.expired())
+        {
+          Release(it->second);
+          it = layers.erase(it);
+        }
+        else
+        {
+          it++;
+        }
+      }
+    }
+  };
+} // namespace IKan
@@ -10,8 +10,6 @@
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
-#include "Renderer/Graphics/Texture.hpp"
-
 namespace IKan
 {
   Ref<Font> Font::Create(const std::filesystem::path& filePath)
@@ -39,59 +37,43 @@ namespace IKan
   }
 
   Font::Font(const std::filesystem::path& fontFilePath)
+  : m_filePath(fontFilePath)
   {
     IK_PROFILE();
-    FT_Library ft = nullptr;
-    [[maybe_unused]] bool initialized = FT_Init_FreeType(&ft);
+    [[maybe_unused]] bool initialized = FT_Init_FreeType(&m_library);
     IK_ASSERT(!initialized, "Not able to load Freetype");
     
     // find path to font
     IK_ASSERT(std::filesystem::exists(fontFilePath), "Invalid Font path");
     
-    // Load font as face
-    FT_Face face = nullptr;
-    [[maybe_unused]] bool faceCreated = FT_New_Face(ft, fontFilePath.c_str(), 0, &face);
+    // Load font as face. Face is kept open to load the glyphs when used first time
+    [[maybe_unused]] bool faceCreated = FT_New_Face(m_library, fontFilePath.c_str(), 0, &m_face);
     IK_ASSERT(!faceCreated, "Unavle to load tha font to freetype");
     
     // Set size to load glyphs as
-    FT_Set_Pixel_Sizes(face, 0, 48);
+    FT_Set_Pixel_Sizes(m_face, 0, PixelSize);
+    m_hasKerning = FT_HAS_KERNING(m_face);
+    
+    m_atlas = CreateScope<GlyphAtlas>(fontFilePath.filename().string());
     
-    // Load first 128 characters of ASCII set
-    for (unsigned char c = 0; c < 128; c++)
+    // Load the ASCII characters up front as they are used by most of the texts
+    for (char32_t codePoint = ' '; codePoint < 127; codePoint++)
     {
-      // Load character glyph
-      if (FT_Load_Char(face, c, FT_LOAD_RENDER))
-      {
-        IK_LOG_CRITICAL(LogModule::Font, "ERROR::FREETYTPE: Failed to load Glyph");
-        continue;
-      }
-      
-      // Character specification
-      CharTextureSpecification spec;
-      spec.face = face;
-      spec.size = glm::ivec2(face->glyph->bitmap.width, face->glyph->bitmap.rows);
-      spec.bearing = glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top);
-      spec.advance = static_cast<uint32_t>(face->glyph->advance.x);
-      spec.charVal = static_cast<char>(c);
-      
-      // Now store character for later use
-      Ref<CharTexture> charTexture = std::dynamic_pointer_cast<CharTexture>(TextureFactory::Create(spec));
-      m_charTextureMap.insert(std::pair<char, Ref<CharTexture>>(c, charTexture));
+      GetGlyph(codePoint);
     }
     
-    // destroy FreeType once we're finished
-    FT_Done_Face(face);
-    FT_Done_FreeType(ft);
-    
-    m_filePath = fontFilePath;
-    
     IK_LOG_INFO(LogModule::Font, "Loaded the Font for Text renderer '{0}'", Utils::FileSystem::IKanAbsolute(fontFilePath.c_str()).string());
   }
   
   Font::~Font()
   {
     IK_PROFILE();
-    m_charTextureMap.clear();
+    m_glyphs.clear();
+    m_atlas.reset();
+    
+    // destroy FreeType once we're finished
+    FT_Done_Face(m_face);
+    FT_Done_FreeType(m_library);
   }
   
   const std::filesystem::path& Font::GetFilePath() const
@@ -99,10 +81,90 @@ namespace IKan
     return m_filePath;
   }
   
-  Ref<CharTexture> Font::GetCharTexture(char charValue)
+  const Font::Glyph& Font::GetGlyph(char32_t codePoint)
+  {
+    if (auto it = m_glyphs.find(codePoint); it != m_glyphs.end())
+    {
+      return it->second;
+    }
+    return m_glyphs.emplace(codePoint, LoadGlyph(codePoint)).first->second;
+  }
+  
+  float Font::GetKerning(const Glyph& left, const Glyph& right) const
+  {
+    if (!m_hasKerning)
+    {
+      return 0.0f;
+    }
+    
+    FT_Vector kerning;
+    if (FT_Get_Kerning(m_face, left.index, right.index, FT_KERNING_DEFAULT, &kerning))
+    {
+      return 0.0f;
+    }
+    return static_cast<float>(kerning.x) / 64.0f;
+  }
+  
+  float Font::GetLineHeight() const
+  {
+    return static_cast<float>(m_face->size->metrics.height) / 64.0f;
+  }
+  
+  const GlyphAtlas& Font::GetAtlas() const
+  {
+    return *m_atlas;
+  }
+  
+  Font::Glyph Font::LoadGlyph(char32_t codePoint)
   {
-    IK_ASSERT(m_charTextureMap.find(charValue) != m_charTextureMap.end());
-    return m_charTextureMap.at(charValue);
+    IK_PROFILE();
+    Glyph glyph;
+    
+    // Missing characters use the glyph 0 of font (empty box)
+    glyph.index = FT_Get_Char_Index(m_face, codePoint);
+    if (FT_Load_Glyph(m_face, glyph.index, FT_LOAD_DEFAULT))
+    {
+      IK_LOG_CRITICAL(LogModule::Font, "ERROR::FREETYTPE: Failed to load Glyph {0}", static_cast<uint32_t>(codePoint));
+      return glyph;
+    }
+    
+    // advance is number of 1/64 pixels
+    FT_GlyphSlot slot = m_face->glyph;
+    glyph.advance = static_cast<float>(slot->advance.x) / 64.0f;
+    
+    // White spaces have no outline to render
+    if (slot->format == FT_GLYPH_FORMAT_OUTLINE and slot->outline.n_contours == 0)
+    {
+      return glyph;
+    }
+    
+    // Distance field keeps the edges sharp when text is scaled. Coverage bitmap is used if Freetype is built without
+    // sdf module, edge of both is at half value
+    if (FT_Render_Glyph(slot, FT_RENDER_MODE_SDF) and FT_Render_Glyph(slot, FT_RENDER_MODE_NORMAL))
+    {
+      IK_LOG_CRITICAL(LogModule::Font, "ERROR::FREETYTPE: Failed to render Glyph {0}", static_cast<uint32_t>(codePoint));
+      return glyph;
+    }
+    
+    const FT_Bitmap& bitmap = slot->bitmap;
+    if (bitmap.width == 0 or bitmap.rows == 0)
+    {
+      return glyph;
+    }
+    
+    // Remove the row padding of bitmap before adding to atlas
+    std::vector<uint8_t> pixels(bitmap.width * bitmap.rows);
+    for (uint32_t row = 0; row < bitmap.rows; row++)
+    {
+      const uint8_t* rowData = bitmap.buffer + static_cast<ptrdiff_t>(row) * bitmap.pitch;
+      std::copy(rowData, rowData + bitmap.width, pixels.data() + row * bitmap.width);
+    }
+    
+    glyph.size = glm::vec2(bitmap.width, bitmap.rows);
+    glyph.bearing = glm::vec2(slot->bitmap_left, slot->bitmap_top);
+    glyph.visible = true;
+    glyph.region = m_atlas->Add(pixels.data(), bitmap.width, bitmap.rows);
+    return glyph;
   }
   
   Ref<Font> FontLibrary::Get(const std::filesystem::path& fontFilePath)
@@ -0,0 +1,109 @@
+//
+//  GlyphAtlas.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "GlyphAtlas.hpp"
+
+#include "Renderer/Graphics/Texture.hpp"
+
+namespace IKan
+{
+  GlyphAtlas::GlyphAtlas(const std::string& name)
+  : m_name(name)
+  {
+  }
+
+  GlyphAtlas::Region GlyphAtlas::Add(const uint8_t* bitmap, uint32_t width, uint32_t height)
+  {
+    IK_PROFILE();
+    IK_ASSERT(width + Padding <= PageSize and height + Padding <= PageSize, "Glyph is bigger than atlas page!");
+
+    // Glyphs are added rarely, so every page is searched to fill the gaps in older pages
+    glm::uvec2 position {0};
+    uint32_t pageIdx = 0;
+    while (pageIdx < m_pages.size() and !Allocate(m_pages[pageIdx], width + Padding, height + Padding, position))
+    {
+      pageIdx++;
+    }
+
+    if (pageIdx == m_pages.size())
+    {
+      AddPage();
+      [[maybe_unused]] bool allocated = Allocate(m_pages.back(), width + Padding, height + Padding, position);
+      IK_ASSERT(allocated);
+    }
+
+    m_pages[pageIdx].texture->SetData(const_cast<uint8_t*>(bitmap), position.x, position.y, width, height);
+
+    Region region;
+    region.page = pageIdx;
+    region.uvMin = glm::vec2(position) / static_cast<float>(PageSize);
+    region.uvMax = glm::vec2(position + glm::uvec2(width, height)) / static_cast<float>(PageSize);
+    return region;
+  }
+
+  bool GlyphAtlas::Allocate(Page& page, uint32_t width, uint32_t height, glm::uvec2& position)
+  {
+    // Shelf wasting least height is used
+    Shelf* bestShelf = nullptr;
+    for (Shelf& shelf : page.shelves)
+    {
+      if (shelf.height >= height and shelf.width + width <= PageSize and (!bestShelf or shelf.height < bestShelf->height))
+      {
+        bestShelf = &shelf;
+      }
+    }
+
+    // Open new shelf if glyph does not fit in any shelf
+    if (!bestShelf)
+    {
+      if (page.height + height > PageSize)
+      {
+        return false;
+      }
+      bestShelf = &page.shelves.emplace_back(Shelf {page.height, height, 0});
+      page.height += height;
+    }
+
+    position = {bestShelf->width, bestShelf->y};
+    bestShelf->width += width;
+    return true;
+  }
+
+  void GlyphAtlas::AddPage()
+  {
+    IK_PROFILE();
+    Texture2DSpecification spec;
+    spec.title = m_name + " Glyph Atlas " + std::to_string(m_pages.size());
+    spec.width = PageSize;
+    spec.height = PageSize;
+    spec.internalFormat = TextureFormat::RED;
+    spec.dataFormat = TextureFormat::RED;
+    spec.Xwrap = TextureWrap::ClampEdge;
+    spec.Ywrap = TextureWrap::ClampEdge;
+    spec.Zwrap = TextureWrap::ClampEdge;
+
+    Page& page = m_pages.emplace_back();
+    page.texture = TextureFactory::Create(spec);
+
+    // Texture is created without data, so it is cleared to keep padding between glyphs empty
+    std::vector<uint8_t> emptyData(PageSize * PageSize, 0);
+    page.texture->SetData(emptyData.data(), 0, 0, PageSize, PageSize);
+
+    IK_LOG_TRACE(LogModule::Font, "Added page {0} in glyph atlas of '{1}'", m_pages.size() - 1, m_name);
+  }
+
+  const Ref<Texture>& GlyphAtlas::GetPage(uint32_t page) const
+  {
+    IK_ASSERT(page < m_pages.size(), "Invalid atlas page!");
+    return m_pages[page].texture;
+  }
+
+  uint32_t GlyphAtlas::GetPageCount() const
+  {
+    return static_cast<uint32_t>(m_pages.size());
+  }
+} // namespace IKan
@@ -55,7 +55,8 @@ case Utils::Math::Axis::Y: param.y = value; break; \
 case Utils::Math::Axis::Z: param.z = value; break; \
 default: IK_ASSERT(false) \
 } \
-transform = Utils::Math::GetTransformMatrix(position, rotation, scale);
+isMatrixDirty = true; \
+version++;
   
 #define ADD_TRANSFORM(param) \
 switch (axis) { \
@@ -64,7 +65,8 @@ case Utils::Math::Axis::Y: param.y += value; break; \
 case Utils::Math::Axis::Z: param.z += value; break; \
 default: IK_ASSERT(false) \
 } \
-transform = Utils::Math::GetTransformMatrix(position, rotation, scale);
+isMatrixDirty = true; \
+version++;
   
   TransformComponent::TransformComponent()
   {
@@ -74,6 +76,7 @@ transform = Utils::Math::GetTransformMatrix(position, rotation, scale);
   
   const glm::mat4& TransformComponent::Transform() const
   {
+    UpdateMatrix();
     return transform;
   }
   const glm::vec3& TransformComponent::Position() const
@@ -90,13 +93,21 @@ transform = Utils::Math::GetTransformMatrix(position, rotation, scale);
   }
   const glm::quat& TransformComponent::Quaternion() const
   {
+    UpdateMatrix();
     return quaternion;
   }
+  uint32_t TransformComponent::Version() const
+  {
+    return version;
+  }
   
   void TransformComponent::UpdateTransform(const glm::mat4& transform)
   {
     this->transform = transform;
     Utils::Math::DecomposeTransform(this->transform, position, rotation, scale);
+    quaternion = glm::quat(rotation);
+    isMatrixDirty = false;
+    version++;
   }
   
   void TransformComponent::UpdatePosition(Utils::Math::Axis axis, float value)
@@ -115,33 +126,39 @@ transform = Utils::Math::GetTransformMatrix(position, rotation, scale);
   void TransformComponent::UpdatePosition(const glm::vec3& value)
   {
     position = value;
-    transform = Utils::Math::GetTransformMatrix(position, rotation, scale);
+    isMatrixDirty = true;
+    version++;
   }
   void TransformComponent::UpdateRotation(const glm::vec3& value)
   {
     rotation = value;
-    transform = Utils::Math::GetTransformMatrix(position, rotation, scale);
+    isMatrixDirty = true;
+    version++;
   }
   void TransformComponent::UpdateScale(const glm::vec3& value)
   {
     scale = value;
-    transform = Utils::Math::GetTransformMatrix(position, rotation, scale);
+    isMatrixDirty = true;
+    version++;
   }
   
   void TransformComponent::AddPosition(const glm::vec3& value)
   {
     position += value;
-    transform = Utils::Math::GetTransformMatrix(position, rotation, scale);
+    isMatrixDirty = true;
+    version++;
   }
   void TransformComponent::AddRotation(const glm::vec3& value)
   {
     rotation += value;
-    transform = Utils::Math::GetTransformMatrix(position, rotation, scale);
+    isMatrixDirty = true;
+    version++;
   }
   void TransformComponent::AddScale(const glm::vec3& value)
   {
     scale += value;
-    transform = Utils::Math::GetTransformMatrix(position, rotation, scale);
+    isMatrixDirty = true;
+    version++;
   }
   
   void TransformComponent::AddPosition(Utils::Math::Axis axis, float value)
@@ -157,6 +174,16 @@ transform = Utils::Math::GetTransformMatrix(position, rotation, scale);
     ADD_TRANSFORM(scale)
   }
   
+  void TransformComponent::UpdateMatrix() const
+  {
+    if (isMatrixDirty)
+    {
+      transform = Utils::Math::GetTransformMatrix(position, rotation, scale);
+      quaternion = glm::quat(rotation);
+      isMatrixDirty = false;
+    }
+  }
+  
   // Camera Component -------------------------------------------------------------------------------------
   CameraComponent::operator SceneCamera& ()
   {
@@ -70,6 +70,7 @@ namespace IKan
   void Entity::SetParentUUID(UUID parent)
   {
     GetComponent<RelationshipComponent>().parentHandle = parent;
+    m_scene->m_transformSystem.Invalidate();
   }
   
   bool Entity::IsAncesterOf(Entity entity)
@@ -132,6 +133,10 @@ namespace IKan
   {
     return m_scene->m_registry.get<TransformComponent>(m_entityHandle).Transform();
   }
+  const glm::mat4& Entity::GetWorldTransform() const
+  {
+    return m_scene->m_registry.get<WorldTransformComponent>(m_entityHandle).transform;
+  }
   
   std::string& Entity::GetName()
   {
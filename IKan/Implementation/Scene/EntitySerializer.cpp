@@ -10,6 +10,7 @@
 #include "Scene/Entity.hpp"
 #include "Scene/Component.hpp"
 #include "Assets/AssetManager.hpp"
+#include "Core/JobSystem.hpp"
 
 namespace IKan
 {
@@ -127,137 +128,215 @@ namespace IKan
     out << YAML::EndMap; // Entity
   }
   
-  void EntitySerializer::DeserializeEntities(Ref<Scene> scene, YAML::Node& entitiesNode)
+  namespace EntitySerializerUtils
   {
-    IK_PROFILE();
-    for (auto entity : entitiesNode)
+    /// Number of entities converted by each job
+    static constexpr uint32_t DeserializeJobSize = 256;
+    
+    /// This structure stores the mesh component data until materials are loaded on main thread
+    struct MeshData
     {
-      uint64_t uuid = entity["Entity"].as<uint64_t>();
-      
-      std::string name;
+      uint32_t row {0};
+      bool enable {true};
+      AssetHandle mesh {0};
+      float tilingFactor {1.0f};
+      std::vector<std::pair<uint32_t, AssetHandle>> materials;
+    };
+    
+    /// This structure stores the components converted by one job. Entities are stored by row, optional components
+    /// store the row of their entity
+    struct StagingData
+    {
+      std::vector<std::pair<uint32_t, CameraComponent>> cameras;
+      std::vector<MeshData> meshes;
+    };
+    
+    /// This function converts the transform node. Missing values are kept as default
+    /// - Parameters:
+    ///   - transformNode: transform component node
+    ///   - transform: transform component
+    static void ReadTransform(const YAML::Node& transformNode, TransformComponent& transform)
+    {
+      transform.UpdatePosition(transformNode["Position"].as<glm::vec3>(transform.Position()));
       
-      // TagComponent ------------------------------------------------------------------------------------------------
-      auto tagComponent = entity["TagComponent"];
-      if (tagComponent)
+      // Rotations used to be stored as quaternions
+      if (const YAML::Node rotationNode = transformNode["Rotation"]; rotationNode and rotationNode.size() == 4)
       {
-        name = tagComponent["Tag"].as<std::string>();
+        transform.UpdateRotation(glm::eulerAngles(rotationNode.as<glm::quat>(glm::quat())));
       }
-      
-      Entity deserializedEntity = scene->CreateEntityWithID(uuid, name);
-      
-      // VisibilityComponent ---------------------------------------------------------------------------------------
-      auto visibilityComponent = entity["VisibilityComponent"];
-      if (visibilityComponent)
+      else if (rotationNode)
       {
-        auto& vc = deserializedEntity.GetComponent<VisibilityComponent>();
-        vc.isVisible = visibilityComponent["Visibility"].as<bool>();
+        IK_ASSERT(rotationNode.size() == 3);
+        transform.UpdateRotation(rotationNode.as<glm::vec3>(transform.Rotation()));
       }
+      transform.UpdateScale(transformNode["Scale"].as<glm::vec3>(transform.Scale()));
+    }
+    
+    /// This function converts the camera component node. Missing values are kept as default
+    /// - Parameters:
+    ///   - cameraComponentNode: camera component node
+    ///   - component: camera component
+    static void ReadCamera(const YAML::Node& cameraComponentNode, CameraComponent& component)
+    {
+      component.enable = cameraComponentNode["Enable"].as<bool>(component.enable);
+      component.primary = cameraComponentNode["Primary"].as<bool>(component.primary);
       
-      // RelationshipComponent ---------------------------------------------------------------------------------------
-      auto& relationshipComponent = deserializedEntity.GetComponent<RelationshipComponent>();
-      uint64_t parentHandle = entity["Parent"] ? entity["Parent"].as<uint64_t>() : 0;
-      relationshipComponent.parentHandle = parentHandle;
-      
-      auto children = entity["Children"];
-      if (children)
+      const YAML::Node cameraNode = cameraComponentNode["Camera"];
+      if (!cameraNode or !cameraNode.IsMap())
       {
-        for (auto child : children)
-        {
-          uint64_t childHandle = child["Handle"].as<uint64_t>();
-          relationshipComponent.children.push_back(childHandle);
-        }
+        return;
       }
       
-      // TransformComponent ------------------------------------------------------------------------------------------
-      auto transformComponent = entity["TransformComponent"];
-      if (transformComponent)
+      auto& camera = component.camera;
+      camera.SetProjectionType((SceneCamera::ProjectionType)cameraNode["ProjectionType"].as<int>((int)camera.GetProjectionType()));
+      camera.SetDegPerspectiveVerticalFOV(cameraNode["PerspectiveFOV"].as<float>(camera.GetDegPerspectiveVerticalFOV()));
+      camera.SetPerspectiveNearClip(cameraNode["PerspectiveNear"].as<float>(camera.GetPerspectiveNearClip()));
+      camera.SetPerspectiveFarClip(cameraNode["PerspectiveFar"].as<float>(camera.GetPerspectiveFarClip()));
+      camera.SetOrthographicSize(cameraNode["OrthographicSize"].as<float>(camera.GetOrthographicSize()));
+      camera.SetOrthographicNearClip(cameraNode["OrthographicNear"].as<float>(camera.GetOrthographicNearClip()));
+      camera.SetOrthographicFarClip(cameraNode["OrthographicFar"].as<float>(camera.GetOrthographicFarClip()));
+    }
+  } // namespace EntitySerializerUtils
+  
+  void EntitySerializer::DeserializeEntities(Ref<Scene> scene, YAML::Node& entitiesNode)
+  {
+    IK_PROFILE();
+    using namespace EntitySerializerUtils;
+    
+    // 1. Collect the entity nodes, so that jobs can access them by row
+    std::vector<YAML::Node> entityNodes;
+    entityNodes.reserve(entitiesNode.size());
+    for (auto entityNode : entitiesNode)
+    {
+      entityNodes.push_back(entityNode);
+    }
+    const uint32_t entityCount = static_cast<uint32_t>(entityNodes.size());
+    
+    entt::registry& registry = scene->m_registry;
+    IK_ASSERT(registry.size() + entityCount <= scene->m_registryCapacity, "Entity registry reach max limit !!!")
+    
+    // 2. Convert the nodes to components on worker threads. Each job writes only its own rows and staging data
+    // Note: Only const node access is used here, which does not modify the shared yaml memory. Missing or invalid values
+    //       are kept as default as exceptions can not leave the worker thread
+    std::vector<IDComponent> ids(entityCount);
+    std::vector<TagComponent> tags(entityCount);
+    std::vector<VisibilityComponent> visibilities(entityCount);
+    std::vector<RelationshipComponent> relationships(entityCount);
+    std::vector<TransformComponent> transforms(entityCount);
+    
+    const uint32_t jobCount = (entityCount + DeserializeJobSize - 1) / DeserializeJobSize;
+    std::vector<StagingData> stagingData(jobCount);
+    
+    JobSystem::ParallelFor(jobCount, [&](uint32_t jobIdx) {
+      StagingData& staging = stagingData[jobIdx];
+      const uint32_t endRow = std::min(entityCount, (jobIdx + 1) * DeserializeJobSize);
+      for (uint32_t row = jobIdx * DeserializeJobSize; row < endRow; row++)
       {
-        // Entities always have transforms
-        auto& transform = deserializedEntity.GetTransform();
-        transform.UpdatePosition(transformComponent["Position"].as<glm::vec3>());
-        const auto& rotationNode = transformComponent["Rotation"];
-        // Rotations used to be stored as quaternions
-        if (rotationNode.size() == 4)
+        const YAML::Node& entityNode = entityNodes[row];
+        ids[row].ID = entityNode["Entity"].as<uint64_t>(0);
+        
+        // TagComponent ------------------------------------------------------------------------------------------------
+        if (const YAML::Node tagNode = entityNode["TagComponent"]; tagNode)
         {
-          glm::quat rotation = transformComponent["Rotation"].as<glm::quat>();
-          transform.UpdateRotation(glm::eulerAngles(rotation));
+          tags[row].tag = tagNode["Tag"].as<std::string>("");
         }
-        else
+        
+        // VisibilityComponent -----------------------------------------------------------------------------------------
+        if (const YAML::Node visibilityNode = entityNode["VisibilityComponent"]; visibilityNode)
         {
-          IK_ASSERT(rotationNode.size() == 3);
-          transform.UpdateRotation(transformComponent["Rotation"].as<glm::vec3>());
+          visibilities[row].isVisible = visibilityNode["Visibility"].as<bool>(true);
         }
-        transform.UpdateScale(transformComponent["Scale"].as<glm::vec3>());
-      }
-      
-      // CameraComponent --------------------------------------------------------------------------------------------
-      auto cameraComponent = entity["CameraComponent"];
-      if (cameraComponent)
-      {
-        auto& component = deserializedEntity.AddComponent<CameraComponent>();
-        component.enable = cameraComponent["Enable"].as<bool>();
-        const auto& cameraNode = cameraComponent["Camera"];
         
-        auto& camera = component.camera;
-        
-        if (cameraNode.IsMap())
+        // RelationshipComponent ---------------------------------------------------------------------------------------
+        relationships[row].parentHandle = entityNode["Parent"].as<uint64_t>(0);
+        if (const YAML::Node childrenNode = entityNode["Children"]; childrenNode)
         {
-          if (cameraNode["ProjectionType"])
-          {
-            camera.SetProjectionType((SceneCamera::ProjectionType)cameraNode["ProjectionType"].as<int>());
-          }
-          if (cameraNode["PerspectiveFOV"])
-          {
-            camera.SetDegPerspectiveVerticalFOV(cameraNode["PerspectiveFOV"].as<float>());
-          }
-          if (cameraNode["PerspectiveNear"])
-          {
-            camera.SetPerspectiveNearClip(cameraNode["PerspectiveNear"].as<float>());
-          }
-          if (cameraNode["PerspectiveFar"])
-          {
-            camera.SetPerspectiveFarClip(cameraNode["PerspectiveFar"].as<float>());
-          }
-          if (cameraNode["OrthographicSize"])
-          {
-            camera.SetOrthographicSize(cameraNode["OrthographicSize"].as<float>());
-          }
-          if (cameraNode["OrthographicNear"])
+          relationships[row].children.reserve(childrenNode.size());
+          for (const auto& childNode : childrenNode)
           {
-            camera.SetOrthographicNearClip(cameraNode["OrthographicNear"].as<float>());
+            relationships[row].children.push_back(childNode["Handle"].as<uint64_t>(0));
           }
-          if (cameraNode["OrthographicFar"])
+        }
+        
+        // TransformComponent ------------------------------------------------------------------------------------------
+        if (const YAML::Node transformNode = entityNode["TransformComponent"]; transformNode)
+        {
+          ReadTransform(transformNode, transforms[row]);
+        }
+        
+        // CameraComponent ---------------------------------------------------------------------------------------------
+        if (const YAML::Node cameraNode = entityNode["CameraComponent"]; cameraNode)
+        {
+          auto& [cameraRow, component] = staging.cameras.emplace_back();
+          cameraRow = row;
+          ReadCamera(cameraNode, component);
+        }
+        
+        // MeshComponent -----------------------------------------------------------------------------------------------
+        if (const YAML::Node meshNode = entityNode["MeshComponent"]; meshNode)
+        {
+          MeshData& meshData = staging.meshes.emplace_back();
+          meshData.row = row;
+          meshData.enable = meshNode["Enable"].as<bool>(true);
+          meshData.mesh = meshNode["MeshHandle"].as<AssetHandle>(AssetHandle(0));
+          meshData.tilingFactor = meshNode["TilingFactor"].as<float>(1.0f);
+          
+          if (const YAML::Node materialTableNode = meshNode["MaterialTable"]; materialTableNode)
           {
-            camera.SetOrthographicFarClip(cameraNode["OrthographicFar"].as<float>());
+            for (const auto& materialEntry : materialTableNode)
+            {
+              meshData.materials.emplace_back(materialEntry.first.as<uint32_t>(0), materialEntry.second.as<AssetHandle>(AssetHandle(0)));
+            }
           }
         }
-        component.primary = cameraComponent["Primary"].as<bool>();
+      } // For each row of job
+    });
+    
+    // 3. Create the entities and components on calling thread. Entities are created in row order, so component pools
+    // are already ordered by entity handle and do not need sorting
+    std::vector<entt::entity> entities(entityCount);
+    registry.create(entities.begin(), entities.end());
+    
+    scene->m_entityIDMap.reserve(scene->m_entityIDMap.size() + entityCount);
+    for (uint32_t row = 0; row < entityCount; row++)
+    {
+      scene->m_entityIDMap[ids[row].ID] = Entity(entities[row], scene.get());
+    }
+    if (entityCount > 0)
+    {
+      scene->m_maxEntityID = (int32_t)((uint32_t)entities.back());
+    }
+    scene->m_numEntities += entityCount;
+    
+    registry.insert<IDComponent>(entities.begin(), entities.end(), ids.begin(), ids.end());
+    registry.insert<VisibilityComponent>(entities.begin(), entities.end(), visibilities.begin(), visibilities.end());
+    registry.insert<TransformComponent>(entities.begin(), entities.end(), transforms.begin(), transforms.end());
+    registry.insert<WorldTransformComponent>(entities.begin(), entities.end());
+    registry.insert<TagComponent>(entities.begin(), entities.end(), tags.begin(), tags.end());
+    registry.insert<RelationshipComponent>(entities.begin(), entities.end(), relationships.begin(), relationships.end());
+    
+    // Optional components are added in row order of all jobs
+    for (StagingData& staging : stagingData)
+    {
+      for (auto& [row, component] : staging.cameras)
+      {
+        registry.emplace<CameraComponent>(entities[row], std::move(component));
       }
       
-      // MeshComponent ----------------------------------------------------------------------------------------------
-      auto meshComponent = entity["MeshComponent"];
-      if (meshComponent)
+      // Materials are loaded by asset manager, which is not thread safe
+      for (MeshData& meshData : staging.meshes)
       {
-        auto& component = deserializedEntity.AddComponent<MeshComponent>();
-        component.enable = meshComponent["Enable"].as<bool>();
-        component.mesh = meshComponent["MeshHandle"].as<AssetHandle>();
-        component.tilingFactor = meshComponent["TilingFactor"].as<float>();
-        
-        if (meshComponent["MaterialTable"])
+        auto& component = registry.emplace<MeshComponent>(entities[meshData.row], meshData.mesh);
+        component.enable = meshData.enable;
+        component.tilingFactor = meshData.tilingFactor;
+        for (const auto& [index, materialAsset] : meshData.materials)
         {
-          YAML::Node materialTableNode = meshComponent["MaterialTable"];
-          for (auto materialEntry : materialTableNode)
+          if (materialAsset && AssetManager::IsAssetHandleValid(materialAsset))
           {
-            uint32_t index = materialEntry.first.as<uint32_t>();
-            AssetHandle materialAsset = materialEntry.second.as<AssetHandle>();
-            if (materialAsset && AssetManager::IsAssetHandleValid(materialAsset))
-            {
-              component.materialTable->SetMaterial(index, AssetManager::GetAsset<MaterialAsset>(materialAsset));
-            }
+            component.materialTable->SetMaterial(index, AssetManager::GetAsset<MaterialAsset>(materialAsset));
           }
         }
       }
-      
-    } // For each entity
+    }
   }
 } // namespace IKan
@@ -41,17 +41,16 @@ namespace IKan
     }
   }
   
-  template<typename T>
-  static void CopyComponent(entt::registry& dstRegistry, entt::registry& srcRegistry, const std::unordered_map<UUID, entt::entity>& enttMap)
+  /// This function copies the component pools in storage order. Destination pools should be empty
+  template<typename... Component>
+  static void CopyComponentPools(ComponentGroup<Component...>, entt::registry& dstRegistry, const entt::registry& srcRegistry)
   {
-    auto srcEntities = srcRegistry.view<T>();
-    for (auto srcEntity : srcEntities)
-    {
-      entt::entity destEntity = enttMap.at(srcRegistry.get<IDComponent>(srcEntity).ID);
-      
-      auto& srcComponent = srcRegistry.get<T>(srcEntity);
-      [[maybe_unused]] auto& destComponent = dstRegistry.emplace_or_replace<T>(destEntity, srcComponent);
-    }
+    ([&]() {
+      const entt::entity* entities = srcRegistry.data<Component>();
+      const Component* components = srcRegistry.raw<Component>();
+      const size_t size = srcRegistry.size<Component>();
+      dstRegistry.insert<Component>(entities, entities + size, components, components + size);
+    }(), ...);
   }
 
   static std::string_view SceneTypeString(SceneType sceneType)
@@ -102,10 +101,12 @@ namespace IKan
   void Scene::OnUpdateEditor()
   {
     IK_PERFORMANCE("Scene::OnUpdateEditor");
+    UpdateWorldTransforms();
   }
   void Scene::OnUpdateRuntime(TimeStep ts)
   {
     IK_PERFORMANCE("Scene::OnUpdateRuntime");
+    UpdateWorldTransforms();
   }
   
   void Scene::OnRuntimeEventHandler(Event& event)
@@ -137,10 +138,10 @@ namespace IKan
     }
     
     const auto& mainCamera = cameraEntity.GetComponent<CameraComponent>().camera;
-    const auto& cameraTransformComp = cameraEntity.GetComponent<TransformComponent>();
+    const glm::mat4& cameraTransform = cameraEntity.GetWorldTransform();
     
     // Render 3D Scene
-    renderer.BeginScene({ mainCamera, cameraTransformComp.Position(), glm::inverse(cameraTransformComp.Transform()), 0.01f, 10000.0f, mainCamera.GetRadPerspectiveVerticalFOV() });
+    renderer.BeginScene({ mainCamera, glm::vec3(cameraTransform[3]), glm::inverse(cameraTransform), 0.01f, 10000.0f, mainCamera.GetRadPerspectiveVerticalFOV() });
     RenderScene(renderer, false);
     renderer.EndScene();
   }
@@ -158,11 +159,11 @@ namespace IKan
     IK_PERFORMANCE("Scene::RenderScene");
     
     // Submit the Meshes --------------------------------------------------
-    auto meshView = m_registry.view<TransformComponent, MeshComponent>();
+    auto meshView = m_registry.view<WorldTransformComponent, MeshComponent>();
     for (const auto& entityHandle : meshView)
     {
       Entity entity{entityHandle, this};
-      const auto& transformComp = entity.GetComponent<TransformComponent>();
+      const auto& transformComp = entity.GetComponent<WorldTransformComponent>();
       const auto& meshComp = entity.GetComponent<MeshComponent>();
       const auto& visibilityComp = entity.GetComponent<VisibilityComponent>();
       if (meshComp.mesh != 0 and meshComp.enable and (visibilityComp.isVisible or (!visibilityComp.isVisible and !isEditing)))
@@ -170,7 +171,7 @@ namespace IKan
         // Render Selected Mesh ---------------------------------------------
         Entity entity = {entityHandle, this};
         
-        renderer.SubmitMesh(meshComp.mesh, transformComp.Transform(), meshComp.materialTable, meshComp.tilingFactor);
+        renderer.SubmitMesh(meshComp.mesh, transformComp.transform, meshComp.materialTable, meshComp.tilingFactor);
       }
     } // For each Mesh Entity
   }
@@ -199,35 +200,35 @@ namespace IKan
   void Scene::CopyTo(Ref<Scene> &target)
   {
     IK_PROFILE();
-    std::unordered_map<UUID, entt::entity> enttMap;
-    auto idComponents = m_registry.view<IDComponent>();
-    for (auto entity : idComponents)
+    IK_ASSERT(target->m_registry.alive() == 0, "Scene can be copied to empty scene only");
+    IK_ASSERT(m_registry.size() <= target->m_registryCapacity, "Entity registry reach max limit !!!")
+    Timer timer;
+    
+    // Snapshot of registry. Entity identifiers (including destroyed ones) are preserved and component pools are copied
+    // in storage order, so that target iterates the entities in same order as this scene without sorting
+    target->m_registry.assign(m_registry.data(), m_registry.data() + m_registry.size());
+    CopyComponentPools(AllComponents{}, target->m_registry, m_registry);
+    
+    // Entity handles are same, only scene of entity is updated
+    target->m_entityIDMap = m_entityIDMap;
+    for (auto& [uuid, entity] : target->m_entityIDMap)
     {
-      auto uuid = m_registry.get<IDComponent>(entity).ID;
-      auto name = m_registry.get<TagComponent>(entity).tag;
-      Entity e = target->CreateEntityWithID(uuid, name);
-      enttMap[uuid] = e.m_entityHandle;
+      entity.m_scene = target.get();
     }
-    
-    CopyComponent<VisibilityComponent>(target->m_registry, m_registry, enttMap);
-    CopyComponent<TagComponent>(target->m_registry, m_registry, enttMap);
-    CopyComponent<RelationshipComponent>(target->m_registry, m_registry, enttMap);
-    CopyComponent<TransformComponent>(target->m_registry, m_registry, enttMap);
-    CopyComponent<CameraComponent>(target->m_registry, m_registry, enttMap);
-    CopyComponent<MeshComponent>(target->m_registry, m_registry, enttMap);
-
-    // Sort IdComponent by by entity handle (which is essentially the order in which they were created)
-    // This ensures a consistent ordering when iterating IdComponent (for example: when rendering scene hierarchy panel)
-    target->m_registry.sort<IDComponent>([&target](const auto lhs, const auto rhs)
-                                         {
-      auto lhsEntity = target->m_entityIDMap.find(lhs.ID);
-      auto rhsEntity = target->m_entityIDMap.find(rhs.ID);
-      return static_cast<uint32_t>(lhsEntity->second) < static_cast<uint32_t>(rhsEntity->second);
-    });
+    target->m_numEntities = m_numEntities;
+    target->m_maxEntityID = m_maxEntityID;
     
     target->m_viewportWidth = m_viewportWidth;
     target->m_viewportHeight = m_viewportHeight;
     target->m_name = m_name;
+    
+    IK_LOG_INFO(LogModule::Scene, "Copied scene '{0}' ({1} entities) in {2:.2f} ms", m_name, m_numEntities,
+                timer.ElapsedMiliSeconds());
+  }
+  
+  void Scene::UpdateWorldTransforms()
+  {
+    m_transformSystem.Update(*this);
   }
   
   void Scene::SetViewportSize(uint32_t width, uint32_t height)
@@ -284,6 +285,7 @@ namespace IKan
     entity.AddComponent<IDComponent>(uuid);
     entity.AddComponent<VisibilityComponent>();
     entity.AddComponent<TransformComponent>(); // By default Unit transform
+    entity.AddComponent<WorldTransformComponent>();
     entity.AddComponent<TagComponent>(name);
     entity.AddComponent<RelationshipComponent>(); // By default No parent and No child
     
@@ -293,6 +295,7 @@ namespace IKan
     // Updating the Max entity ID
     m_maxEntityID = (int32_t)((uint32_t)entity);
     ++m_numEntities;
+    m_transformSystem.Invalidate();
     
     return entity;
   }
@@ -330,6 +333,7 @@ namespace IKan
     m_registry.destroy(entity.m_entityHandle);
     
     --m_numEntities;
+    m_transformSystem.Invalidate();
   }
   
   Entity Scene::DuplicateEntity(Entity entity)
@@ -0,0 +1,242 @@
+//
+//  SceneBVH.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "SceneBVH.hpp"
+
+#include "Scene/Component.hpp"
+#include "Assets/AssetManager.hpp"
+
+namespace IKan
+{
+  namespace SceneBVHUtils
+  {
+    /// This function returns the union of AABBs
+    /// - Parameters:
+    ///   - a: first AABB
+    ///   - b: second AABB
+    static AABB Union(const AABB& a, const AABB& b)
+    {
+      return AABB(glm::min(a.min, b.min), glm::max(a.max, b.max));
+    }
+    
+    /// This function returns the world AABB of mesh. Returns the inverted AABB that is never hit if mesh is not loaded
+    /// - Parameters:
+    ///   - meshHandle: mesh asset handle
+    ///   - transform: world transform of entity
+    static AABB GetWorldAABB(AssetHandle meshHandle, const glm::mat4& transform)
+    {
+      const Ref<Mesh> mesh = AssetManager::GetAsset<Mesh>(meshHandle);
+      if (!mesh or mesh->IsFlagSet(AssetFlag::Missing))
+      {
+        return AABB(glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX));
+      }
+      return mesh->GetBoundingBox().Transformed(transform);
+    }
+    
+    /// This function returns true if AABB is not inverted
+    /// - Parameter aabb: AABB
+    static bool IsValid(const AABB& aabb)
+    {
+      return aabb.min.x <= aabb.max.x;
+    }
+    
+    /// This function returns true if mesh is available without loading it. Leaves of meshes missing at build are
+    /// refreshed once their mesh is available
+    /// - Parameter meshHandle: mesh asset handle
+    static bool IsMeshAvailable(AssetHandle meshHandle)
+    {
+      if (!AssetManager::IsLoadedAsset(meshHandle) and !AssetManager::IsMemoryAsset(meshHandle))
+      {
+        return false;
+      }
+      const Ref<Mesh> mesh = AssetManager::GetAsset<Mesh>(meshHandle);
+      return mesh and !mesh->IsFlagSet(AssetFlag::Missing);
+    }
+  } // namespace SceneBVHUtils
+  
+  void SceneBVH::Update(const Ref<Scene>& scene)
+  {
+    IK_PERFORMANCE("SceneBVH::Update");
+    if (!scene)
+    {
+      Clear();
+      return;
+    }
+    
+    // Rebuild for new scene
+    bool rebuild = m_scene.expired() or m_scene.lock() != scene;
+    
+    // Find the entities with changed transform or mesh. Rebuild if any entity is added or removed
+    std::vector<entt::entity> changedEntities;
+    uint32_t meshEntityCount = 0;
+    auto meshView = scene->GetAllEntitiesWith<WorldTransformComponent, MeshComponent>();
+    for (auto entity : meshView)
+    {
+      if (rebuild)
+      {
+        break;
+      }
+      
+      const auto& [transformComp, meshComp] = meshView.get<WorldTransformComponent, MeshComponent>(entity);
+      if (meshComp.mesh == 0)
+      {
+        continue;
+      }
+      
+      meshEntityCount++;
+      auto leafIt = m_leaves.find(entity);
+      if (leafIt == m_leaves.end())
+      {
+        rebuild = true;
+      }
+      else if (leafIt->second.transformVersion != transformComp.version or leafIt->second.mesh != meshComp.mesh or
+               (!SceneBVHUtils::IsValid(m_nodes[leafIt->second.node].bounds) and SceneBVHUtils::IsMeshAvailable(meshComp.mesh)))
+      {
+        changedEntities.push_back(entity);
+      }
+    }
+    rebuild = rebuild or meshEntityCount != m_leaves.size();
+    
+    // Refitted tree gets loose, so it is rebuilt once number of refits are more than leaves
+    m_refitsSinceBuild += static_cast<uint32_t>(changedEntities.size());
+    if (rebuild or m_refitsSinceBuild > m_leaves.size())
+    {
+      m_scene = scene;
+      Build(*scene);
+      return;
+    }
+    
+    for (entt::entity entity : changedEntities)
+    {
+      const auto& [transformComp, meshComp] = meshView.get<WorldTransformComponent, MeshComponent>(entity);
+      Leaf& leaf = m_leaves.at(entity);
+      leaf.transformVersion = transformComp.version;
+      leaf.mesh = meshComp.mesh;
+      m_nodes[leaf.node].bounds = SceneBVHUtils::GetWorldAABB(meshComp.mesh, transformComp.transform);
+      RefitAncestors(leaf.node);
+    }
+  }
+  
+  void SceneBVH::Build(Scene& scene)
+  {
+    IK_PERFORMANCE("SceneBVH::Build");
+    Clear();
+    
+    std::vector<BuildItem> items;
+    auto meshView = scene.GetAllEntitiesWith<WorldTransformComponent, MeshComponent>();
+    for (auto entity : meshView)
+    {
+      const auto& [transformComp, meshComp] = meshView.get<WorldTransformComponent, MeshComponent>(entity);
+      if (meshComp.mesh == 0)
+      {
+        continue;
+      }
+      
+      const AABB bounds = SceneBVHUtils::GetWorldAABB(meshComp.mesh, transformComp.transform);
+      items.push_back({entity, bounds, (bounds.min + bounds.max) * 0.5f, {-1, transformComp.version, meshComp.mesh}});
+    }
+    
+    if (items.empty())
+    {
+      return;
+    }
+    
+    m_nodes.reserve(items.size() * 2);
+    m_root = BuildRecursive(items, 0, static_cast<uint32_t>(items.size()), -1);
+  }
+  
+  int32_t SceneBVH::BuildRecursive(std::vector<BuildItem>& items, uint32_t begin, uint32_t end, int32_t parent)
+  {
+    const int32_t nodeIndex = static_cast<int32_t>(m_nodes.size());
+    m_nodes.push_back({});
+    m_nodes[nodeIndex].parent = parent;
+    
+    // Leaf
+    if (end - begin == 1)
+    {
+      BuildItem& item = items[begin];
+      m_nodes[nodeIndex].bounds = item.bounds;
+      m_nodes[nodeIndex].entity = item.entity;
+      item.leaf.node = nodeIndex;
+      m_leaves[item.entity] = item.leaf;
+      return nodeIndex;
+    }
+    
+    // Split at median of centroids along the largest axis
+    AABB centroidBounds(glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX));
+    for (uint32_t itemIdx = begin; itemIdx < end; itemIdx++)
+    {
+      centroidBounds.min = glm::min(centroidBounds.min, items[itemIdx].centroid);
+      centroidBounds.max = glm::max(centroidBounds.max, items[itemIdx].centroid);
+    }
+    const glm::vec3 extent = centroidBounds.max - centroidBounds.min;
+    const int32_t axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+    
+    const uint32_t mid = begin + (end - begin) / 2;
+    std::nth_element(items.begin() + begin, items.begin() + mid, items.begin() + end, [axis](const BuildItem& a, const BuildItem& b) {
+      return a.centroid[axis] < b.centroid[axis];
+    });
+    
+    // Note: Node reference is not kept as nodes vector is appended
+    const int32_t left = BuildRecursive(items, begin, mid, nodeIndex);
+    const int32_t right = BuildRecursive(items, mid, end, nodeIndex);
+    m_nodes[nodeIndex].left = left;
+    m_nodes[nodeIndex].right = right;
+    m_nodes[nodeIndex].bounds = SceneBVHUtils::Union(m_nodes[left].bounds, m_nodes[right].bounds);
+    return nodeIndex;
+  }
+  
+  void SceneBVH::RefitAncestors(int32_t nodeIndex)
+  {
+    for (int32_t parent = m_nodes[nodeIndex].parent; parent != -1; parent = m_nodes[parent].parent)
+    {
+      Node& node = m_nodes[parent];
+      node.bounds = SceneBVHUtils::Union(m_nodes[node.left].bounds, m_nodes[node.right].bounds);
+    }
+  }
+  
+  void SceneBVH::Query(const Ray& ray, std::vector<entt::entity>& entities) const
+  {
+    IK_PERFORMANCE("SceneBVH::Query");
+    entities.clear();
+    if (m_root == -1)
+    {
+      return;
+    }
+    
+    std::vector<int32_t> stack {m_root};
+    while (!stack.empty())
+    {
+      const Node& node = m_nodes[stack.back()];
+      stack.pop_back();
+      
+      float distance;
+      if (!ray.IntersectsAABB(node.bounds, distance))
+      {
+        continue;
+      }
+      
+      if (node.entity != entt::null)
+      {
+        entities.push_back(node.entity);
+      }
+      else
+      {
+        stack.push_back(node.left);
+        stack.push_back(node.right);
+      }
+    }
+  }
+  
+  void SceneBVH::Clear()
+  {
+    m_nodes.clear();
+    m_leaves.clear();
+    m_root = -1;
+    m_refitsSinceBuild = 0;
+  }
+} // namespace IKan
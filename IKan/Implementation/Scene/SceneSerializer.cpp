@@ -5,6 +5,7 @@
 //  Created by Ashish . on 29/07/24.
 //
 
+#include <unordered_set>
 #include <yaml-cpp/yaml.h>
 
 #include "SceneSerializer.hpp"
@@ -13,15 +14,333 @@
 #include "Scene/Scene.hpp"
 #include "Scene/Entity.hpp"
 #include "Scene/EntitySerializer.hpp"
+#include "Assets/AssetManager.hpp"
+#include "Project/Project.hpp"
 
 namespace IKan
 {
+  namespace SceneSerializerUtils
+  {
+    static constexpr uint32_t s_binarySceneMagic = 0x43534B49; // 'IKSC'
+    static constexpr uint32_t s_binarySceneVersion = 2; // Version 1 has world space transforms
+    
+    /// This enum stores the component column types of binary scene
+    enum class SceneColumn : uint32_t
+    {
+      ID, Tag, Visibility, Relationship, Transform, Camera, Mesh
+    };
+    
+    /// This structure stores the header of binary scene file
+    /// |< Header >|< Scene name >|< Column Header | Column data >|< Column Header | Column data >| ...
+    struct BinarySceneHeader
+    {
+      uint32_t magic {s_binarySceneMagic};
+      uint32_t version {s_binarySceneVersion};
+      uint32_t entityCount {0};
+      uint32_t columnCount {0};
+      uint32_t nameSize {0};
+      uint32_t reserved {0};
+    };
+    
+    /// This structure stores the header of each component column. Columns with unknown type are skipped
+    struct BinarySceneColumn
+    {
+      SceneColumn type {SceneColumn::ID};
+      uint32_t rowCount {0};
+      uint64_t size {0};
+    };
+    
+    /// This structure stores the packed camera component
+    struct CameraRecord
+    {
+      uint8_t enable {0}, primary {0}, projectionType {0}, padding {0};
+      float perspectiveFOV {0}, perspectiveNear {0}, perspectiveFar {0};
+      float orthographicSize {0}, orthographicNear {0}, orthographicFar {0};
+    };
+    
+    /// This structure stores the packed mesh component
+    struct MeshRecord
+    {
+      uint64_t mesh {0};
+      float tilingFactor {1.0f};
+      uint32_t enable {0};
+    };
+    
+    /// This structure stores the packed material of mesh component
+    struct MaterialRecord
+    {
+      uint32_t index {0}, padding {0};
+      uint64_t material {0};
+    };
+    
+    /// This class appends the packed data in column
+    class ColumnWriter
+    {
+    public:
+      /// This function appends the value in column
+      template<typename T> void Write(const T& value)
+      {
+        Write(&value, sizeof(T));
+      }
+      /// This function appends the values in column
+      template<typename T> void Write(const std::vector<T>& values)
+      {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivial data can be packed");
+        Write(values.data(), values.size() * sizeof(T));
+      }
+      /// This function appends the bytes in column
+      void Write(const void* data, size_t size)
+      {
+        const std::byte* bytes = static_cast<const std::byte*>(data);
+        m_data.insert(m_data.end(), bytes, bytes + size);
+      }
+      
+      /// This function writes the column in file
+      /// - Parameters:
+      ///   - stream: file stream
+      ///   - type: column type
+      ///   - rowCount: number of rows in column
+      void WriteColumn(std::ofstream& stream, SceneColumn type, uint32_t rowCount)
+      {
+        BinarySceneColumn column {type, rowCount, m_data.size()};
+        stream.write(reinterpret_cast<const char*>(&column), sizeof(BinarySceneColumn));
+        stream.write(reinterpret_cast<const char*>(m_data.data()), (std::streamsize)m_data.size());
+        m_data.clear();
+      }
+      
+    private:
+      std::vector<std::byte> m_data;
+    };
+    
+    /// This class reads the packed data from column. Reads out of column are failed
+    class ColumnReader
+    {
+    public:
+      /// This constructor creates the reader of column data
+      /// - Parameter data: column data
+      ColumnReader(const std::vector<std::byte>& data)
+      : m_data(data) { }
+      
+      /// This function reads the values from column
+      /// - Parameters:
+      ///   - values: destination values
+      ///   - count: number of values
+      template<typename T> bool Read(std::vector<T>& values, size_t count)
+      {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivial data can be packed");
+        if (count * sizeof(T) > m_data.size() - m_offset)
+        {
+          return false;
+        }
+        values.resize(count);
+        memcpy(values.data(), m_data.data() + m_offset, count * sizeof(T));
+        m_offset += count * sizeof(T);
+        return true;
+      }
+      /// This function reads the characters from column
+      /// - Parameter size: number of characters
+      const char* ReadChars(size_t size)
+      {
+        if (size > m_data.size() - m_offset)
+        {
+          return nullptr;
+        }
+        const char* chars = reinterpret_cast<const char*>(m_data.data() + m_offset);
+        m_offset += size;
+        return chars;
+      }
+      
+    private:
+      const std::vector<std::byte>& m_data;
+      size_t m_offset {0};
+    };
+    
+    /// Columns which every binary scene should have. Camera and Mesh columns are optional
+    static constexpr uint32_t s_requiredSceneColumns =
+      (1u << (uint32_t)SceneColumn::ID) | (1u << (uint32_t)SceneColumn::Tag) | (1u << (uint32_t)SceneColumn::Visibility) |
+      (1u << (uint32_t)SceneColumn::Relationship) | (1u << (uint32_t)SceneColumn::Transform);
+    
+    /// This structure stores the decoded columns of binary scene. Rows of optional components are checked against
+    /// entity count, so data can be added in scene without any check
+    struct BinarySceneData
+    {
+      std::vector<uint64_t> ids;
+      std::vector<TagComponent> tags;
+      std::vector<VisibilityComponent> visibility;
+      std::vector<RelationshipComponent> relationships;
+      std::vector<TransformComponent> transforms;
+      
+      std::vector<uint32_t> cameraRows;
+      std::vector<CameraComponent> cameras;
+      
+      std::vector<uint32_t> meshRows, materialOffsets;
+      std::vector<MeshRecord> meshes;
+      std::vector<MaterialRecord> materials;
+    };
+    
+    /// This function decodes the column of binary scene
+    /// - Parameters:
+    ///   - column: column header
+    ///   - entityCount: number of entities in scene
+    ///   - columnData: column data
+    ///   - data: decoded data to be updated
+    /// - Returns: false if column data is invalid
+    static bool DecodeColumn(const BinarySceneColumn& column, uint32_t entityCount, const std::vector<std::byte>& columnData,
+                             BinarySceneData& data)
+    {
+      ColumnReader reader(columnData);
+      switch (column.type)
+      {
+        case SceneColumn::ID:
+        {
+          return column.rowCount == entityCount and reader.Read(data.ids, entityCount);
+        }
+        case SceneColumn::Tag:
+        {
+          std::vector<uint32_t> offsets;
+          if (!reader.Read(offsets, entityCount))
+          {
+            return false;
+          }
+          const uint32_t charCount = entityCount ? offsets.back() : 0;
+          const char* chars = reader.ReadChars(charCount);
+          if (!chars)
+          {
+            return false;
+          }
+          
+          data.tags.resize(entityCount);
+          for (uint32_t row = 0, begin = 0; row < entityCount; begin = offsets[row++])
+          {
+            if (begin > offsets[row] or offsets[row] > charCount)
+            {
+              return false;
+            }
+            data.tags[row].tag.assign(chars + begin, offsets[row] - begin);
+          }
+          return true;
+        }
+        case SceneColumn::Visibility:
+        {
+          std::vector<uint8_t> visibility;
+          if (!reader.Read(visibility, entityCount))
+          {
+            return false;
+          }
+          data.visibility.resize(entityCount);
+          for (uint32_t row = 0; row < entityCount; row++)
+          {
+            data.visibility[row].isVisible = visibility[row];
+          }
+          return true;
+        }
+        case SceneColumn::Relationship:
+        {
+          std::vector<uint64_t> parents, children;
+          std::vector<uint32_t> offsets;
+          if (!reader.Read(parents, entityCount) or !reader.Read(offsets, entityCount) or
+              !reader.Read(children, entityCount ? offsets.back() : 0))
+          {
+            return false;
+          }
+          
+          data.relationships.resize(entityCount);
+          for (uint32_t row = 0, begin = 0; row < entityCount; begin = offsets[row++])
+          {
+            if (begin > offsets[row] or offsets[row] > children.size())
+            {
+              return false;
+            }
+            data.relationships[row].parentHandle = parents[row];
+            data.relationships[row].children.assign(children.begin() + begin, children.begin() + offsets[row]);
+          }
+          return true;
+        }
+        case SceneColumn::Transform:
+        {
+          std::vector<glm::vec3> positions, rotations, scales;
+          if (!reader.Read(positions, entityCount) or !reader.Read(rotations, entityCount) or !reader.Read(scales, entityCount))
+          {
+            return false;
+          }
+          
+          data.transforms.resize(entityCount);
+          for (uint32_t row = 0; row < entityCount; row++)
+          {
+            data.transforms[row].UpdatePosition(positions[row]);
+            data.transforms[row].UpdateRotation(rotations[row]);
+            data.transforms[row].UpdateScale(scales[row]);
+          }
+          return true;
+        }
+        case SceneColumn::Camera:
+        {
+          std::vector<CameraRecord> cameras;
+          if (!reader.Read(data.cameraRows, column.rowCount) or !reader.Read(cameras, column.rowCount) or
+              std::any_of(data.cameraRows.begin(), data.cameraRows.end(), [entityCount](uint32_t row) { return row >= entityCount; }))
+          {
+            return false;
+          }
+          
+          data.cameras.resize(column.rowCount);
+          for (uint32_t cameraIdx = 0; cameraIdx < column.rowCount; cameraIdx++)
+          {
+            const CameraRecord& record = cameras[cameraIdx];
+            CameraComponent& component = data.cameras[cameraIdx];
+            component.enable = record.enable;
+            component.primary = record.primary;
+            component.camera.SetProjectionType((SceneCamera::ProjectionType)record.projectionType);
+            component.camera.SetDegPerspectiveVerticalFOV(record.perspectiveFOV);
+            component.camera.SetPerspectiveNearClip(record.perspectiveNear);
+            component.camera.SetPerspectiveFarClip(record.perspectiveFar);
+            component.camera.SetOrthographicSize(record.orthographicSize);
+            component.camera.SetOrthographicNearClip(record.orthographicNear);
+            component.camera.SetOrthographicFarClip(record.orthographicFar);
+          }
+          return true;
+        }
+        case SceneColumn::Mesh:
+        {
+          if (!reader.Read(data.meshRows, column.rowCount) or !reader.Read(data.meshes, column.rowCount) or
+              !reader.Read(data.materialOffsets, column.rowCount) or
+              !reader.Read(data.materials, column.rowCount ? data.materialOffsets.back() : 0))
+          {
+            return false;
+          }
+          
+          // Materials are resolved when mesh components are added in scene
+          for (uint32_t meshIdx = 0, begin = 0; meshIdx < column.rowCount; begin = data.materialOffsets[meshIdx++])
+          {
+            if (data.meshRows[meshIdx] >= entityCount or begin > data.materialOffsets[meshIdx] or
+                data.materialOffsets[meshIdx] > data.materials.size())
+            {
+              return false;
+            }
+          }
+          return true;
+        }
+        default:
+          return true;
+      }
+    }
+    
+    /// This function returns true if file starts with binary scene magic
+    /// - Parameter filepath: scene file path
+    static bool IsBinarySceneFile(const std::filesystem::path& filepath)
+    {
+      std::ifstream stream(filepath, std::ios::in | std::ios::binary);
+      uint32_t magic = 0;
+      stream.read(reinterpret_cast<char*>(&magic), sizeof(uint32_t));
+      return stream and magic == s_binarySceneMagic;
+    }
+  } // namespace SceneSerializerUtils
+  
   SceneSerializer::SceneSerializer(const Ref<Scene>& scene)
   : m_scene(scene)
   {
   }
   
-  void SceneSerializer::Serialize(const std::filesystem::path& filepath)
+  void SceneSerializer::Serialize(const std::filesystem::path& filepath, SceneFormat format)
   {
     IK_PROFILE();
     IK_LOG_TRACE(LogModule::SceneSerializer, "Serializing the Scene {0}", filepath.filename().string());
@@ -32,10 +351,47 @@ namespace IKan
       m_scene->SetName(filename);
     }
     
+    if (format == SceneFormat::Binary)
+    {
+      SerializeBinary(filepath);
+    }
+    else
+    {
+      SerializeYaml(filepath);
+    }
+    
+    UpdateAssetDependencies(filepath);
+  }
+  
+  bool SceneSerializer::Deserialize(const std::filesystem::path& filepath)
+  {
+    IK_PROFILE();
+    Timer timer;
+    
+    // Dependencies found while loading materials are written once
+    AssetRegistryTransaction registryTransaction;
+    
+    const bool isBinary = SceneSerializerUtils::IsBinarySceneFile(filepath);
+    if (!(isBinary ? DeserializeBinary(filepath) : DeserializeYaml(filepath)))
+    {
+      return false;
+    }
+    
+    // Scenes saved before dependency graph are added here
+    UpdateAssetDependencies(filepath);
+    
+    IK_LOG_INFO(LogModule::SceneSerializer, "Deserialized scene '{0}' ({1} entities, {2}) in {3:.2f} ms", m_scene->GetName(),
+                m_scene->m_numEntities, isBinary ? "Binary" : "Yaml", timer.ElapsedMiliSeconds());
+    return true;
+  }
+  
+  void SceneSerializer::SerializeYaml(const std::filesystem::path& filepath)
+  {
     YAML::Emitter out;
     out << YAML::BeginMap;
     out << YAML::Key << "Scene";
     out << YAML::Value << m_scene->GetName();
+    out << YAML::Key << "LocalTransforms" << YAML::Value << true;
     
     out << YAML::Key << "Entities";
     out << YAML::Value << YAML::BeginSeq;
@@ -63,7 +419,7 @@ namespace IKan
     fout << out.c_str();
   }
   
-  bool SceneSerializer::Deserialize(const std::filesystem::path& filepath)
+  bool SceneSerializer::DeserializeYaml(const std::filesystem::path& filepath)
   {
     IK_PROFILE();
     std::ifstream stream(filepath);
@@ -89,19 +445,400 @@ namespace IKan
     auto entities = data["Entities"];
     if (entities)
     {
+      // Entities are created in order, so IDComponent is already ordered by entity handle
       EntitySerializer::DeserializeEntities(m_scene, entities);
     }
     
-    // Sort IdComponent by by entity handle (which is essentially the order in which they were created)
-    // This ensures a consistent ordering when iterating IdComponent (for example: when rendering scene hierarchy panel)
-    m_scene->m_registry.sort<IDComponent>([this](const auto lhs, const auto rhs)
-                                          {
-      auto lhsEntity = m_scene->m_entityIDMap.find(lhs.ID);
-      auto rhsEntity = m_scene->m_entityIDMap.find(rhs.ID);
-      return static_cast<uint32_t>(lhsEntity->second) < static_cast<uint32_t>(rhsEntity->second);
-    });
-
+    if (!data["LocalTransforms"].as<bool>(false))
+    {
+      ConvertToLocalTransforms();
+    }
     return true;
   }
-
+  
+  void SceneSerializer::SerializeBinary(const std::filesystem::path& filepath)
+  {
+    IK_PROFILE();
+    using namespace SceneSerializerUtils;
+    entt::registry& registry = m_scene->m_registry;
+    
+    // 1. Entities are stored by UUID, same as yaml. Row of entity is its index in this list
+    std::map<UUID, entt::entity> sortedEntityMap;
+    auto idComponentView = registry.view<IDComponent>();
+    for (auto entity : idComponentView)
+    {
+      sortedEntityMap[idComponentView.get<IDComponent>(entity).ID] = entity;
+    }
+    
+    std::vector<entt::entity> entities;
+    entities.reserve(sortedEntityMap.size());
+    for (const auto& [id, entity] : sortedEntityMap)
+    {
+      entities.push_back(entity);
+    }
+    const uint32_t entityCount = static_cast<uint32_t>(entities.size());
+    
+    std::ofstream stream(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!stream)
+    {
+      IK_LOG_ERROR(LogModule::SceneSerializer, "Can not write scene {0}", filepath.string());
+      return;
+    }
+    
+    const std::string& sceneName = m_scene->GetName();
+    BinarySceneHeader header;
+    header.entityCount = entityCount;
+    header.columnCount = 7;
+    header.nameSize = static_cast<uint32_t>(sceneName.size());
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(BinarySceneHeader));
+    stream.write(sceneName.data(), (std::streamsize)sceneName.size());
+    
+    ColumnWriter writer;
+    
+    // 2. Mandatory components. One row for each entity
+    {
+      std::vector<uint64_t> ids;
+      ids.reserve(entityCount);
+      for (const auto& [id, entity] : sortedEntityMap)
+      {
+        ids.push_back(id);
+      }
+      writer.Write(ids);
+      writer.WriteColumn(stream, SceneColumn::ID, entityCount);
+    }
+    {
+      // |< String end offsets >|< Characters >|
+      std::vector<uint32_t> offsets;
+      std::string chars;
+      offsets.reserve(entityCount);
+      for (entt::entity entity : entities)
+      {
+        chars += registry.get<TagComponent>(entity).tag;
+        offsets.push_back(static_cast<uint32_t>(chars.size()));
+      }
+      writer.Write(offsets);
+      writer.Write(chars.data(), chars.size());
+      writer.WriteColumn(stream, SceneColumn::Tag, entityCount);
+    }
+    {
+      std::vector<uint8_t> visibility;
+      visibility.reserve(entityCount);
+      for (entt::entity entity : entities)
+      {
+        visibility.push_back(registry.get<VisibilityComponent>(entity).isVisible);
+      }
+      writer.Write(visibility);
+      writer.WriteColumn(stream, SceneColumn::Visibility, entityCount);
+    }
+    {
+      // |< Parents >|< Children end offsets >|< Children >|
+      std::vector<uint64_t> parents, children;
+      std::vector<uint32_t> offsets;
+      parents.reserve(entityCount);
+      offsets.reserve(entityCount);
+      for (entt::entity entity : entities)
+      {
+        const auto& relationship = registry.get<RelationshipComponent>(entity);
+        parents.push_back(relationship.parentHandle);
+        for (UUID child : relationship.children)
+        {
+          children.push_back(child);
+        }
+        offsets.push_back(static_cast<uint32_t>(children.size()));
+      }
+      writer.Write(parents);
+      writer.Write(offsets);
+      writer.Write(children);
+      writer.WriteColumn(stream, SceneColumn::Relationship, entityCount);
+    }
+    {
+      // |< Positions >|< Rotations >|< Scales >|
+      std::vector<glm::vec3> positions, rotations, scales;
+      positions.reserve(entityCount);
+      rotations.reserve(entityCount);
+      scales.reserve(entityCount);
+      for (entt::entity entity : entities)
+      {
+        const auto& transform = registry.get<TransformComponent>(entity);
+        positions.push_back(transform.Position());
+        rotations.push_back(transform.Rotation());
+        scales.push_back(transform.Scale());
+      }
+      writer.Write(positions);
+      writer.Write(rotations);
+      writer.Write(scales);
+      writer.WriteColumn(stream, SceneColumn::Transform, entityCount);
+    }
+    
+    // 3. Optional components. Rows store the entity row for each component
+    {
+      // |< Rows >|< Cameras >|
+      std::vector<uint32_t> rows;
+      std::vector<CameraRecord> cameras;
+      for (uint32_t row = 0; row < entityCount; row++)
+      {
+        if (const auto* cameraComponent = registry.try_get<CameraComponent>(entities[row]); cameraComponent)
+        {
+          const SceneCamera& camera = cameraComponent->camera;
+          rows.push_back(row);
+          cameras.push_back({cameraComponent->enable, cameraComponent->primary, (uint8_t)camera.GetProjectionType(), 0,
+            camera.GetDegPerspectiveVerticalFOV(), camera.GetPerspectiveNearClip(), camera.GetPerspectiveFarClip(),
+            camera.GetOrthographicSize(), camera.GetOrthographicNearClip(), camera.GetOrthographicFarClip()});
+        }
+      }
+      writer.Write(rows);
+      writer.Write(cameras);
+      writer.WriteColumn(stream, SceneColumn::Camera, static_cast<uint32_t>(rows.size()));
+    }
+    {
+      // |< Rows >|< Meshes >|< Material end offsets >|< Materials >|
+      std::vector<uint32_t> rows, offsets;
+      std::vector<MeshRecord> meshes;
+      std::vector<MaterialRecord> materials;
+      for (uint32_t row = 0; row < entityCount; row++)
+      {
+        if (const auto* meshComponent = registry.try_get<MeshComponent>(entities[row]); meshComponent)
+        {
+          rows.push_back(row);
+          meshes.push_back({meshComponent->mesh, meshComponent->tilingFactor, meshComponent->enable});
+          for (const auto& [index, material] : meshComponent->materialTable->GetMaterials())
+          {
+            materials.push_back({index, 0, material ? (uint64_t)material->handle : 0});
+          }
+          offsets.push_back(static_cast<uint32_t>(materials.size()));
+        }
+      }
+      writer.Write(rows);
+      writer.Write(meshes);
+      writer.Write(offsets);
+      writer.Write(materials);
+      writer.WriteColumn(stream, SceneColumn::Mesh, static_cast<uint32_t>(rows.size()));
+    }
+    
+    if (stream.fail())
+    {
+      IK_LOG_ERROR(LogModule::SceneSerializer, "Can not write scene {0}", filepath.string());
+    }
+  }
+  
+  bool SceneSerializer::DeserializeBinary(const std::filesystem::path& filepath)
+  {
+    IK_PROFILE();
+    using namespace SceneSerializerUtils;
+    
+    // All the sizes in file are checked against the bytes left in file before they are allocated or read
+    std::error_code error;
+    const uint64_t fileSize = std::filesystem::file_size(filepath, error);
+    std::ifstream stream(filepath, std::ios::in | std::ios::binary);
+    BinarySceneHeader header;
+    stream.read(reinterpret_cast<char*>(&header), sizeof(BinarySceneHeader));
+    if (error or !stream or header.magic != s_binarySceneMagic or header.version == 0 or header.version > s_binarySceneVersion)
+    {
+      IK_LOG_ERROR(LogModule::SceneSerializer, "Invalid binary scene {0}", filepath.string());
+      return false;
+    }
+    uint64_t remainingBytes = fileSize - sizeof(BinarySceneHeader);
+    
+    entt::registry& registry = m_scene->m_registry;
+    const uint32_t entityCount = header.entityCount;
+    if (header.nameSize > remainingBytes or registry.size() + entityCount > m_scene->m_registryCapacity)
+    {
+      IK_LOG_ERROR(LogModule::SceneSerializer, "Binary scene {0} has invalid name size or too many entities ({1})",
+                   filepath.string(), entityCount);
+      return false;
+    }
+    
+    std::string sceneName(header.nameSize, '\0');
+    stream.read(sceneName.data(), header.nameSize);
+    remainingBytes -= header.nameSize;
+    
+    // 1. Decode all the columns. Scene is not changed till all columns are valid
+    BinarySceneData data;
+    uint32_t decodedColumns = 0;
+    std::vector<std::byte> columnData;
+    for (uint32_t columnIdx = 0; columnIdx < header.columnCount; columnIdx++)
+    {
+      BinarySceneColumn column;
+      stream.read(reinterpret_cast<char*>(&column), sizeof(BinarySceneColumn));
+      if (!stream or sizeof(BinarySceneColumn) > remainingBytes or column.size > remainingBytes - sizeof(BinarySceneColumn))
+      {
+        IK_LOG_ERROR(LogModule::SceneSerializer, "Binary scene {0} is truncated", filepath.string());
+        return false;
+      }
+      remainingBytes -= sizeof(BinarySceneColumn) + column.size;
+      
+      columnData.resize(column.size);
+      stream.read(reinterpret_cast<char*>(columnData.data()), (std::streamsize)column.size);
+      if (!stream)
+      {
+        IK_LOG_ERROR(LogModule::SceneSerializer, "Binary scene {0} is truncated", filepath.string());
+        return false;
+      }
+      
+      if (column.type > SceneColumn::Mesh)
+      {
+        IK_LOG_WARN(LogModule::SceneSerializer, "Skipping unknown column {0} in binary scene", (uint32_t)column.type);
+        continue;
+      }
+      
+      const uint32_t columnBit = 1u << (uint32_t)column.type;
+      if (decodedColumns & columnBit)
+      {
+        IK_LOG_ERROR(LogModule::SceneSerializer, "Binary scene {0} has duplicate column {1}", filepath.string(), (uint32_t)column.type);
+        return false;
+      }
+      decodedColumns |= columnBit;
+      
+      if (!DecodeColumn(column, entityCount, columnData, data))
+      {
+        IK_LOG_ERROR(LogModule::SceneSerializer, "Binary scene {0} is corrupted", filepath.string());
+        return false;
+      }
+    }
+    
+    if ((decodedColumns & s_requiredSceneColumns) != s_requiredSceneColumns)
+    {
+      IK_LOG_ERROR(LogModule::SceneSerializer, "Binary scene {0} has missing columns", filepath.string());
+      return false;
+    }
+    
+    // Entity IDs should be unique in file and in scene
+    std::unordered_set<uint64_t> uniqueIDs(data.ids.begin(), data.ids.end());
+    if (uniqueIDs.size() != data.ids.size() or
+        std::any_of(data.ids.begin(), data.ids.end(), [this](uint64_t id) { return m_scene->m_entityIDMap.contains(id); }))
+    {
+      IK_LOG_ERROR(LogModule::SceneSerializer, "Binary scene {0} has duplicate entity IDs", filepath.string());
+      return false;
+    }
+    
+    // 2. Add the entities and components in scene
+    IK_LOG_TRACE(LogModule::SceneSerializer, "Deserializing binary scene '{0}'", sceneName);
+    m_scene->SetName(sceneName);
+    
+    // Create all the entities at once. Handles are in row order, so ID pool is already sorted by handle
+    std::vector<entt::entity> entities(entityCount);
+    registry.create(entities.begin(), entities.end());
+    
+    std::vector<IDComponent> idComponents(entityCount);
+    m_scene->m_entityIDMap.reserve(m_scene->m_entityIDMap.size() + entityCount);
+    for (uint32_t row = 0; row < entityCount; row++)
+    {
+      idComponents[row].ID = data.ids[row];
+      m_scene->m_entityIDMap[data.ids[row]] = Entity(entities[row], m_scene.get());
+    }
+    registry.insert<IDComponent>(entities.begin(), entities.end(), idComponents.begin(), idComponents.end());
+    registry.insert<TagComponent>(entities.begin(), entities.end(), data.tags.begin(), data.tags.end());
+    registry.insert<VisibilityComponent>(entities.begin(), entities.end(), data.visibility.begin(), data.visibility.end());
+    registry.insert<RelationshipComponent>(entities.begin(), entities.end(), data.relationships.begin(), data.relationships.end());
+    registry.insert<TransformComponent>(entities.begin(), entities.end(), data.transforms.begin(), data.transforms.end());
+    registry.insert<WorldTransformComponent>(entities.begin(), entities.end());
+    
+    // Optional components
+    std::vector<entt::entity> cameraEntities(data.cameraRows.size());
+    for (size_t cameraIdx = 0; cameraIdx < data.cameraRows.size(); cameraIdx++)
+    {
+      cameraEntities[cameraIdx] = entities[data.cameraRows[cameraIdx]];
+    }
+    registry.insert<CameraComponent>(cameraEntities.begin(), cameraEntities.end(), data.cameras.begin(), data.cameras.end());
+    
+    std::vector<entt::entity> meshEntities(data.meshRows.size());
+    std::vector<MeshComponent> meshComponents(data.meshRows.size());
+    for (uint32_t meshIdx = 0, begin = 0; meshIdx < data.meshRows.size(); begin = data.materialOffsets[meshIdx++])
+    {
+      meshEntities[meshIdx] = entities[data.meshRows[meshIdx]];
+      
+      const MeshRecord& record = data.meshes[meshIdx];
+      MeshComponent& component = meshComponents[meshIdx];
+      component.mesh = record.mesh;
+      component.tilingFactor = record.tilingFactor;
+      component.enable = record.enable;
+      for (uint32_t materialIdx = begin; materialIdx < data.materialOffsets[meshIdx]; materialIdx++)
+      {
+        const MaterialRecord& material = data.materials[materialIdx];
+        if (material.material and AssetManager::IsAssetHandleValid(material.material))
+        {
+          component.materialTable->SetMaterial(material.index, AssetManager::GetAsset<MaterialAsset>(material.material));
+        }
+      }
+    }
+    registry.insert<MeshComponent>(meshEntities.begin(), meshEntities.end(), meshComponents.begin(), meshComponents.end());
+    
+    if (entityCount > 0)
+    {
+      m_scene->m_maxEntityID = (int32_t)((uint32_t)entities.back());
+    }
+    m_scene->m_numEntities += entityCount;
+    
+    if (header.version < 2)
+    {
+      ConvertToLocalTransforms();
+    }
+    return true;
+  }
+  
+  void SceneSerializer::ConvertToLocalTransforms()
+  {
+    IK_PROFILE();
+    entt::registry& registry = m_scene->m_registry;
+    
+    // All the transforms are in world space, so parent transform is used before it is converted
+    std::vector<std::pair<entt::entity, glm::mat4>> localTransforms;
+    auto view = registry.view<TransformComponent, RelationshipComponent>();
+    for (auto entity : view)
+    {
+      const auto& [transform, relationship] = view.get<TransformComponent, RelationshipComponent>(entity);
+      if (Entity parent = m_scene->TryGetEntityWithUUID(relationship.parentHandle); parent)
+      {
+        localTransforms.emplace_back(entity, glm::inverse(parent.GetTransform().Transform()) * transform.Transform());
+      }
+    }
+    
+    for (const auto& [entity, localTransform] : localTransforms)
+    {
+      registry.get<TransformComponent>(entity).UpdateTransform(localTransform);
+    }
+  }
+  
+  void SceneSerializer::UpdateAssetDependencies(const std::filesystem::path& filepath) const
+  {
+    IK_PROFILE();
+    if (!Project::GetActive())
+    {
+      return;
+    }
+    
+    // Only scenes already registered in project are updated. Scenes outside the asset directory (like temporary or
+    // exported files) are never imported in registry
+    std::error_code directoryError, fileError;
+    const std::filesystem::path assetDirectory = std::filesystem::weakly_canonical(Project::GetActive()->GetAssetDirectory(), directoryError);
+    const std::filesystem::path scenePath = std::filesystem::weakly_canonical(filepath, fileError);
+    const std::filesystem::path relativePath = directoryError or fileError ? std::filesystem::path() : scenePath.lexically_relative(assetDirectory);
+    if (relativePath.empty() or *relativePath.begin() == "..")
+    {
+      return;
+    }
+    
+    const AssetMetadata& sceneMetadata = AssetManager::GetMetadata(relativePath);
+    if (!sceneMetadata.IsValid() or sceneMetadata.type != AssetType::Scene)
+    {
+      return;
+    }
+    const AssetHandle sceneHandle = sceneMetadata.handle;
+    
+    std::vector<AssetHandle> dependencies;
+    auto meshView = m_scene->m_registry.view<MeshComponent>();
+    for (auto entity : meshView)
+    {
+      const auto& meshComponent = meshView.get<MeshComponent>(entity);
+      dependencies.push_back(meshComponent.mesh);
+      for (const auto& [index, material] : meshComponent.materialTable->GetMaterials())
+      {
+        if (material)
+        {
+          dependencies.push_back(material->handle);
+        }
+      }
+    }
+    AssetManager::SetAssetDependencies(sceneHandle, dependencies);
+  }
 } // namespace IKan
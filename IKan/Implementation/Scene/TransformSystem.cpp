@@ -0,0 +1,181 @@
+//
+//  TransformSystem.cpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "TransformSystem.hpp"
+
+#include "Scene/Scene.hpp"
+#include "Scene/Entity.hpp"
+#include "Scene/Component.hpp"
+#include "Core/JobSystem.hpp"
+
+namespace IKan
+{
+  namespace TransformSystemUtils
+  {
+    /// Minimum number of entities updated by each job. Root hierarchies are never split
+    static constexpr uint32_t JobSize = 1024;
+
+    /// Index of entity that is not added in hierarchy
+    static constexpr int32_t NotAdded = -1;
+    /// Index of entity that is waiting to be added in hierarchy
+    static constexpr int32_t Queued = -2;
+
+    /// This function returns the index of entity in registry without version
+    /// - Parameter entity: entity handle
+    static uint32_t GetEntityIndex(entt::entity entity)
+    {
+      return static_cast<uint32_t>(entt::registry::entity(entity));
+    }
+  } // namespace TransformSystemUtils
+
+  void TransformSystem::Update(Scene& scene)
+  {
+    IK_PERFORMANCE("TransformSystem::Update");
+    entt::registry& registry = scene.GetRegistry();
+
+    // Entities added or removed without invalidating (bulk loading) also rebuild the hierarchy
+    const bool rebuild = m_isHierarchyChanged or registry.size<TransformComponent>() != m_entities.size();
+    if (rebuild)
+    {
+      Build(scene);
+    }
+
+    // Each job owns complete root hierarchies, so parent is always updated before its children by same job
+    JobSystem::ParallelFor(static_cast<uint32_t>(m_jobRanges.size()), [this, &registry, rebuild](uint32_t jobIdx) {
+      const auto [begin, end] = m_jobRanges[jobIdx];
+      for (uint32_t index = begin; index < end; index++)
+      {
+        const int32_t parentIdx = m_parents[index];
+        const TransformComponent& transform = registry.get<TransformComponent>(m_entities[index]);
+
+        // Clean entities with clean parent keep their world transform
+        const bool isUpdated = rebuild or transform.Version() != m_localVersions[index] or (parentIdx >= 0 and m_updated[parentIdx]);
+        m_updated[index] = isUpdated;
+        if (!isUpdated)
+        {
+          continue;
+        }
+
+        m_localVersions[index] = transform.Version();
+        WorldTransformComponent& worldTransform = registry.get<WorldTransformComponent>(m_entities[index]);
+        if (parentIdx >= 0)
+        {
+          worldTransform.transform = registry.get<WorldTransformComponent>(m_entities[parentIdx]).transform * transform.Transform();
+        }
+        else
+        {
+          worldTransform.transform = transform.Transform();
+        }
+        worldTransform.version++;
+      }
+    });
+  }
+
+  void TransformSystem::Invalidate()
+  {
+    m_isHierarchyChanged = true;
+  }
+
+  glm::mat4 TransformSystem::ComputeWorldTransform(Entity entity)
+  {
+    glm::mat4 worldTransform = entity.GetTransform().Transform();
+    for (Entity parent = entity.GetParent(); parent; parent = parent.GetParent())
+    {
+      worldTransform = parent.GetTransform().Transform() * worldTransform;
+    }
+    return worldTransform;
+  }
+
+  void TransformSystem::Build(Scene& scene)
+  {
+    IK_PERFORMANCE("TransformSystem::Build");
+    using namespace TransformSystemUtils;
+
+    entt::registry& registry = scene.GetRegistry();
+    const size_t entityCount = registry.size<TransformComponent>();
+
+    m_entities.clear();
+    m_parents.clear();
+    m_jobRanges.clear();
+    m_entities.reserve(entityCount);
+    m_parents.reserve(entityCount);
+
+    // Index of each entity in flattened hierarchy
+    std::vector<int32_t> entityIndices(registry.size(), NotAdded);
+    std::vector<std::pair<entt::entity, int32_t /* Parent index */>> stack;
+    uint32_t jobBegin = 0;
+
+    // Depth first traversal. Subtree of entity is added just after entity, so that each root hierarchy is contiguous
+    auto addHierarchy = [&](entt::entity root) {
+      entityIndices[GetEntityIndex(root)] = Queued;
+      stack.emplace_back(root, -1);
+      while (!stack.empty())
+      {
+        const auto [entity, parentIdx] = stack.back();
+        stack.pop_back();
+
+        const int32_t index = static_cast<int32_t>(m_entities.size());
+        entityIndices[GetEntityIndex(entity)] = index;
+        m_entities.push_back(entity);
+        m_parents.push_back(parentIdx);
+
+        // Only the children having this entity as parent are added. Others are added as root later
+        const UUID uuid = registry.get<IDComponent>(entity).ID;
+        for (UUID childID : registry.get<RelationshipComponent>(entity).children)
+        {
+          const entt::entity child = scene.TryGetEntityWithUUID(childID);
+          if (child == entt::null or !registry.has<TransformComponent, RelationshipComponent>(child) or
+              registry.get<RelationshipComponent>(child).parentHandle != uuid or entityIndices[GetEntityIndex(child)] != NotAdded)
+          {
+            continue;
+          }
+          entityIndices[GetEntityIndex(child)] = Queued;
+          stack.emplace_back(child, index);
+        }
+      }
+
+      if (m_entities.size() - jobBegin >= JobSize)
+      {
+        m_jobRanges.emplace_back(jobBegin, static_cast<uint32_t>(m_entities.size()));
+        jobBegin = static_cast<uint32_t>(m_entities.size());
+      }
+    };
+
+    auto view = registry.view<TransformComponent, RelationshipComponent>();
+    for (auto entity : view)
+    {
+      if (!registry.has<WorldTransformComponent>(entity))
+      {
+        registry.emplace<WorldTransformComponent>(entity);
+      }
+
+      const UUID parent = view.get<RelationshipComponent>(entity).parentHandle;
+      if (parent == 0 or !scene.TryGetEntityWithUUID(parent))
+      {
+        addHierarchy(entity);
+      }
+    }
+
+    // Entities with broken parent links are not reached from any root
+    for (auto entity : view)
+    {
+      if (entityIndices[GetEntityIndex(entity)] == NotAdded)
+      {
+        addHierarchy(entity);
+      }
+    }
+
+    if (jobBegin < m_entities.size())
+    {
+      m_jobRanges.emplace_back(jobBegin, static_cast<uint32_t>(m_entities.size()));
+    }
+
+    m_localVersions.assign(m_entities.size(), 0);
+    m_updated.assign(m_entities.size(), 0);
+    m_isHierarchyChanged = false;
+  }
+} // namespace IKan
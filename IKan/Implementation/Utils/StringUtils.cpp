@@ -195,6 +195,38 @@ namespace IKan::Utils::String
     
     return result;
   }
+  char32_t DecodeUTF8(std::string_view string, size_t& offset)
+  {
+    static constexpr char32_t ReplacementCharacter = 0xFFFD;
+    
+    const uint8_t leadByte = static_cast<uint8_t>(string[offset++]);
+    if (leadByte < 0x80)
+    {
+      return leadByte;
+    }
+    
+    // Number of continuation bytes is stored in lead byte
+    uint32_t continuationBytes = 0;
+    char32_t codePoint = 0;
+    if ((leadByte & 0xE0) == 0xC0)      { continuationBytes = 1; codePoint = leadByte & 0x1F; }
+    else if ((leadByte & 0xF0) == 0xE0) { continuationBytes = 2; codePoint = leadByte & 0x0F; }
+    else if ((leadByte & 0xF8) == 0xF0) { continuationBytes = 3; codePoint = leadByte & 0x07; }
+    else
+    {
+      return ReplacementCharacter;
+    }
+    
+    for (uint32_t i = 0; i < continuationBytes; i++)
+    {
+      if (offset >= string.size() or (static_cast<uint8_t>(string[offset]) & 0xC0) != 0x80)
+      {
+        return ReplacementCharacter;
+      }
+      codePoint = (codePoint << 6) | (static_cast<uint8_t>(string[offset++]) & 0x3F);
+    }
+    return codePoint;
+  }
+  
   std::string RemoveExtension(const std::string& filePath)
   {
     return filePath.substr(0, filePath.find_last_of('.'));
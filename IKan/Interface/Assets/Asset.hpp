@@ -34,6 +34,10 @@ return GetStaticType(); \
     
     /// This function returns the Asset type. Override in Derived class
     virtual AssetType GetAssetType() const = 0;
+    /// This function returns the approximate memory of asset in CPU in bytes. Override in Derived class
+    virtual uint64_t GetCPUMemorySize() const;
+    /// This function returns the approximate memory of asset in GPU in bytes. Override in Derived class
+    virtual uint64_t GetGPUMemorySize() const;
     /// This function compare tow assets
     /// - Parameter other: Other Asset
     virtual bool operator==(const Asset& other) const;
@@ -0,0 +1,42 @@
+//
+//  AssetDependencyGraph.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "Assets/Asset.hpp"
+
+namespace IKan
+{
+  /// This class stores the assets used by each asset (Scene -> Meshes, Materials -> Images). Dependencies are updated
+  /// when assets are serialized or loaded and stored in asset registry file
+  class AssetDependencyGraph
+  {
+  public:
+    /// This function stores the dependencies of asset. Replaces the previous dependencies
+    /// - Parameters:
+    ///   - handle: asset handle
+    ///   - dependencies: handles of assets used by asset
+    /// - Returns: true if dependencies are changed
+    bool Set(AssetHandle handle, std::vector<AssetHandle> dependencies);
+    /// This function returns the direct dependencies of asset. Returns empty list if asset has no dependency
+    /// - Parameter handle: asset handle
+    const std::vector<AssetHandle>& Get(AssetHandle handle) const;
+    /// This function returns all the assets used by asset directly or indirectly. Dependencies are ordered before the
+    /// assets using them. Asset itself is not included
+    /// - Parameter handle: asset handle
+    std::vector<AssetHandle> GetClosure(AssetHandle handle) const;
+
+    /// This function removes the dependencies of asset
+    /// - Parameter handle: asset handle
+    void Remove(AssetHandle handle);
+    /// This function clears the graph
+    void Clear();
+
+  private:
+    std::unordered_map<AssetHandle, std::vector<AssetHandle>> m_dependencies;
+  };
+} // namespace IKan
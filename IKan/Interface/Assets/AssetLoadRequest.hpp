@@ -0,0 +1,55 @@
+//
+//  AssetLoadRequest.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include <atomic>
+
+#include "Assets/Asset.hpp"
+#include "Renderer/RenderCommandQueue.hpp"
+
+namespace IKan
+{
+  /// This enum stores the status of asynchronous asset load
+  enum class AssetLoadStatus : uint8_t
+  {
+    Loading,   // File is read and decoded on worker thread
+    Uploading, // Asset is decoded. Renderer commands are waiting to be submitted from main thread
+    Ready,     // Asset is available in asset manager
+    Failed
+  };
+
+  /// This structure stores the asynchronous load request of asset. Request is created by AssetManager::LoadAssetAsync
+  /// and completed by AssetManager::SyncLoadedAssets on main thread
+  struct AssetLoadRequest
+  {
+    AssetHandle handle {0};
+    AssetType type {AssetType::Invalid};
+    std::atomic<AssetLoadStatus> status {AssetLoadStatus::Loading};
+
+    Ref<Asset> asset;       // Written by worker thread. Read only once status is not loading
+    Ref<Asset> placeholder; // Returned until asset is ready
+
+    // Renderer commands recorded while loading on worker thread. Executed on render thread before first use
+    Scope<RenderCommandQueue> commandQueue;
+
+    /// This function returns true if asset is ready to use
+    bool IsReady() const { return status.load(std::memory_order_acquire) == AssetLoadStatus::Ready; }
+    /// This function returns true if request is completed, successfully or not
+    bool IsCompleted() const
+    {
+      AssetLoadStatus currentStatus = status.load(std::memory_order_acquire);
+      return currentStatus == AssetLoadStatus::Ready or currentStatus == AssetLoadStatus::Failed;
+    }
+
+    /// This function returns the loaded asset if ready, else placeholder asset of type
+    template<typename T> Ref<T> Get() const
+    {
+      return std::dynamic_pointer_cast<T>(IsReady() ? asset : placeholder);
+    }
+  };
+} // namespace IKan
@@ -9,6 +9,9 @@
 
 #include "Assets/AssetRegistry.hpp"
 #include "Assets/AssetImporter.hpp"
+#include "Assets/AssetLoadRequest.hpp"
+#include "Assets/AssetResidency.hpp"
+#include "Assets/AssetDependencyGraph.hpp"
 
 namespace IKan
 {
@@ -58,6 +61,11 @@ namespace IKan
     /// - Parameter assetHandle: Asset handle
     static bool IsAssetHandleValid(AssetHandle assetHandle);
     
+    /// This function stores the asset created in memory. Memory asset is never written in registry
+    /// - Parameter asset: Asset instance
+    /// - Returns: handle of asset
+    static AssetHandle AddMemoryOnlyAsset(const Ref<Asset>& asset);
+    
     /// This function handles asset rename
     /// - Parameters:
     ///   - assetHandle: Asset handle
@@ -84,6 +92,56 @@ namespace IKan
     /// This function returns the asset registry
     static const AssetRegistry& GetAssetRegistry();
     
+    // Registry Transaction -----------------------------------------------------------------------------------------
+    /// This function starts the registry transaction. Asset changes in transaction are written in registry file once
+    /// when outermost transaction ends, instead of rewriting the file on each change. Transactions can be nested
+    static void BeginRegistryTransaction();
+    /// This function ends the registry transaction. Writes the registry file if it is changed in outermost transaction
+    static void EndRegistryTransaction();
+    
+    // Async Loading ------------------------------------------------------------------------------------------------
+    /// This function queues the asset to be loaded on job system worker thread. File is read and decoded on worker
+    /// thread and renderer commands are recorded in request. Commands are submitted to render thread once request is
+    /// synced on main thread. Assets that do not support async loading are loaded on calling thread
+    /// - Parameter assetHandle: Asset handle
+    /// - Returns: load request of asset. Same request is returned while asset is loading. Failed request is returned
+    ///            without loading again until asset is reloaded or its file is changed
+    static Ref<AssetLoadRequest> LoadAssetAsync(AssetHandle assetHandle);
+    /// This function completes the asset requests loaded by worker threads and makes the assets available
+    /// - Note: Should be called once per frame from main thread
+    static void SyncLoadedAssets();
+    /// This function blocks the calling thread until pending load request of asset is completed
+    /// - Parameter assetHandle: Asset handle
+    static void WaitForAsset(AssetHandle assetHandle);
+    /// This function returns the placeholder asset of type, used until asset is loaded. Returns null if type has no
+    /// placeholder (White texture for image and unit cube for mesh)
+    /// - Parameter type: asset type
+    static Ref<Asset> GetPlaceholderAsset(AssetType type);
+    /// This function returns the number of pending asset load requests
+    static uint32_t GetPendingLoadCount();
+    
+    // Dependencies -------------------------------------------------------------------------------------------------
+    /// This function updates the assets used by asset. Registry file is updated if dependencies are changed
+    /// - Parameters:
+    ///   - assetHandle: Asset handle
+    ///   - dependencies: handles of assets used by asset
+    static void SetAssetDependencies(AssetHandle assetHandle, const std::vector<AssetHandle>& dependencies);
+    /// This function returns the dependency graph of assets
+    static const AssetDependencyGraph& GetDependencyGraph();
+    /// This function loads all the assets used by asset directly or indirectly. Images and meshes are queued on worker
+    /// threads first and loaded in parallel, then other assets are loaded on calling thread
+    /// - Parameters:
+    ///   - assetHandle: Asset handle
+    ///   - waitForCompletion: blocks the calling thread until all the assets are loaded
+    /// - Returns: number of assets in dependency closure
+    static uint32_t PrefetchDependencies(AssetHandle assetHandle, bool waitForCompletion = true);
+    
+    // Residency ----------------------------------------------------------------------------------------------------
+    /// This function unloads the least recently used assets, not referenced outside asset manager, until resident
+    /// memory is under budget of AssetResidency. Unloaded assets are loaded again on next use
+    /// - Note: Called each frame by SyncLoadedAssets
+    static void EvictUnusedAssets();
+    
     // Template APIs ------------------------------------------------------------------------------------------------
     template<typename T, typename... Args>
     static Ref<T> CreateNewAsset(const std::string& filename, const std::string& directoryPath, Args&&... args)
@@ -134,14 +192,14 @@ namespace IKan
         }
       }
       
-      s_assetRegistry[metadata.filePath.string()] = metadata;
+      s_assetRegistry.Set(metadata.filePath, metadata);
       
       Ref<T> asset = T::Create(std::forward<Args>(args)...);
       asset->handle = metadata.handle;
-      s_loadedAssets[asset->handle] = asset;
+      StoreLoadedAsset(asset);
       AssetImporter::Serialize(metadata, asset);
       
-      WriteRegistryToFile();
+      OnRegistryChanged();
       
       return asset;
     }
@@ -154,9 +212,13 @@ namespace IKan
       {
         return std::dynamic_pointer_cast<T>(s_memoryAssets[assetHandle]);
       }
-      if (IsLoadedAsset(assetHandle))
+      
+      // Complete the asset if it is being loaded asynchronously, instead of loading it again
+      WaitForAsset(assetHandle);
+      if (auto it = s_loadedAssets.find(assetHandle); it != s_loadedAssets.end())
       {
-        return std::dynamic_pointer_cast<T>(s_loadedAssets[assetHandle]);
+        AssetResidency::Touch(assetHandle);
+        return std::dynamic_pointer_cast<T>(it->second);
       }
       
       auto& metadata = GetMetadataInternal(assetHandle);
@@ -174,7 +236,7 @@ namespace IKan
           return nullptr;
         }
         
-        s_loadedAssets[assetHandle] = asset;
+        StoreLoadedAsset(asset);
       }
       else
       {
@@ -189,28 +251,102 @@ namespace IKan
       return GetAsset<T>(GetAssetHandleFromFilePath(filepath));
     }
     
+    /// This function returns the asset if loaded. Else queues the asset to be loaded asynchronously and returns the
+    /// placeholder asset of type until it is ready
+    /// - Parameter assetHandle: Asset handle
+    template<typename T>
+    static Ref<T> GetAssetAsync(AssetHandle assetHandle)
+    {
+      IK_PROFILE();
+      if (IsMemoryAsset(assetHandle))
+      {
+        return std::dynamic_pointer_cast<T>(s_memoryAssets[assetHandle]);
+      }
+      if (auto it = s_loadedAssets.find(assetHandle); it != s_loadedAssets.end())
+      {
+        AssetResidency::Touch(assetHandle);
+        return std::dynamic_pointer_cast<T>(it->second);
+      }
+      return LoadAssetAsync(assetHandle)->template Get<T>();
+    }
+    
     DELETE_ALL_CONSTRUCTORS(AssetManager);
     
   private:
+    /// This structure stores the files found in asset directory at startup
+    struct AssetDirectoryScan
+    {
+      std::vector<std::filesystem::path> files; // Relative to asset directory
+      std::unordered_multimap<std::string, uint32_t> fileNameIndex; // File name -> index of file
+      
+      /// This function returns true if file is found in scan
+      /// - Parameter filePath: file path relative to asset directory
+      bool Contains(const std::filesystem::path& filePath) const;
+    };
+    
+    /// This structure stores the failed asynchronous load of asset. Asset is not loaded again until it is reloaded or
+    /// its file is changed
+    struct FailedLoad
+    {
+      Ref<AssetLoadRequest> request;
+      std::filesystem::file_time_type writeTime; // Write time of file when load failed
+    };
+    
     // Member Functions ---------------------------------------------------------------------------------------------
-    /// This funciton loads the asset reguistry file path and update the registry data in manager
-    static void LoadAssetRegistry();
-    /// This function reload the assets stores in registry
-    static void ReloadAssets();
-    
-    /// This function process all the directory recursively
-    /// - Parameter baseDirectory: start directory
-    static void ProcessDirectory(const std::filesystem::path& baseDirectory);
+    /// This function scans the asset directory once. Sub directories are scanned in parallel on job system
+    static AssetDirectoryScan ScanAssetDirectory();
+    /// This funciton loads the asset reguistry file path and update the registry data in manager. Missing assets are
+    /// relocated with file name index of scan
+    /// - Parameter scan: asset directory scan
+    static void LoadAssetRegistry(const AssetDirectoryScan& scan);
+    /// This function imports the scanned files not present in registry
+    /// - Parameter scan: asset directory scan
+    static void ReloadAssets(const AssetDirectoryScan& scan);
     /// This funciton writes the registry data to file
     static void WriteRegistryToFile();
+    /// This function writes the registry data to file, or defers the write till end of transaction
+    static void OnRegistryChanged();
 
     /// This function returns the metada from handle
     /// - Parameter handle: Asset handle
     static AssetMetadata& GetMetadataInternal(AssetHandle handle);
+    /// This function completes the load request loaded by worker thread. Submits the recorded renderer commands and
+    /// stores the asset in loaded assets. Failed request is stored in failed loads and its commands are discarded
+    /// - Parameter request: load request
+    static void FinishLoadRequest(const Ref<AssetLoadRequest>& request);
+    /// This function removes the failed loads whose files are changed, so they are loaded again on next request
+    static void RetryChangedFailedLoads();
+    /// This function returns the last write time of asset file. Default time if file does not exist
+    /// - Parameter metadata: asset metadata
+    static std::filesystem::file_time_type GetFileWriteTime(const AssetMetadata& metadata);
+    /// This function stores the asset in loaded assets and tracks its residency
+    /// - Parameter asset: loaded asset
+    static void StoreLoadedAsset(const Ref<Asset>& asset);
 
     // Member Variables ---------------------------------------------------------------------------------------------
     inline static AssetRegistry s_assetRegistry;
+    inline static AssetDependencyGraph s_dependencyGraph;
     inline static std::unordered_map<AssetHandle, Ref<Asset>> s_memoryAssets;
     inline static std::unordered_map<AssetHandle, Ref<Asset>> s_loadedAssets;
+    inline static std::unordered_map<AssetHandle, Ref<AssetLoadRequest>> s_loadRequests; // Accessed on main thread only
+    inline static std::unordered_map<AssetHandle, FailedLoad> s_failedLoads; // Accessed on main thread only
+    inline static std::chrono::steady_clock::time_point s_lastFailedLoadCheck;
+    inline static std::unordered_map<AssetType, Ref<Asset>> s_placeholderAssets;
+    inline static std::vector<Ref<Asset>> s_evictedAssets; // Released in next frame
+    inline static uint32_t s_registryTransactionDepth {0};
+    inline static bool s_isRegistryChangedInTransaction {false};
+  };
+  
+  /// This class starts the asset registry transaction on construction and ends it on destruction. Use for bulk asset
+  /// changes, so that registry file is written once
+  class AssetRegistryTransaction
+  {
+  public:
+    /// This constructor starts the registry transaction
+    AssetRegistryTransaction() { AssetManager::BeginRegistryTransaction(); }
+    /// This destructor ends the registry transaction
+    ~AssetRegistryTransaction() { AssetManager::EndRegistryTransaction(); }
+    
+    DELETE_COPY_MOVE_CONSTRUCTORS(AssetRegistryTransaction);
   };
 } // namespace IKan
@@ -11,22 +11,35 @@
 
 namespace IKan
 {
-  /// This class stores the assets in registry for thier paths
+  /// This class stores the assets in registry for thier paths. Registry also keeps the index of handles, so that
+  /// metadata can be found from handle without iterating all the assets
   class AssetRegistry
   {
   public:
-    /// This operator retryrn the asset meta data from path
-    /// - Parameter path: asset file path
-    AssetMetadata& operator[](const std::filesystem::path& path);
+    /// This function stores the asset meta data for path. Replaces the metadata if path is already in registry
+    /// - Parameters:
+    ///   - path: asset file path
+    ///   - metadata: asset meta data
+    /// - Returns: metadata stored in registry
+    AssetMetadata& Set(const std::filesystem::path& path, const AssetMetadata& metadata);
     /// This function returns the Asset meta from path
     /// - Parameter path: Asset file path
     const AssetMetadata& Get(const std::filesystem::path& path) const;
+    /// This function returns the Asset meta from handle. Returns nullptr if handle is not in registry
+    /// - Parameter handle: Asset handle
+    AssetMetadata* TryGet(AssetHandle handle);
+    /// This function returns the Asset meta from handle. Returns nullptr if handle is not in registry
+    /// - Parameter handle: Asset handle
+    const AssetMetadata* TryGet(AssetHandle handle) const;
     
     /// This function returns the count of asset registry
     size_t Count() const;
     /// This function checks is asset registry have this path
     /// - Parameter path: Asset file path
     bool Contains(const std::filesystem::path& path) const;
+    /// This function checks is asset registry have this handle
+    /// - Parameter handle: Asset handle
+    bool Contains(AssetHandle handle) const;
     /// This function rremoves the asset from registry
     /// - Parameter path: Asset file path
     size_t Remove(const std::filesystem::path& handle);
@@ -34,6 +47,7 @@ namespace IKan
     void Clear();
     
     // Iterators ----------------------------------------------------------------------------------------------------
+    // Note: Handle of metadata must not be changed through iterators, as it is not updated in handle index
     std::unordered_map<std::filesystem::path, AssetMetadata>::iterator begin() { return m_assetRegistry.begin(); }
     std::unordered_map<std::filesystem::path, AssetMetadata>::iterator end() { return m_assetRegistry.end(); }
     std::unordered_map<std::filesystem::path, AssetMetadata>::const_iterator begin() const { return m_assetRegistry.cbegin(); }
@@ -43,5 +57,7 @@ namespace IKan
     
   private:
     std::unordered_map<std::filesystem::path, AssetMetadata> m_assetRegistry;
+    // Points to metadata stored in registry. Nodes of unordered map are never moved, so pointers stay valid on rehash
+    std::unordered_map<AssetHandle, AssetMetadata*> m_handleIndex;
   };
 } // namespace IKan
@@ -0,0 +1,103 @@
+//
+//  AssetResidency.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include <list>
+
+#include "Assets/Asset.hpp"
+
+namespace IKan
+{
+  /// This structure stores the residency statistics of one asset type
+  struct AssetResidencyStats
+  {
+    uint32_t assetCount {0};
+    uint64_t cpuBytes {0}, gpuBytes {0};
+    uint64_t peakBytes {0}; // Peak of CPU + GPU bytes
+    uint32_t evictedCount {0};
+
+    /// This function returns the total resident bytes in CPU and GPU
+    uint64_t GetTotalBytes() const { return cpuBytes + gpuBytes; }
+  };
+
+  /// This class tracks the approximate memory of assets loaded by asset manager. Assets are kept in least recently used
+  /// order, so that assets not referenced outside the asset manager can be evicted when resident memory exceeds budget.
+  /// Assets used in current or previous frame are never evicted, as they are requested again in next frame
+  /// - Note: Accessed on main thread only
+  class AssetResidency
+  {
+  public:
+    /// Eviction function. Returns false if asset can not be evicted now
+    using EvictFn = std::function<bool(AssetHandle)>;
+
+    /// Default residency budget in bytes
+    static constexpr uint64_t DefaultBudget = 1024ull * 1024 * 1024;
+
+    // Fundamentals ---------------------------------------------------------------------------------------------------
+    /// This function clears all the resident assets and statistics
+    static void Clear();
+
+    /// This function adds the loaded asset in residency as most recently used. Replaces the asset with same handle
+    /// - Parameter asset: loaded asset
+    static void OnAssetLoaded(const Ref<Asset>& asset);
+    /// This function removes the asset from residency
+    /// - Parameter assetHandle: asset handle
+    static void OnAssetUnloaded(AssetHandle assetHandle);
+    /// This function marks the asset as most recently used in current frame
+    /// - Parameter assetHandle: asset handle
+    static void Touch(AssetHandle assetHandle);
+    /// This function starts the next frame of residency. Should be called once per frame before eviction
+    static void NextFrame();
+
+    /// This function evicts the least recently used assets until resident memory is under budget. Assets without any
+    /// memory cost or used in current or previous frame are never evicted
+    /// - Parameter evictFunc: function that unloads the asset. Residency entry is removed by this function
+    /// - Returns: number of evicted assets
+    static uint32_t Evict(const EvictFn& evictFunc);
+
+    // Setters --------------------------------------------------------------------------------------------------------
+    /// This function updates the residency budget
+    /// - Parameter budget: budget of CPU + GPU memory in bytes
+    static void SetBudget(uint64_t budget);
+
+    // Getters --------------------------------------------------------------------------------------------------------
+    /// This function returns the residency budget in bytes
+    static uint64_t GetBudget();
+    /// This function returns the resident bytes of all assets
+    static uint64_t GetResidentBytes();
+    /// This function returns the peak resident bytes of all assets
+    static uint64_t GetPeakResidentBytes();
+    /// This function returns the residency statistics of asset type
+    /// - Parameter type: asset type
+    static const AssetResidencyStats& GetStats(AssetType type);
+
+    DELETE_ALL_CONSTRUCTORS(AssetResidency);
+
+  private:
+    /// This structure stores the resident asset
+    struct Entry
+    {
+      AssetHandle handle {0};
+      AssetType type {AssetType::Invalid};
+      uint64_t cpuBytes {0}, gpuBytes {0};
+      uint64_t lastUsedFrame {0};
+    };
+
+    /// This function removes the entry and updates the statistics
+    /// - Parameter it: entry iterator
+    static void RemoveEntry(std::list<Entry>::iterator it);
+
+    // Member Variables ---------------------------------------------------------------------------------------------
+    inline static std::list<Entry> s_entries; // Most recently used first
+    inline static std::unordered_map<AssetHandle, std::list<Entry>::iterator> s_entryMap;
+    inline static std::unordered_map<AssetType, AssetResidencyStats> s_stats;
+    inline static uint64_t s_budget {DefaultBudget};
+    inline static uint64_t s_residentBytes {0}, s_peakResidentBytes {0};
+    inline static uint64_t s_frameIndex {0};
+  };
+} // namespace IKan
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <atomic>
+
 namespace IKan
 {
   /// This structure stores the data in a buffer as bytes. Allocate the memory in heap on cosntruction and de-allocate
@@ -90,6 +92,6 @@ namespace IKan
     void Dealocate();
     
     // Stores the Total allocation made in program using Buffer class
-    inline static uint32_t s_allocatedBytes {0};
+    inline static std::atomic<uint32_t> s_allocatedBytes {0};
   };
 } // namespace IKan
@@ -18,6 +18,10 @@ namespace IKan
   
   // MACRO to execute render commands in a queue
 #define RENDER_COMMAND_QUEUE_ENABLED 1
+  
+  // MACRO to define the number of render command queues. Main thread records in one queue while render thread executes
+  // the other (Used only with ThreadingPolicy::MultiThreaded)
+#define RENDER_COMMAND_QUEUE_COUNT 2
 
   // This MACRO Shifts the LSB bit of number 1 at position x
 #define BIT(x) (1 << x)
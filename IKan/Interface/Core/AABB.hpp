@@ -16,5 +16,14 @@ namespace IKan
     
     AABB() {}
     AABB(const glm::vec3& min, const glm::vec3& max) : min(min), max(max) {}
+    
+    /// This function returns the AABB enclosing this box transformed by 'transform'
+    /// - Parameter transform: transform matrix
+    AABB Transformed(const glm::mat4& transform) const
+    {
+      const glm::vec3 center = glm::vec3(transform * glm::vec4((min + max) * 0.5f, 1.0f));
+      const glm::vec3 extents = glm::mat3(glm::vec3(glm::abs(transform[0])), glm::vec3(glm::abs(transform[1])), glm::vec3(glm::abs(transform[2]))) * ((max - min) * 0.5f);
+      return AABB(center - extents, center + extents);
+    }
   };
 } // namespace IKan
@@ -12,6 +12,8 @@
 #include "Core/Window.hpp"
 #include "Events/ApplicationEvents.h"
 #include "Renderer/Renderer.hpp"
+#include "Renderer/RenderThread.hpp"
+#include "Core/JobSystem.hpp"
 #include "UI/ImGuiLayer.hpp"
 
 namespace IKan
@@ -22,6 +24,8 @@ namespace IKan
     std::string name {"IKan"};
     WindowSpecification windowSpecification;
     RendererType rendererType {RendererType::Invalid};
+    ThreadingPolicy threadingPolicy {ThreadingPolicy::SingleThreaded};
+    uint32_t workerThreadCount {0}; // 0 : (hardware concurrency - 1)
     std::filesystem::path iniFilePath {};
     bool startMaximized {false};
     bool resizable {true};
@@ -135,6 +139,9 @@ namespace IKan
     bool WindowMaximize(WindowMaximizeEvent& windowMaximizeEvent);
     /// This function begin the ImGui Renderer and render ImGui for all the layers and finally ends the imgui rendering
     void RenderImGui();
+    /// This function ends the frame when renderer is multi threaded. Waits for render thread to complete the last
+    /// frame, renders the GUI on main thread and kicks the render thread for current frame
+    void EndFrameMultiThreaded();
 
     // Member Variables -----------------------------------------------------------------------------------------------
     bool m_isRunning {false};
@@ -144,6 +151,7 @@ namespace IKan
     LayerStack m_layers;
     Scope<Window> m_window;
     Ref<UI::ImGuiLayer> m_imguiLayer;
+    RenderThread m_renderThread;
 
     // Single Instance
     inline static Application* s_instance {nullptr};
@@ -0,0 +1,56 @@
+//
+//  Frustum.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "Core/AABB.hpp"
+
+namespace IKan
+{
+  /// This structure stores the AABBs of 'Width' boxes in SoA layout, so that one frustum plane is tested against all
+  /// boxes of packet with vector operations
+  struct AABBPacket
+  {
+    static constexpr uint32_t Width = 4;
+    glm::vec4 minX, minY, minZ;
+    glm::vec4 maxX, maxY, maxZ;
+    
+    /// This function stores the box at lane of packet
+    /// - Parameters:
+    ///   - lane: lane index in [0, Width)
+    ///   - aabb: box to be stored
+    void Set(uint32_t lane, const AABB& aabb);
+  };
+  
+  /// This structure stores the 6 planes of view frustum. Plane normals point inside the frustum
+  struct Frustum
+  {
+    /// Planes as (normal, distance): Left, Right, Bottom, Top, Near, Far
+    std::array<glm::vec4, 6> planes;
+    
+    /// This is the default constructor
+    Frustum() = default;
+    /// This constructor extracts the frustum planes from view projection matrix
+    /// - Parameter viewProjection: view projection matrix with Open GL clip space
+    explicit Frustum(const glm::mat4& viewProjection);
+    
+    /// This function returns true if AABB is inside or intersecting the frustum
+    /// - Parameter aabb: world space AABB
+    bool IsVisible(const AABB& aabb) const;
+    /// This function tests all boxes of packet against the frustum
+    /// - Parameter packet: world space AABBs
+    /// - Returns: visibility mask. Bit 'i' is set if box at lane 'i' is inside or intersecting the frustum
+    uint32_t Cull(const AABBPacket& packet) const;
+    /// This function tests the boxes stored in packets against the frustum
+    /// - Parameters:
+    ///   - packets: world space AABBs packed in SoA packets
+    ///   - boxCount: number of boxes in packets. Unused lanes of last packet are ignored
+    ///   - visibility: visibility of each box. Resized to box count
+    /// - Returns: number of visible boxes
+    uint32_t Cull(const std::vector<AABBPacket>& packets, uint32_t boxCount, std::vector<uint8_t>& visibility) const;
+  };
+} // namespace IKan
@@ -0,0 +1,53 @@
+//
+//  JobSystem.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include <functional>
+
+namespace IKan
+{
+  /// This class manages the pool of worker threads to execute the jobs off the main thread
+  /// - Note: If job system is not initialized, all the APIs execute the jobs on calling thread
+  class JobSystem
+  {
+  public:
+    /// Job function type
+    using JobFn = std::function<void()>;
+    /// Parallel for function type. Argument is the index of job
+    using ParallelForFn = std::function<void(uint32_t)>;
+
+    // Fundamentals ---------------------------------------------------------------------------------------------------
+    /// This function creates the worker threads
+    /// - Parameter workerCount: number of worker threads. If 0 then uses (hardware concurrency - 1)
+    static void Initialize(uint32_t workerCount = 0);
+    /// This function waits for all the queued jobs and destroys the worker threads
+    static void Shutdown();
+
+    // Jobs -----------------------------------------------------------------------------------------------------------
+    /// This function queues the job to be executed on any worker thread
+    /// - Parameter job: job function
+    static void Execute(JobFn job);
+    /// This function executes the 'job' for each index in [0, count) on worker threads and calling thread. Blocks the
+    /// calling thread until all the jobs are completed
+    /// - Parameters:
+    ///   - count: number of jobs
+    ///   - job: job function with index argument
+    /// - Note: Executes on calling thread in order if called from worker thread
+    static void ParallelFor(uint32_t count, const ParallelForFn& job);
+
+    // Getters --------------------------------------------------------------------------------------------------------
+    /// This function returns the number of worker threads
+    static uint32_t GetWorkerCount();
+    /// This function returns true if job system is initialized
+    static bool IsInitialized();
+    /// This function returns true if called from worker thread
+    static bool IsWorkerThread();
+
+    DELETE_ALL_CONSTRUCTORS(JobSystem);
+  };
+} // namespace IKan
@@ -12,6 +12,9 @@
 
 namespace IKan
 {
+  // Forward Declaration
+  class RendererContext;
+
   /// This structure stores the window specification data
   struct WindowSpecification
   {
@@ -82,6 +85,8 @@ namespace IKan
     virtual void* GetNativeWindow() const = 0;
     /// This function returns the title of the window.
     virtual std::string_view GetTitle() const = 0;
+    /// This function returns the renderer context of the window.
+    virtual RendererContext* GetRendererContext() const = 0;
   };
   
   /// This structure stores the API to create the window instance based on the supported platform
@@ -0,0 +1,26 @@
+//
+//  Benchmark.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+namespace IKan
+{
+  /// This class runs the engine benchmarks headless. Commands are executed by Null renderer on calling thread and asset
+  /// or scene benchmarks use a temporary project. Each benchmark logs its timings and checks its results
+  /// - Note: Should be used without Application instance. Loggers should be created before running benchmarks
+  class Benchmark
+  {
+  public:
+    /// This function runs the benchmarks. Temporary project is created in new directory under system temporary
+    /// directory and removed once benchmarks are completed
+    /// - Parameter filter: only benchmarks having filter in their name are executed. All if empty
+    /// - Returns: false if any benchmark check is failed or temporary project can not be created
+    static bool Run(std::string_view filter);
+
+    DELETE_ALL_CONSTRUCTORS(Benchmark);
+  };
+} // namespace IKan
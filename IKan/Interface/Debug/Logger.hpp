@@ -15,7 +15,8 @@ namespace IKan
   /// This enum stores the module names of IKan Logs (Holds only IKan engine log module names)
 #define LogModule(f) \
 f(None) \
-f(Application) f(Layers) f(Window) \
+f(Application) f(Layers) f(Window) f(JobSystem) \
+f(Benchmark) \
 f(Renderer) f(Renderer2D) f(TextRenderer) f(Font) f(Mesh) f(Material) f(MaterialAsset) f(SceneRenderer) \
 f(Texture) f(VertexBuffer) f(IndexBuffer) f(BufferLayout) f(Shader) f(Pipeline) f(FrameBuffer) \
 f(UI) \
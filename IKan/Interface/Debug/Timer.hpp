@@ -8,6 +8,7 @@
 #pragma once
 
 #include <chrono>
+#include <mutex>
 
 namespace IKan
 {
@@ -79,6 +80,7 @@ namespace IKan
     void Clear();
     
     /// This function returns the performance data
+    /// - Note: Should be read only when render thread is idle
     const std::unordered_map<const char*, float>& GetPerFrameData() const;
     
     /// This function returns the single instance of Performance profiler
@@ -91,6 +93,7 @@ namespace IKan
     PerformanceProfiler() = default;
     
     std::unordered_map<const char* /* function name */, float /* elapsed time */> m_perFrameData;
+    std::mutex m_mutex;
   };
   
   // Scope Performance Timer -----------------------------------------------------------------------------------------
@@ -46,6 +46,7 @@
 #include <Debug/LoggerSpecificationBuilder.hpp>
 #include <Debug/LoggerAPIs.h>
 #include <Debug/Timer.hpp>
+#include <Debug/Benchmark.hpp>
 
 #include <Utils/FileSystemUtils.hpp>
 #include <Utils/StringUtils.hpp>
@@ -65,9 +66,11 @@
 #include <Core/Window.hpp>
 #include <Core/Input.hpp>
 #include <Core/AABB.hpp>
+#include <Core/Frustum.hpp>
 #include <Core/UUID.hpp>
 #include <Core/HashGenerator.hpp>
 #include <Core/Ray.hpp>
+#include <Core/JobSystem.hpp>
 
 #include <UI/ImGuiLayer.hpp>
 
@@ -75,6 +78,7 @@
 #include <Renderer/RendererStats.hpp>
 #include <Renderer/Renderer2D.hpp>
 #include <Renderer/Mesh.hpp>
+#include <Renderer/MeshBVH.hpp>
 #include <Renderer/Materials.hpp>
 #include <Renderer/SceneRenderer.hpp>
 
@@ -106,3 +110,5 @@
 #include <Scene/SceneSerializer.hpp>
 #include <Scene/EntitySerializer.hpp>
 #include <Scene/ECS_Utils.hpp>
+#include <Scene/SceneBVH.hpp>
+#include <Scene/TransformSystem.hpp>
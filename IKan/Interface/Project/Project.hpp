@@ -37,6 +37,9 @@ namespace IKan
     /// This funcion updates Scene type of project
     /// - Parameter sceneType: scene sceneType
     void UpdateSceneType(SceneType sceneType);
+    /// This funcion updates the scene file format
+    /// - Parameter flag: save scenes in binary format
+    void UpdateBinaryScenes(bool flag);
 
     // Getter APIs ---------------------------------------------------------------------------------------------------
     /// This function returns the project config
@@ -66,6 +69,8 @@ namespace IKan
     static std::filesystem::path GetPhysicsDirectory();
     /// This function returns the project prefab path
     static std::filesystem::path GetPrefabDirectory();
+    /// This function returns the project cache path. Stores the cooked data generated from assets
+    static std::filesystem::path GetCacheDirectory();
 
     /// This function returns the absolute file path of asset
     /// - Parameter assetRelativePath: asset relative path
@@ -34,6 +34,7 @@ namespace IKan
     std::filesystem::path startScene{};
     bool enableAutoSave {false};
     int32_t autoSaveIntervalSeconds {300};
+    bool binaryScenes {false};
     
     // Not serialized
     std::string projectFileName;
@@ -16,7 +16,10 @@ namespace IKan
     Float, Float2, Float3, Float4,
     Mat3, Mat4,
     Int, Int2, Int3, Int4,
-    Bool
+    Bool,
+    Half2, Half4, // 16 bit floats
+    Short2,       // 16 bit signed integers. Use normalized element to read as float in [-1, 1]
+    UByte4        // 8 bit unsigned integers. Use normalized element to read as float in [0, 1]
   };
   
   // Buffer Element ---------------------------------------------------------------------------------------------------
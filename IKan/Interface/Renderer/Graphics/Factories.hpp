@@ -19,6 +19,7 @@ namespace IKan
   class RendererAPI;
   class Texture;
   class Image;
+  class TextureArray;
   class VertexBuffer;
   class IndexBuffer;
   class Shader;
@@ -52,9 +53,9 @@ namespace IKan
     /// This API creates the Texture instance with white data based on the current Supported API
     [[nodiscard]] static Ref<Texture> CreateWhiteTexture();
     
-    /// This function creates Character texture to render text
-    /// - Parameter spec: Character Texture specification
-    [[nodiscard]] static Ref<Texture> Create(const CharTextureSpecification& charTextureSpec);
+    /// This function creates the 2D texture array based on the current Supported API
+    /// - Parameter spec: Texture array specification
+    [[nodiscard]] static Ref<TextureArray> Create(const TextureArraySpecification& spec);
     
     /// This static functions creates the Texture from image file
     /// - Parameter spec: Texture specification
@@ -23,6 +23,12 @@ namespace IKan
     virtual void Bind() const = 0;
     /// This function unbinds the current Pipeline from the renderer
     virtual void Unbind() const = 0;
+    /// This function sets the buffer of per instance attributes of instance layout for next instanced draws
+    /// - Parameters:
+    ///   - instanceBuffer: vertex buffer having instance data
+    ///   - offset: offset of first instance in buffer (in bytes)
+    /// - Note: Pipeline should be bound
+    virtual void SetInstanceBuffer(const Ref<VertexBuffer>& instanceBuffer, uint32_t offset) const = 0;
     
     /// This function returns the renderer ID of Vertex Buffer
     virtual RendererID GetRendererID() const = 0;
@@ -62,5 +62,12 @@ namespace IKan
     ///   - indicesData: indices data
     ///   - baseVertex: base vertex
     virtual void DrawIndexedBaseVertex(uint32_t indexCount, void* indicesData, uint32_t baseVertex) const = 0;
+    /// This function draw the index based vertex for multiple instances
+    /// - Parameters:
+    ///   - indexCount: index count
+    ///   - indicesData: indices data
+    ///   - baseVertex: base vertex
+    ///   - instanceCount: number of instances
+    virtual void DrawIndexedBaseVertexInstanced(uint32_t indexCount, void* indicesData, uint32_t baseVertex, uint32_t instanceCount) const = 0;
   };
 } // namespace IKan
@@ -20,5 +20,9 @@ namespace IKan
     virtual ~RendererContext() = default;
     /// This function swaps the graphics buffer. This should be called each frame
     virtual void SwapBuffers() = 0;
+    /// This function makes the context current on the calling thread
+    virtual void MakeCurrent() = 0;
+    /// This function releases the context from the calling thread
+    virtual void ReleaseCurrent() = 0;
   };
 } // namespace IKan
@@ -9,9 +9,6 @@
 
 #include "Renderer/Graphics/BufferLayout.hpp"
 
-// Freetype forward declaration
-typedef struct FT_FaceRec_*  FT_Face;
-
 namespace IKan
 {
   // Forward declaration
@@ -86,14 +83,20 @@ namespace IKan
     bool enableDebugLogs {true};
   };
   
-  /// This structure stores the Texture specification for character rendering
-  struct CharTextureSpecification
+  /// This structure stores the specification of 2D texture array. All layers have same size and RGBA8 format
+  struct TextureArraySpecification
   {
-    FT_Face face;
-    glm::ivec2 size;
-    glm::ivec2 bearing;
-    uint32_t advance;
-    char charVal;
+    std::string title {"Empty Texture Array"};
+    
+    uint32_t width {1};
+    uint32_t height {1};
+    uint32_t layers {1};
+    
+    TextureWrap Xwrap {TextureWrap::Repeat};
+    TextureWrap Ywrap {TextureWrap::Repeat};
+    
+    TextureFilter minFilter {TextureFilter::Linear};
+    TextureFilter magFilter {TextureFilter::Linear};
   };
   
   /// This structure stores the Texture specification for images
@@ -115,6 +118,7 @@ namespace IKan
   {
     std::string debugName {};
     BufferLayout vertexLayout;
+    BufferLayout instanceLayout; // Per instance attributes, located after vertex attributes
     Ref<Shader> shader;
   };
 
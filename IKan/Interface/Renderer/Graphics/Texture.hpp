@@ -31,6 +31,14 @@ namespace IKan
     ///   - depthID : Depth Attachment ID to Framebuffer
     ///   - attachmentType: attachment type of texture
     virtual void AttachToFramebuffer(TextureAttachment attachmentType, uint32_t colorID = 0, uint32_t depthID = 0, uint32_t level = 0) const = 0;
+    /// This function updates the region of texture. Data is copied, so it can be changed after calling this function
+    /// - Parameters:
+    ///   - data: data of region in texture data format
+    ///   - x: x offset of region
+    ///   - y: y offset of region
+    ///   - width: width of region
+    ///   - height: height of region
+    virtual void SetData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
     
     /// This function returns the Renderer ID of Texture
     virtual RendererID GetRendererID() const = 0;
@@ -51,22 +59,31 @@ namespace IKan
     virtual const std::filesystem::path& GetfilePath() const = 0;
     /// This function returns name of texture
     virtual const std::string& GetName() const = 0;
+    /// This function returns the specification of image
+    virtual const Imagespecification& GetSpecification() const = 0;
     
     ASSET_TYPE(Image);
   };
   
-  /// This class is the interface for creating texture for character text
-  class CharTexture : public Texture
+  /// This class is the interface to create 2D texture array. Layers are filled by copying the textures at origin of layer
+  class TextureArray : public Texture
   {
   public:
     /// Default virtual destructor
-    virtual ~CharTexture() = default;
+    virtual ~TextureArray() = default;
     
-    /// This function returns the Size of Freetpe face
-    virtual glm::ivec2 GetSize() const = 0;
-    /// This function returns the Bearing of Freetpe face
-    virtual glm::ivec2 GetBearing() const = 0;
-    /// This function returns the Advance of Freetpe face
-    virtual uint32_t GetAdvance() const = 0;
+    /// This function copies the texture in layer of array. Texture is copied on GPU at origin of layer
+    /// - Parameters:
+    ///   - texture: texture not bigger than array
+    ///   - layer: layer index
+    virtual void CopyToLayer(const Ref<Texture>& texture, uint32_t layer) = 0;
+    /// This function copies the first layers of other array in this array. Used to grow the array. Layers are copied
+    /// on GPU
+    /// - Parameters:
+    ///   - source: texture array of same size
+    ///   - layerCount: number of layers to be copied
+    virtual void CopyLayers(const Ref<TextureArray>& source, uint32_t layerCount) = 0;
+    /// This function returns the number of layers in array
+    virtual uint32_t GetLayerCount() const = 0;
   };
 } // namespace IKan
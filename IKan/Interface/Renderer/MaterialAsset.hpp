@@ -77,6 +77,8 @@ void Set##title##Map(Ref<Image> texture); \
     
     /// This function returns the material
     Ref<Material> GetMaterial();
+    /// This function returns the size of material data in CPU. Images are resident assets of their own
+    uint64_t GetCPUMemorySize() const override;
     
     /// This function creates material asset
     static Ref<MaterialAsset> Create();
@@ -17,6 +17,15 @@ namespace IKan
   class Material
   {
   public:
+    /// This structure stores the copy of material uniform buffers. Used to override the uniforms per draw without
+    /// changing the material, so that same material can be recorded from multiple threads
+    struct UniformStorage
+    {
+      Buffer vsUniformStorageBuffer;
+      Buffer fsUniformStorageBuffer;
+      Buffer gsUniformStorageBuffer;
+    };
+    
     /// This constructor creates the material with shader
     /// - Parameter shader: shader reference
     Material(const Ref<Shader>& shader);
@@ -26,11 +35,25 @@ namespace IKan
     /// This function binds the material and upload all the shader data. Binds all the loaded image to shader slot.
     /// To be called before rendering any scene
     void Bind();
+    /// This function binds the material with uniform data of 'storage' instead of material uniform buffers
+    /// - Parameter storage: uniform storage created by CreateUniformStorage()
+    void Bind(const UniformStorage& storage) const;
+    /// This function uploads the uniform data of 'storage' to shader. Shader should be bound before
+    /// - Parameter storage: uniform storage created by CreateUniformStorage()
+    void UploadUniforms(const UniformStorage& storage) const;
+    /// This function binds the material textures that are not already bound at their slots
+    /// - Parameters:
+    ///   - boundTextures: textures bound at each slot. Updated with the textures bound by this material
+    ///   - skippedBinds: incremented for each texture that was already bound
+    /// - Returns: number of textures bound
+    uint32_t BindTextures(std::vector<const Texture*>& boundTextures, uint32_t& skippedBinds) const;
     /// This function unbinds the material. To be called after rendering any scene
     void Unbind();
     
     /// This function returns the name of Material
     const Ref<Shader>& GetShader() const;
+    /// This function returns the size of uniform buffers stored in material
+    uint64_t GetUniformStorageSize() const;
     
     /// This fucntion uploads the date to material of type T
     /// - Parameters:
@@ -43,6 +66,20 @@ namespace IKan
       buffer.Write((std::byte*)& value, decl->GetSize(), decl->GetOffset());
     }
     
+    /// This fucntion uploads the date of type T to uniform storage. Material is not modified
+    /// - Parameters:
+    ///   - storage: uniform storage created by CreateUniformStorage()
+    ///   - name: name of uniform store in shader
+    ///   - value: value
+    template <typename T> void Set(UniformStorage& storage, const std::string& name, const T& value) const
+    {
+      const ShaderUniformDeclaration* decl = FindUniformDeclaration(name);
+      Buffer& buffer = GetUniformBufferTarget(decl, storage);
+      buffer.Write((std::byte*)& value, decl->GetSize(), decl->GetOffset());
+    }
+    /// This function returns the copy of current uniform buffers of material
+    UniformStorage CreateUniformStorage() const;
+    
     /// This fucntion returns the data from material of type T
     /// - Parameters:
     ///   - name: name of uniform store in shader
@@ -86,20 +123,25 @@ namespace IKan
     // Member Functions ----------------------------------------------------------------------------------------------
     /// This function finds the uniform from shader
     /// - Parameter name: unfiorm name
-    ShaderUniformDeclaration* FindUniformDeclaration(const std::string& name);
+    ShaderUniformDeclaration* FindUniformDeclaration(const std::string& name) const;
     /// This function finds the resource from shader
     /// - Parameter name: resource name
     ShaderResourceDeclaration* FindResourceDeclaration(const std::string& name);
     /// This funcreion returns the buffer stored for shader
     /// - Parameter uniformDeclaration: uniform declaration instance
     Buffer& GetUniformBufferTarget(ShaderUniformDeclaration* uniformDeclaration);
+    /// This funcreion returns the buffer of uniform storage
+    /// - Parameters:
+    ///   - uniformDeclaration: uniform declaration instance
+    ///   - storage: uniform storage
+    Buffer& GetUniformBufferTarget(const ShaderUniformDeclaration* uniformDeclaration, UniformStorage& storage) const;
     
     /// This funtion allocate memory to store shader data in buffer
     void AllocateStorage();
     /// This function binds all the image to be stored in shader material
-    void BindTextures();
+    void BindTextures() const;
     /// This function unbinds all the image to be stored in shader material
-    void UnbindTextures();
+    void UnbindTextures() const;
 
     // Member Functions ----------------------------------------------------------------------------------------------
     Ref<Shader> m_shader;
@@ -12,6 +12,7 @@
 #include "Renderer/Graphics/Pipeline.hpp"
 #include "Renderer/Graphics/RendererBuffer.hpp"
 #include "Assets/Asset.hpp"
+#include "Renderer/MeshBVH.hpp"
 
 // Assimp forward declaration
 class aiScene;
@@ -19,27 +20,43 @@ class aiNode;
 
 namespace IKan
 {
-  /// This sturcture stores Vertex of Static Submesh
-  struct StaticVertex
+  static const std::string CookedMeshExtension {".ikmesh"};
+  
+  /// This enum stores the vertex format of mesh in renderer buffer
+  enum class MeshVertexFormat : uint8_t
+  {
+    Compact,            // Float positions
+    CompactHalfPosition // Half float positions. Only for meshes with small extent in mesh space
+  };
+  
+  /// This sturcture stores compact Vertex of Static Submesh. Normal, tangent and bitangent are octahedral encoded in
+  /// two 16 bit snorms and texture coordinates are two 16 bit floats
+  struct CompactVertex
   {
     glm::vec3 position;
-    glm::vec3 normal;
-    glm::vec2 textureCoords;
-    glm::vec3 tangent;
-    glm::vec3 biTangent;
+    uint32_t normal;
+    uint32_t textureCoords;
+    uint32_t tangent;
+    uint32_t biTangent;
   };
+  static_assert(sizeof(CompactVertex) == 28, "Invalid compact vertex size");
   
-  /// This structure stores the index information of each submesh
-  struct Index
+  /// This sturcture stores compact Vertex of Static Submesh with half float position. Last component of position is
+  /// padding to keep the vertex 4 byte aligned
+  struct CompactHalfVertex
   {
-    uint32_t V1, V2, V3;
+    uint16_t position[4];
+    uint32_t normal;
+    uint32_t textureCoords;
+    uint32_t tangent;
+    uint32_t biTangent;
   };
+  static_assert(sizeof(CompactHalfVertex) == 24, "Invalid compact half vertex size");
   
-  /// This structure stores the triangele coordinate
-  struct Triangle
+  /// This structure stores the index information of each submesh
+  struct Index
   {
-    StaticVertex V0, V1, V2;
-    Triangle(const StaticVertex& v0, const StaticVertex& v1, const StaticVertex& v2) : V0(v0), V1(v1), V2(v2) {}
+    uint32_t V1, V2, V3;
   };
   
   /// This structure stores submesh content
@@ -57,39 +74,54 @@ namespace IKan
     std::string nodeName, meshName;
   };
   
-  /// This class loads the mesh using assimp
+  /// This class loads the mesh using assimp. Imported data is cooked in binary '.ikmesh' file, keyed by hash of source
+  /// file, import flags and vertex format. Next loads read the cooked file and skip assimp until source file changes
   class Mesh : public Asset
   {
   public:
     /// This Constructor loads the mesh from assimp library and store the data
-    /// - Parameter filePath: mesh model file path
-    Mesh(const std::filesystem::path& filePath);
+    /// - Parameters:
+    ///   - filePath: mesh model file path
+    ///   - vertexFormat: vertex format in renderer buffer
+    Mesh(const std::filesystem::path& filePath, MeshVertexFormat vertexFormat = MeshVertexFormat::Compact);
     /// This destructor destroys the loaded mesh and delete all the data
     virtual ~Mesh();
     
     // Getters -------------------------------------------------------------------------------------------------------
     /// This function returns the submeshes
     const std::vector<SubMesh>& GetSubMeshes() const;
-    /// This function returns the Vertices
+    /// This function returns the bounding box enclosing all submeshes in mesh space
+    const AABB& GetBoundingBox() const;
+    /// This function returns the vertex positions. Triangles of submesh are the indices from 'baseIndex / 3' with
+    /// vertices from 'baseVertex'
     const std::vector<glm::vec3>& GetVertices() const;
     /// This function returns the Indices
     const std::vector<Index>& GetIndices() const;
-    /// This function returns the submeshes
-    /// - Parameter submeshIndex: This function returns the triangle cache
-    const std::vector<Triangle>& GetTriangleCache(uint32_t submeshIndex) const;
+    /// This function returns the vertex format of renderer buffer
+    MeshVertexFormat GetVertexFormat() const;
+    /// This function returns the triangle hierarchy of submesh for ray intersection. Hierarchy is built on first use
+    /// and cached in mesh
+    /// - Parameter submeshIndex: submesh index
+    const MeshBVH& GetBVH(uint32_t submeshIndex) const;
     /// This function returns the mesh pipeline
     const Ref<Pipeline>& GetPipeline() const;
+    /// This function returns the size of mesh data in CPU
+    uint64_t GetCPUMemorySize() const override;
+    /// This function returns the size of vertex and index buffers in GPU
+    uint64_t GetGPUMemorySize() const override;
     
     /// This Function creates the mesh from assimp library and store the data
-    /// - Parameter filePath: mesh model file path
-    [[nodiscard]] static Ref<Mesh> Create(const std::filesystem::path& filePath);
+    /// - Parameters:
+    ///   - filePath: mesh model file path
+    ///   - vertexFormat: vertex format in renderer buffer
+    [[nodiscard]] static Ref<Mesh> Create(const std::filesystem::path& filePath, MeshVertexFormat vertexFormat = MeshVertexFormat::Compact);
     
     ASSET_TYPE(Mesh);
     DELETE_COPY_MOVE_CONSTRUCTORS(Mesh);
     
   private:
     // Member functions ----------------------------------------------------------------------------------------------
-    /// This function store the certices and indices of the mesh
+    /// This function store the certices and indices of the mesh. Vertices are packed in vertex format
     void StoreVerticesAndIndices();
     /// This function rocesses a node in a recursive fashion. Processes each individual mesh located at the node and
     /// repeats this process on its children nodes (if any).
@@ -99,7 +131,24 @@ namespace IKan
     ///   - level: level
     void TraverseNodes(aiNode* node, const glm::mat4& parentTransform = glm::mat4(1.0f), uint32_t level = 0);
     /// This function loads the graphics data in renderer buffers
-    void LoadGraphicsdata();
+    /// - Parameters:
+    ///   - vertexData: packed vertex data
+    ///   - vertexDataSize: size of packed vertex data in bytes
+    void LoadGraphicsdata(const void* vertexData, uint32_t vertexDataSize);
+    /// This function imports the mesh with assimp and stores the data
+    void ImportMesh();
+    
+    /// This function loads the mesh from cooked file. Graphics data is loaded directly from mapped file
+    /// - Parameters:
+    ///   - cookedPath: cooked file path
+    ///   - sourceHash: hash of source file
+    /// - Returns: false if cooked file is missing or stale
+    bool LoadCookedMesh(const std::filesystem::path& cookedPath, uint64_t sourceHash);
+    /// This function writes the imported mesh data in cooked file
+    /// - Parameters:
+    ///   - cookedPath: cooked file path
+    ///   - sourceHash: hash of source file
+    void WriteCookedMesh(const std::filesystem::path& cookedPath, uint64_t sourceHash) const;
     
     // Member variables ----------------------------------------------------------------------------------------------
     std::filesystem::path m_filePath {};
@@ -108,10 +157,12 @@ namespace IKan
     AABB m_boundingBox, m_worldBoundingBox;
     
     std::vector<SubMesh> m_submeshes;
-    std::vector<StaticVertex> m_staticVertices;
     std::vector<Index> m_indices;
     std::vector<glm::vec3> m_vertices;
-    std::unordered_map<uint32_t /*Submesh Index */, std::vector<Triangle>> m_triangleCache;
+    MeshVertexFormat m_vertexFormat {MeshVertexFormat::Compact};
+    std::vector<std::byte> m_packedVertices; // Released once uploaded to vertex buffer
+    mutable std::unordered_map<uint32_t /*Submesh Index */, Scope<MeshBVH>> m_bvhCache;
+    mutable std::mutex m_bvhMutex;
     
     // Graphics
     Ref<Pipeline> m_pipeline;
@@ -119,6 +170,6 @@ namespace IKan
     Ref<IndexBuffer> m_indexBuffer;
     
     // Assimp
-    const aiScene* m_scene;
+    const aiScene* m_scene {nullptr};
   };
 } // namespace IKan
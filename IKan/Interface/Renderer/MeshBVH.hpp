@@ -0,0 +1,71 @@
+//
+//  MeshBVH.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "Core/Ray.hpp"
+
+namespace IKan
+{
+  struct Index;
+  struct SubMesh;
+  
+  /// This class stores the bounding volume hierarchy of submesh triangles for ray intersection. Tree is built with
+  /// binned surface area heuristic and stores the triangle positions in leaf order
+  class MeshBVH
+  {
+  public:
+    /// This constructor builds the hierarchy of submesh triangles
+    /// - Parameters:
+    ///   - positions: vertex positions of mesh in mesh space
+    ///   - indices: triangle indices of mesh
+    ///   - submesh: submesh to be built
+    MeshBVH(const std::vector<glm::vec3>& positions, const std::vector<Index>& indices, const SubMesh& submesh);
+    
+    /// This function intersects the ray with triangles and returns the nearest hit
+    /// - Parameters:
+    ///   - ray: ray in mesh space
+    ///   - t: distance of nearest hit along ray
+    /// - Returns: true if any triangle is hit
+    bool Intersect(const Ray& ray, float& t) const;
+    
+    /// This function returns the number of nodes in hierarchy
+    uint32_t GetNodeCount() const;
+    
+    DELETE_COPY_MOVE_CONSTRUCTORS(MeshBVH);
+    
+  private:
+    /// Node of hierarchy. Leaf if count is not 0, then 'leftFirst' is first triangle. Else 'leftFirst' is the left
+    /// child and right child is just after it
+    struct Node
+    {
+      AABB bounds;
+      uint32_t leftFirst {0};
+      uint32_t count {0};
+    };
+    
+    /// Triangle positions stored in leaf order
+    struct TrianglePositions
+    {
+      glm::vec3 v0, v1, v2;
+    };
+    
+    // Member Functions ----------------------------------------------------------------------------------------------
+    /// This function splits the node with binned SAH. Node is kept as leaf if split is not cheaper
+    /// - Parameters:
+    ///   - nodeIndex: node index
+    ///   - centroids: centroids of triangles
+    void Subdivide(uint32_t nodeIndex, std::vector<glm::vec3>& centroids);
+    /// This function updates the bounds of node with its triangles
+    /// - Parameter nodeIndex: node index
+    void UpdateBounds(uint32_t nodeIndex);
+    
+    // Member Variables ----------------------------------------------------------------------------------------------
+    std::vector<Node> m_nodes;
+    std::vector<TrianglePositions> m_triangles;
+  };
+} // namespace IKan
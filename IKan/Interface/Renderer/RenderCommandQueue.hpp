@@ -7,36 +7,74 @@
 
 #pragma once
 
-namespace IKan 
+namespace IKan
 {
-  /// This class stores the renderer commands in a queue to execute them in one go. By default stores 10MB memory
+  /// This class stores the renderer commands in a queue to execute them in one go. Commands are stored in a chunked
+  /// arena of linked pages. A new page is linked when current page can not fit the command, so queue never overflows.
+  /// Pages are reused in next frames and never memset. By default each page is of 1MB
   class RenderCommandQueue
   {
   public:
-    typedef void(*RenderCommandFn)(void*);
+    /// Render command function. Executes the command if 'execute' is true and always destroys the command
+    typedef void(*RenderCommandFn)(void*, bool execute);
 
-    /// This constructor initializes the queue buffer for renderer commands
-    /// - Parameter commandBufferSizeMB: command buffer size in MB: Default 10MB
-    RenderCommandQueue(uint8_t commandBufferSizeMB = 10);
-    /// This destructor destroys the queue buffer of renderer commands
+    /// Alignment of each command payload in queue
+    static constexpr uint32_t CommandAlignment = alignof(std::max_align_t);
+
+    /// This constructor initializes the first page of queue buffer for renderer commands
+    /// - Parameter pageSizeMB: size of each page in MB: Default 1MB
+    RenderCommandQueue(uint8_t pageSizeMB = 1);
+    /// This destructor destroys all the pages of renderer commands
     ~RenderCommandQueue();
-    
+
     /// This function allocates the memory for fucntion pointer in queue
     /// - Parameters:
     ///   - func: Render Command function pointer
     ///   - size: size of function
-    /// - Returns: Allocated memory pointer
+    /// - Returns: Allocated memory pointer (Aligned to CommandAlignment)
     void* Allocate(RenderCommandFn func, uint32_t size);
-    
+
     /// This function executes the render commands in queue
     void Execute();
-    
+    /// This function destroys the render commands in queue without executing them. Resources owned by commands (like
+    /// decoded data waiting to be uploaded) are released
+    /// - Note: Commands are not destroyed by destructor of queue. Queue having commands that are never executed should
+    ///         be discarded before it is destroyed
+    void Discard();
+
+    // Getters --------------------------------------------------------------------------------------------------------
+    /// This function returns the number of bytes used by commands recorded in queue
+    uint64_t GetUsedBytes() const;
+    /// This function returns the number of bytes reserved by all pages of queue
+    uint64_t GetReservedBytes() const;
+    /// This function returns the number of commands recorded in queue
+    uint32_t GetCommandCount() const;
+
     DELETE_COPY_MOVE_CONSTRUCTORS(RenderCommandQueue);
 
   private:
-    uint8_t* m_commandBuffer {nullptr};
-    uint8_t* m_commandBufferPtr {nullptr};
-    uint64_t m_commandBufferSize {0};
+    /// This structure stores the memory page of command arena
+    struct Page
+    {
+      uint8_t* buffer {nullptr};
+      uint64_t size {0};
+      uint64_t used {0};
+      Page* next {nullptr};
+    };
+
+    // Member Functions -----------------------------------------------------------------------------------------------
+    /// This function creates new page of commands
+    /// - Parameter size: size of page
+    Page* CreatePage(uint64_t size);
+    /// This function resets the used size of pages. Pages are kept for next frames
+    void ResetPages();
+
+    // Member Variables -----------------------------------------------------------------------------------------------
+    Page* m_firstPage {nullptr};
+    Page* m_currentPage {nullptr};
+    uint64_t m_pageSize {0};
+    uint64_t m_reservedBytes {0};
+    uint64_t m_usedBytes {0};
     uint32_t m_commandCount {0};
   };
 } // namespace IKan
@@ -0,0 +1,108 @@
+//
+//  RenderThread.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace IKan
+{
+  // Forward Declaration
+  class RendererContext;
+
+  /// This enum stores the threading policy of renderer
+  enum class ThreadingPolicy : uint8_t
+  {
+    /// Render commands are recorded and executed on main thread one after the other
+    SingleThreaded,
+    /// Render commands of frame N are executed on render thread while main thread records frame N + 1
+    MultiThreaded
+  };
+
+  /// This class manages the dedicated render thread that executes the render command queues
+  /// - Note: In ThreadingPolicy::SingleThreaded, no thread is created and all APIs execute the queue on calling thread
+  class RenderThread
+  {
+  public:
+    /// This enum stores the state of render thread
+    enum class State : uint8_t
+    {
+      Idle, Busy, Kick
+    };
+
+    /// This constructor creates the render thread instance
+    /// - Parameter threadingPolicy: threading policy of renderer
+    RenderThread(ThreadingPolicy threadingPolicy);
+    /// This destructor terminates the render thread if still running
+    ~RenderThread();
+
+    // Fundamentals ---------------------------------------------------------------------------------------------------
+    /// This function starts the render thread
+    /// - Parameter context: Renderer context to be made current on render thread while executing commands
+    /// - Note: Calling thread releases the renderer context
+    void Run(RendererContext* context);
+    /// This function flushes the last recorded frame, terminates the render thread and gives the renderer context back
+    /// to the calling thread
+    void Terminate();
+
+    // Synchronization ------------------------------------------------------------------------------------------------
+    /// This function blocks the calling thread until render thread is in 'waitForState'
+    /// - Parameter waitForState: state to be waited for
+    void Wait(State waitForState);
+    /// This function blocks the calling thread until render thread is in 'waitForState' and then sets the new state
+    /// - Parameters:
+    ///   - waitForState: state to be waited for
+    ///   - setToState: new state
+    void WaitAndSet(State waitForState, State setToState);
+    /// This function updates the state of render thread and notifies the waiting threads
+    /// - Parameter setToState: new state
+    void Set(State setToState);
+
+    // Frame Controller -----------------------------------------------------------------------------------------------
+    /// This function swaps the submission and render command queues. Should be called when render thread is idle
+    void NextFrame();
+    /// This function blocks the calling thread until the render thread executes the kicked frame
+    void BlockUntilRenderComplete();
+    /// This function kicks the render thread to execute the render command queue
+    void Kick();
+    /// This function swaps the queues, kicks the render thread and waits for the frame to be rendered
+    void Pump();
+
+    // Render Thread APIs ---------------------------------------------------------------------------------------------
+    /// This function makes the renderer context current on the calling thread
+    void AcquireContext();
+    /// This function releases the renderer context from the calling thread
+    void ReleaseContext();
+
+    // Getters --------------------------------------------------------------------------------------------------------
+    /// This function returns true if render thread is running
+    bool IsRunning() const;
+    /// This function returns the threading policy of render thread
+    ThreadingPolicy GetThreadingPolicy() const;
+
+    // Static APIs ----------------------------------------------------------------------------------------------------
+    /// This function returns true if called from render thread
+    static bool IsCurrentThreadRenderThread();
+
+    DELETE_COPY_MOVE_CONSTRUCTORS(RenderThread);
+
+  private:
+    // Member Variables -----------------------------------------------------------------------------------------------
+    ThreadingPolicy m_threadingPolicy {ThreadingPolicy::SingleThreaded};
+    RendererContext* m_context {nullptr};
+    std::thread m_thread;
+    std::atomic<bool> m_isRunning {false};
+
+    // Synchronization data
+    State m_state {State::Idle};
+    std::mutex m_mutex;
+    std::condition_variable m_conditionVariable;
+  };
+} // namespace IKan
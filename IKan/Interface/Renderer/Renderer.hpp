@@ -16,11 +16,13 @@ namespace IKan
   
   // Forward Declaration
   class Pipeline;
+  class RenderThread;
 
   /// This enum stores the supported renderer APIs by IKan engine
+  /// - Note: Null renderer makes no GPU call. It records the calls for headless benchmarks and tests
   enum class RendererType : uint8_t
   {
-    Invalid, OpenGL
+    Invalid, OpenGL, Null
   };
   
   /// Stores the capability of renderer
@@ -97,6 +99,13 @@ namespace IKan
     ///   - indicesData: indices data
     ///   - baseVertex: base vertex
     static void DrawIndexedBaseVertex(uint32_t indexCount, void* indicesData, uint32_t baseVertex);
+    /// This function draw the index based vertex for multiple instances
+    /// - Parameters:
+    ///   - indexCount: index count
+    ///   - indicesData: indices data
+    ///   - baseVertex: base vertex
+    ///   - instanceCount: number of instances
+    static void DrawIndexedBaseVertexInstanced(uint32_t indexCount, void* indicesData, uint32_t baseVertex, uint32_t instanceCount);
 
     // Render Command Queue -------------------------------------------------------------------------------------------
     /// This function submits the Renderer command in Queue
@@ -104,10 +113,14 @@ namespace IKan
     template<typename FuncT> static void Submit(FuncT&& func)
     {
 #if RENDER_COMMAND_QUEUE_ENABLED
-      static RenderCommandQueue::RenderCommandFn renderCmd = [](void* ptr)
+      static_assert(alignof(FuncT) <= RenderCommandQueue::CommandAlignment, "Render command is over aligned");
+      static RenderCommandQueue::RenderCommandFn renderCmd = [](void* ptr, bool execute)
       {
         FuncT* pFunc = (FuncT*)ptr;
-        (*pFunc)();
+        if (execute)
+        {
+          (*pFunc)();
+        }
         
         pFunc->~FuncT();
       };
@@ -118,12 +131,49 @@ namespace IKan
 #endif
     }
     
-    /// This funcion executes all the renderer commands in queue
+    /// This funcion executes all the renderer commands in submission queue on calling thread
+    /// - Note: Should not be called while render thread is running
     static void WaitAndRender();
+    /// This function waits for the render thread to be kicked and executes the render queue on render thread. Render
+    /// thread is set to idle once all commands are executed
+    /// - Parameter renderThread: render thread instance
+    static void WaitAndRender(RenderThread* renderThread);
+    /// This function is the loop of render thread. Executes the render queue each time render thread is kicked
+    /// - Parameter renderThread: render thread instance
+    static void RenderThreadFunc(RenderThread* renderThread);
+    /// This function swaps the submission and render queues. Commands recorded in submission queue are moved to render
+    /// queue and new commands are recorded in next queue
+    /// - Note: Should be called only when render thread is idle
+    static void SwapQueues();
+    /// This function records the render commands of 'chunkCount' chunks in parallel on job system worker threads. Each
+    /// chunk records into its own secondary command queue, which are executed in chunk order at the point of this call,
+    /// so the command stream is same as recording all chunks serially from 0 to 'chunkCount - 1'
+    /// - Parameters:
+    ///   - chunkCount: number of chunks to be recorded
+    ///   - recordFunc: function that submits the commands of chunk. Argument is the index of chunk
+    /// - Important: 'recordFunc' should only submit commands and read the shared data. Chunks are recorded serially
+    ///              if called from render thread or from inside of other parallel recording
+    static void RecordParallel(uint32_t chunkCount, const std::function<void(uint32_t)>& recordFunc);
+    /// This function records the render commands submitted by 'recordFunc' in 'queue' instead of submission queue. Used
+    /// to create the renderer resources off main thread (e.g. loading assets on job system worker threads)
+    /// - Parameters:
+    ///   - queue: queue in which commands are recorded
+    ///   - recordFunc: function that submits the commands
+    /// - Important: Recorded queue should be executed by a command submitted later from main thread, before any command
+    ///              that uses the created resources
+    static void RecordDeferred(RenderCommandQueue& queue, const std::function<void()>& recordFunc);
+    
+    /// This function returns the index of queue executed by render thread
+    static uint32_t GetRenderQueueIndex();
+    /// This function returns the index of queue in which commands are recorded
+    static uint32_t GetRenderQueueSubmissionIndex();
 
     DELETE_ALL_CONSTRUCTORS(Renderer);
     
   private:
+    /// This function returns the submission queue. If called from render thread while executing commands, returns the
+    /// render queue, so that nested commands are executed in same frame. If called while recording a parallel chunk,
+    /// returns the secondary queue of chunk
     static RenderCommandQueue* GetRenderCommandQueue();
   };
 } // namespace IKan
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "Renderer/UI/Font.hpp"
 
 namespace IKan
@@ -63,6 +65,19 @@ namespace IKan
     static void SubmitQuad(const glm::vec3& position, const glm::vec2& scale = Utils::Math::UnitVec2,
                            const glm::vec3& rotation = Utils::Math::ZeroVec3, const glm::vec4& color = Utils::Math::UnitVec4,
                            const Ref<Texture>& texture = nullptr, float tilingFactor = 1.0f, int32_t objectID = -1);
+    /// This function submits many quads to draw in batch renderer at once (e.g. particles). Data of each quad is
+    /// stored at same index in arrays
+    /// - Parameters:
+    ///   - transforms: Transformation matrices of Quads
+    ///   - colors: Colors of Quads. White if empty
+    ///   - textures: Textures used by Quads
+    ///   - textureIndices: Index in textures of each Quad. First texture is used by all if empty
+    ///   - tilingFactor: tiling factor of quads
+    ///   - objectID: Pixel/Entity ID of Quads
+    /// - Note: Faster than submitting each quad as stats and texture slots are updated once for quads of batch
+    static void SubmitQuads(std::span<const glm::mat4> transforms, std::span<const glm::vec4> colors = {},
+                            std::span<const Ref<Texture>> textures = {}, std::span<const uint16_t> textureIndices = {},
+                            float tilingFactor = 1.0f, int32_t objectID = -1);
     /// This functon draws Quad API with Texture with fixed camera with transform matrix
     /// - Parameters:
     ///   - transform: Transformation matrix of Quad
@@ -194,14 +209,15 @@ namespace IKan
   private:
     /// This function is the helper function to rendere the quad
     /// - Parameters:
-    ///   - transform: Transformation matrix of Quad
+    ///   - axisX: Transformed X axis of Quad
+    ///   - axisY: Transformed Y axis of Quad
+    ///   - position: Center of Quad
     ///   - color: Color of Quad
     ///   - texture: Texture to be uploaded in Batch
     ///   - tilingFactor: tiling factor of quad
-    ///   - textureCoords: Texture coordinates of quad
     ///   - objectID: Pixel/Entity ID of Quad
-    static void SubmitQuadImpl(const glm::mat4& transform, const glm::vec4& color, const Ref<Texture>& texture,
-                               float tilingFactor, const glm::vec2* textureCoords, int32_t objectID);
+    static void SubmitQuadImpl(const glm::vec3& axisX, const glm::vec3& axisY, const glm::vec3& position, const glm::vec4& color,
+                               const Ref<Texture>& texture, float tilingFactor, int32_t objectID);
     
     /// This function is the helper function to rendere the circle
     /// - Parameters:
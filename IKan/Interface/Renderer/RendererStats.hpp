@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <atomic>
+
 namespace IKan
 {
   /// This structure stores the statistics of renderer data
@@ -16,17 +18,49 @@ namespace IKan
     // Member Variables ----------------------------------------------------------------------------------------------
     uint64_t vertexBufferSize {0}, indexBufferSize {0}, textureBufferSize {0};
     uint32_t vertexCount {0}, indexCount {0};
-    uint32_t drawCalls {0};
+    std::atomic<uint32_t> drawCalls {0}; // Updated by command recording threads
     
     struct _2D
     {
-      uint32_t maxQuads {0}, maxCircles {0}, maxLines {0};
+      uint32_t maxQuads {0}, maxCircles {0}, maxLines {0}, maxChars {0};
       uint32_t quads {0}, circles {0}, lines {0}, chars {0};
+      uint32_t textLayoutHits {0}, textLayoutMisses {0}; // Text submitted with cached and new layout
     };
     
     // Stores the 2D Specific data
     _2D _2d;
     
+    struct CommandQueue
+    {
+      uint64_t frameBytes {0}, highWaterMark {0};
+      uint32_t frameCommands {0};
+      std::atomic<uint64_t> reservedBytes {0}; // Updated by command recording threads
+      std::atomic<uint32_t> pages {0};
+    };
+    
+    // Stores the render command queue data. Frame data is updated each time a frame queue is executed and includes the
+    // secondary queues executed by it
+    CommandQueue commandQueue;
+    
+    struct StateChanges
+    {
+      // Updated by command recording threads
+      std::atomic<uint32_t> shaderBinds {0}, materialBinds {0}, pipelineBinds {0}, textureBinds {0};
+      std::atomic<uint32_t> skippedShaderBinds {0}, skippedMaterialBinds {0}, skippedPipelineBinds {0}, skippedTextureBinds {0};
+    };
+    
+    // Stores the binds made and skipped by scene renderer in this frame
+    StateChanges stateChanges;
+    
+    struct Culling
+    {
+      uint32_t visibleSubmeshes {0};
+      uint32_t culledSubmeshes {0};
+    };
+    
+    // Stores the submesh draws tested against camera frustum by scene renderer in this frame
+    Culling culling;
+    
     // Member Functions ---------------------------------------------------------------------------------------------
     /// This function resets only those stats that need to be reset each frame
     void ResetEachFrame();
@@ -11,6 +11,7 @@
 #include "Renderer/MaterialAsset.hpp"
 #include "Renderer/Mesh.hpp"
 #include "Camera/Camera.hpp"
+#include "Core/Frustum.hpp"
 
 namespace IKan
 {
@@ -51,6 +52,10 @@ namespace IKan
     /// This funcion set the callback for debug renderer
     /// - Parameter func: callback funciton
     void SetDebugRenderer(const std::function<void()>& func);
+    /// This function enables the parallel recording of draw list. If disabled, all batches are recorded on calling
+    /// thread in frame queue
+    /// - Parameter enable: enable flag
+    void SetParallelRecording(bool enable);
 
     /// This function returns the final render pass image
     Ref<Texture> GetFinalImage() const;
@@ -65,23 +70,30 @@ namespace IKan
 
   private:
     // Member functions ---------------------------------------------------------------------------------------------
-    /// This function renders the mesh in geometry
+    /// This function returns the per frame index of resource. New index is assigned if resource is not indexed yet
     /// - Parameters:
-    ///   - mesh: Mesh to be render
-    ///   - transform: mesh transform
-    ///   - material: material
-    ///   - tilingFactor: tiling factor
-    void RenderMeshGeometry(Ref<Mesh> mesh, const glm::mat4& transform, float tilingFactor, Ref<Material> material);
-    /// This function renders the submesh
+    ///   - indexMap: per frame index map of resource
+    ///   - resource: resource pointer
+    static uint32_t GetFrameIndex(std::unordered_map<const void*, uint32_t>& indexMap, const void* resource);
+    /// This function culls the submeshes of sorted draw list outside the camera frustum. Visibility of each submesh draw
+    /// is stored in culling data
+    /// - Parameter frustum: camera frustum
+    void CullDrawList(const Frustum& frustum);
+    /// This function groups the visible submeshes of consecutive draws in sorted draw list having same mesh, material
+    /// and tiling factor in instanced batches and uploads the instance transforms of all batches to instance buffer
+    void BuildDrawBatches();
+    /// This function renders the instanced batches in range [begin, end). Shader, material, pipeline and texture binds
+    /// are skipped if already bound by previous batch in range
     /// - Parameters:
-    ///   - mesh: mesh
-    ///   - transform: mesh transform
-    ///   - material: material
-    void RenderSubmesh(Ref<Mesh> mesh, const glm::mat4& transform, Ref<Material> material);
+    ///   - begin: index of first batch
+    ///   - end: index after last batch
+    /// - Note: Only submits the commands and reads the batches. Can be called from multiple threads
+    void RenderDrawList(uint32_t begin, uint32_t end) const;
 
     // Member Variables ---------------------------------------------------------------------------------------------
     std::string m_debugName {"IKan Renderer"};
     uint32_t m_viewportWidth {0}, m_viewportHeight {0};
+    bool m_parallelRecording {true};
 
     // Debug Renderer from client
     std::function<void()> m_debugRenderer = []() {};
@@ -92,10 +104,43 @@ namespace IKan
     struct MeshDrawData
     {
       Ref<Mesh> mesh;
-      Ref<MaterialTable> materilTable;
+      uint32_t materialIndex;
       float tilingFactor;
       glm::mat4 transform;
     };
     std::vector<MeshDrawData> m_meshDrawList;
+    
+    /// Sort key of draw. Packs shader (12 bits) | material (16 bits) | mesh (16 bits) | depth (20 bits) from MSB
+    struct DrawSortEntry
+    {
+      uint64_t key;
+      uint32_t drawIndex;
+    };
+    std::vector<DrawSortEntry> m_sortedDrawList, m_sortScratch;
+    
+    // Culling data. World transform and visibility of each submesh draw in sorted order
+    std::vector<uint32_t> m_submeshDrawOffsets;
+    std::vector<glm::mat4> m_submeshTransforms;
+    std::vector<AABBPacket> m_cullingPackets;
+    std::vector<uint8_t> m_submeshVisibility;
+    
+    /// Instanced draw of submesh of consecutive draws in sorted draw list. Instance transforms are stored contiguously
+    /// in instance buffer from 'instanceOffset'
+    struct DrawBatch
+    {
+      uint32_t firstDraw;
+      uint32_t submeshIndex;
+      uint32_t instanceCount;
+      uint32_t instanceOffset;
+    };
+    std::vector<DrawBatch> m_drawBatches;
+    std::vector<glm::mat4> m_instanceTransforms;
+    Ref<VertexBuffer> m_instanceBuffer;
+    uint32_t m_instanceBufferCapacity {0};
+    
+    // Per frame data
+    std::unordered_map<const void*, uint32_t> m_shaderIndexMap, m_materialIndexMap, m_meshIndexMap;
+    std::vector<Ref<Material>> m_frameMaterials;
+    std::vector<Material::UniformStorage> m_frameMaterialUniforms;
   };
 } // namespace IKan
@@ -8,15 +8,34 @@
 #pragma once
 
 #include "Assets/Asset.hpp"
+#include "Renderer/UI/GlyphAtlas.hpp"
+
+// Freetype forward declaration
+typedef struct FT_LibraryRec_* FT_Library;
+typedef struct FT_FaceRec_* FT_Face;
 
 namespace IKan
 {
-  class CharTexture;
-
-  /// This class stores the font loaded as ttf file to be used to render the text
+  /// This class stores the font loaded as ttf file to be used to render the text. Glyphs are rendered as signed
+  /// distance field in glyph atlas of font when used first time, so any unicode character supported by font can be
+  /// rendered
   class Font : public Asset
   {
   public:
+    /// This structure stores the glyph metrics in pixels of font size and region of glyph in atlas
+    struct Glyph
+    {
+      uint32_t index {0}; // Glyph index in font, used for kerning
+      glm::vec2 size {0.0f}; // Size of glyph bitmap including distance field spread
+      glm::vec2 bearing {0.0f}; // Offset of bitmap left and top from pen position
+      float advance {0.0f};
+      bool visible {false}; // White spaces are not added in atlas
+      GlyphAtlas::Region region;
+    };
+
+    // Fixed Constants
+    static constexpr uint32_t PixelSize = 48;
+
     /// This constructor creates the font instance with filepath
     /// - Parameter filePath: font filepath
     Font(const std::filesystem::path& filePath);
@@ -26,9 +45,18 @@ namespace IKan
     // Getters -------------------------------------------------------------------------------------------------------
     /// This function returns the font file path
     const std::filesystem::path& GetFilePath() const;
-    /// This function returns the char texture from map
-    /// - Parameter charValue: char value
-    Ref<CharTexture> GetCharTexture(char charValue);
+    /// This function returns the glyph of code point. Glyph is added in atlas if not loaded yet
+    /// - Parameter codePoint: unicode code point
+    const Glyph& GetGlyph(char32_t codePoint);
+    /// This function returns the kerning between two glyphs in pixels
+    /// - Parameters:
+    ///   - left: glyph on left
+    ///   - right: glyph on right
+    float GetKerning(const Glyph& left, const Glyph& right) const;
+    /// This function returns the distance between two base lines in pixels
+    float GetLineHeight() const;
+    /// This function returns the glyph atlas of font
+    const GlyphAtlas& GetAtlas() const;
 
     // Static APIs ---------------------------------------------------------------------------------------------------
     /// This function initializes tha static data for fonts
@@ -46,8 +74,17 @@ namespace IKan
     ASSET_TYPE(Font);
 
   private:
+    /// This function renders the glyph as signed distance field and adds it in atlas
+    /// - Parameter codePoint: unicode code point
+    Glyph LoadGlyph(char32_t codePoint);
+
     std::filesystem::path m_filePath {};
-    std::map<char, Ref<CharTexture>> m_charTextureMap;
+    FT_Library m_library {nullptr};
+    FT_Face m_face {nullptr};
+    bool m_hasKerning {false};
+
+    std::unordered_map<char32_t, Glyph> m_glyphs;
+    Scope<GlyphAtlas> m_atlas;
 
     inline static Ref<Font> s_defaultFont;
   };
@@ -0,0 +1,85 @@
+//
+//  GlyphAtlas.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+namespace IKan
+{
+  class Texture;
+
+  /// This class packs the glyph bitmaps of font in single channel atlas pages. Glyphs are packed in shelves (rows),
+  /// each glyph is placed in the shelf wasting least height, or a new shelf is opened below the last one. New page is
+  /// added when glyph does not fit in any page
+  class GlyphAtlas
+  {
+  public:
+    /// This structure stores the region of glyph in atlas
+    struct Region
+    {
+      uint32_t page {0};
+      glm::vec2 uvMin {0.0f};
+      glm::vec2 uvMax {0.0f};
+    };
+
+    // Fixed Constants
+    static constexpr uint32_t PageSize = 1024;
+    static constexpr uint32_t Padding = 1; // Empty pixels between glyphs so that linear filter do not blend neighbours
+
+    /// This constructor creates the empty atlas. First page is added with first glyph
+    /// - Parameter name: name of atlas for debug
+    GlyphAtlas(const std::string& name);
+
+    /// This function adds the glyph bitmap in atlas and uploads it to page texture
+    /// - Parameters:
+    ///   - bitmap: single channel glyph bitmap without row padding
+    ///   - width: width of bitmap
+    ///   - height: height of bitmap
+    /// - Returns: region of glyph in atlas
+    Region Add(const uint8_t* bitmap, uint32_t width, uint32_t height);
+
+    // Getters -------------------------------------------------------------------------------------------------------
+    /// This function returns the texture of atlas page
+    /// - Parameter page: page index
+    const Ref<Texture>& GetPage(uint32_t page) const;
+    /// This function returns the number of pages in atlas
+    uint32_t GetPageCount() const;
+
+    DELETE_COPY_MOVE_CONSTRUCTORS(GlyphAtlas);
+
+  private:
+    /// This structure stores the row of glyphs in page
+    struct Shelf
+    {
+      uint32_t y {0};
+      uint32_t height {0};
+      uint32_t width {0}; // Used width of shelf
+    };
+
+    /// This structure stores the page texture and its packing state
+    struct Page
+    {
+      Ref<Texture> texture;
+      std::vector<Shelf> shelves;
+      uint32_t height {0}; // Used height of page
+    };
+
+    /// This function finds the position for glyph in page
+    /// - Parameters:
+    ///   - page: atlas page
+    ///   - width: width of glyph with padding
+    ///   - height: height of glyph with padding
+    ///   - position: position of glyph in page
+    /// - Returns: false if glyph does not fit in page
+    static bool Allocate(Page& page, uint32_t width, uint32_t height, glm::uvec2& position);
+    /// This function adds a new empty page in atlas
+    void AddPage();
+
+    // Member Variables ----------------------------------------------------------------------------------------------
+    std::string m_name {};
+    std::vector<Page> m_pages;
+  };
+} // namespace IKan
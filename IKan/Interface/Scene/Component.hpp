@@ -19,7 +19,7 @@ namespace IKan
   //  1) Add new component here (obviously).
   //  2) Create Proper Copy and Move Constructors if needed as scene might copy the entities
   //  3) Add in AllComponents Macro
-  //  4) Add in Scene CopyTo Function
+  //  4) Scene CopyTo copies the components of AllComponents
   //  5) Update Scene::DuplicateEntity() to deal with the new component in whatever way is appropriate.
   //  6) Update SceneSerializer to (de)serialize the new component.
   //  7) Update SceneHierarchy Panel (Property and Add component)
@@ -49,13 +49,17 @@ namespace IKan
     std::vector<UUID> children;
   };
   
+  /// Transform relative to parent entity. World transform is computed by TransformSystem
   struct TransformComponent
   {
+    /// Matrix is recomputed on first access after position, rotation or scale is updated
     const glm::mat4& Transform() const;
     const glm::vec3& Position() const;
     const glm::vec3& Rotation() const;
     const glm::vec3& Scale() const;
     const glm::quat& Quaternion() const;
+    /// Incremented each time transform is updated. Used by systems caching the data derived from transform
+    uint32_t Version() const;
     
     void UpdateTransform(const glm::mat4& transform);
     
@@ -78,9 +82,22 @@ namespace IKan
     TransformComponent();
     
   private:
-    glm::quat quaternion;
-    glm::mat4 transform;
+    /// This function recomputes the matrix and quaternion if transform is updated
+    void UpdateMatrix() const;
+    
+    mutable glm::quat quaternion;
+    mutable glm::mat4 transform;
     glm::vec3 position{0.0f}, rotation{0.0f}, scale{1.0f};
+    uint32_t version {0};
+    mutable bool isMatrixDirty {false};
+  };
+  
+  /// Transform in world space. Updated by TransformSystem from transform of entity and its parents
+  struct WorldTransformComponent
+  {
+    glm::mat4 transform {1.0f};
+    /// Incremented each time world transform is updated. Used by systems caching the data derived from transform
+    uint32_t version {0};
   };
 
   struct CameraComponent
@@ -113,6 +130,6 @@ namespace IKan
   
   // Stores all the components present in Engine
   using AllComponents =
-  ComponentGroup<IDComponent, VisibilityComponent, TagComponent, TransformComponent, 
-                 CameraComponent, MeshComponent>;
+  ComponentGroup<IDComponent, VisibilityComponent, TagComponent, RelationshipComponent, TransformComponent,
+                 WorldTransformComponent, CameraComponent, MeshComponent>;
 } // namespace IKan
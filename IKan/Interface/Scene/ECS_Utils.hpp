@@ -11,7 +11,7 @@
 
 namespace IKan::ECS_Utils
 {
-  /// This function parent set the parent of entity
+  /// This function parent set the parent of entity. World transform of entity is kept
   /// - Parameters:
   ///   - scene: reference
   ///   - entity: Current entity
@@ -21,16 +21,7 @@ namespace IKan::ECS_Utils
   /// - Parameters:
   ///   - scene: reference
   ///   - entity: parent entity
+  ///   - convertToWorldSpace: keep the world transform of entity
   void UnparentEntity(Ref<Scene> scene, Entity entity, bool convertToWorldSpace = true);
-  
-  /// This function updates the transform of children entities
-  /// - Parameters:
-  ///   - scene: reference
-  ///   - entity: parent entity
-  ///   - position: position
-  ///   - scale: scale
-  ///   - rotation: rotation
-  ///   - controllerParent: controller parent entity
-  void UpdateChildrenTransform(Ref<Scene> scene, Entity entity, const glm::vec3& position, const glm::vec3& scale, const glm::vec3& rotation, Entity controllerParent);
 
 } // namespace IKan::ECS_Utils
@@ -55,6 +55,8 @@ namespace IKan
     TransformComponent& GetTransform();
     /// This function returns transform comp of entity
     const glm::mat4& GetTransform() const;
+    /// This function returns world transform of entity. Updated by scene each frame
+    const glm::mat4& GetWorldTransform() const;
     
     /// This function returns name of entity
     std::string& GetName();
@@ -21,7 +21,8 @@ namespace IKan
     ///   - out: yamal out
     ///   - entity: entity handle
     static void SerializeEntity(YAML::Emitter& out, Entity entity);
-    /// This function deserialises the entity
+    /// This function deserialises the entities. Nodes are converted on worker threads and entities are created in node
+    /// order on calling thread
     /// - Parameters:
     ///   - scene: Scene context
     ///   - entitiesNode: yamal root node
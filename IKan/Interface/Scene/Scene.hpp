@@ -13,6 +13,7 @@
 #include "Assets/Asset.hpp"
 #include "Camera/EditorCamera.hpp"
 #include "Renderer/SceneRenderer.hpp"
+#include "Scene/TransformSystem.hpp"
 
 namespace IKan
 {
@@ -83,14 +84,16 @@ namespace IKan
     void OnClose();
 
     // Fundamentals ------------------------------------------------------------------------------------------------
-    /// this function copy scene to target
-    /// - Parameter target: target scene
+    /// this function copy scene to target. Entity handles and component order are preserved
+    /// - Parameter target: target scene. Should be empty
     void CopyTo(Ref<Scene>& target);
     /// This function updates the viewport of Scene
     /// - Parameters:
     ///   - width: width of view port
     ///   - height: width of view port
     void SetViewportSize(uint32_t width, uint32_t height);
+    /// This function updates the world transform of entities with updated transform or parent
+    void UpdateWorldTransforms();
 
     // Entity Manager ------------------------------------------------------------------------------------------------
     /// This function creates an unique entity with UUID
@@ -188,6 +191,7 @@ namespace IKan
     uint32_t m_registryCapacity {0};
     uint32_t m_numEntities = 0;
     int32_t m_maxEntityID = -1;
+    TransformSystem m_transformSystem;
     
     // Entity ---------------------------
     EntityMap m_entityIDMap;
@@ -196,5 +200,6 @@ namespace IKan
     
     friend class Entity;
     friend class SceneSerializer;
+    friend class EntitySerializer;
   };
 } // namespace IKan
@@ -0,0 +1,81 @@
+//
+//  SceneBVH.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "Core/Ray.hpp"
+#include "Scene/Scene.hpp"
+
+namespace IKan
+{
+  /// This class stores the bounding volume hierarchy of world AABBs of mesh entities of scene. Leaves are refitted
+  /// when transform or mesh of entity changes, or when mesh missing at build is loaded. Tree is rebuilt when entities
+  /// are added or removed
+  class SceneBVH
+  {
+  public:
+    /// This function synchronizes the hierarchy with mesh entities of scene
+    /// - Parameter scene: scene instance. Hierarchy is rebuilt if scene is changed
+    void Update(const Ref<Scene>& scene);
+    /// This function returns the entities whose world AABB is hit by ray
+    /// - Parameters:
+    ///   - ray: ray in world space
+    ///   - entities: entities hit by ray in no order. Cleared before query
+    void Query(const Ray& ray, std::vector<entt::entity>& entities) const;
+    /// This function clears the hierarchy
+    void Clear();
+    
+  private:
+    /// Node of hierarchy. Leaf if entity is not null
+    struct Node
+    {
+      AABB bounds;
+      int32_t parent {-1}, left {-1}, right {-1};
+      entt::entity entity {entt::null};
+    };
+    
+    /// Leaf data of entity to detect the changes
+    struct Leaf
+    {
+      int32_t node {-1};
+      uint32_t transformVersion {0};
+      AssetHandle mesh {0};
+    };
+    
+    /// Entity data used while building the hierarchy
+    struct BuildItem
+    {
+      entt::entity entity;
+      AABB bounds;
+      glm::vec3 centroid;
+      Leaf leaf;
+    };
+    
+    // Member Functions ----------------------------------------------------------------------------------------------
+    /// This function rebuilds the hierarchy with all mesh entities of scene
+    /// - Parameter scene: scene instance
+    void Build(Scene& scene);
+    /// This function builds the sub tree of items in range [begin, end) with median split
+    /// - Parameters:
+    ///   - items: build items
+    ///   - begin: first item
+    ///   - end: item after last
+    ///   - parent: parent node index
+    /// - Returns: root node of sub tree
+    int32_t BuildRecursive(std::vector<BuildItem>& items, uint32_t begin, uint32_t end, int32_t parent);
+    /// This function updates the bounds of all ancestors of node
+    /// - Parameter nodeIndex: node index
+    void RefitAncestors(int32_t nodeIndex);
+    
+    // Member Variables ----------------------------------------------------------------------------------------------
+    std::weak_ptr<Scene> m_scene;
+    std::vector<Node> m_nodes;
+    std::unordered_map<entt::entity, Leaf> m_leaves;
+    int32_t m_root {-1};
+    uint32_t m_refitsSinceBuild {0};
+  };
+} // namespace IKan
@@ -17,6 +17,13 @@ namespace YAML
 
 namespace IKan
 {
+  /// This enum stores the file format of scene
+  enum class SceneFormat : uint8_t
+  {
+    Yaml,  // Human readable
+    Binary // Components packed in columns per component type. Faster to load for big scenes
+  };
+  
   class SceneSerializer
   {
   public:
@@ -25,13 +32,36 @@ namespace IKan
     SceneSerializer(const Ref<Scene>& scene);
     
     /// This functions serializes(Saves) the scene at path 'file_path'
-    /// - Parameter file_path: path wehre scene need to be saved
-    void Serialize(const std::filesystem::path& filepath);
-    /// This functions serializes(Opens) the scene frol path 'file_path'
+    /// - Parameters:
+    ///   - file_path: path wehre scene need to be saved
+    ///   - format: file format of scene
+    void Serialize(const std::filesystem::path& filepath, SceneFormat format = SceneFormat::Yaml);
+    /// This functions serializes(Opens) the scene frol path 'file_path'. Format of file is detected from its header
     /// - Parameter file_path: path which need to be loaded
     bool Deserialize(const std::filesystem::path& filepath);
     
   private:
+    /// This function writes the scene in yaml format
+    /// - Parameter filepath: scene file path
+    void SerializeYaml(const std::filesystem::path& filepath);
+    /// This function writes the scene in binary format
+    /// - Parameter filepath: scene file path
+    void SerializeBinary(const std::filesystem::path& filepath);
+    /// This function loads the scene from yaml file
+    /// - Parameter filepath: scene file path
+    bool DeserializeYaml(const std::filesystem::path& filepath);
+    /// This function loads the scene from binary file. Components are read column by column and inserted in registry
+    /// in bulk
+    /// - Parameter filepath: scene file path
+    bool DeserializeBinary(const std::filesystem::path& filepath);
+    /// This function converts the transforms of child entities from world space to parent space. Scenes stored before
+    /// transform hierarchy have world space transforms
+    void ConvertToLocalTransforms();
+    
+    /// This function stores the meshes and materials used by scene in asset dependency graph
+    /// - Parameter filepath: scene file path
+    void UpdateAssetDependencies(const std::filesystem::path& filepath) const;
+    
     Ref<Scene> m_scene;
   };
 } // namespace IKan
@@ -0,0 +1,51 @@
+//
+//  TransformSystem.hpp
+//  IKan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include <entt/entt.hpp>
+
+namespace IKan
+{
+  class Scene;
+  class Entity;
+
+  /// This class updates the world transform of entities from their local transform and world transform of parent.
+  /// Hierarchy is flattened in parent first order and rebuilt only when entities or parents are changed. Only entities
+  /// with updated local transform and their descendants are recomputed. Independent root hierarchies are updated in
+  /// parallel
+  class TransformSystem
+  {
+  public:
+    /// This function updates the world transform of changed entities
+    /// - Parameter scene: scene instance
+    void Update(Scene& scene);
+    /// This function marks the hierarchy changed. Hierarchy is rebuilt on next update
+    void Invalidate();
+
+    /// This function computes the world transform of entity by walking its parents. Used when world transform is needed
+    /// before next update
+    /// - Parameter entity: entity
+    static glm::mat4 ComputeWorldTransform(Entity entity);
+
+  private:
+    /// This function flattens the hierarchy of scene in parent first order
+    /// - Parameter scene: scene instance
+    void Build(Scene& scene);
+
+    // Member Variables ----------------------------------------------------------------------------------------------
+    // Flattened hierarchy. Subtree of each root is stored contiguously after root
+    std::vector<entt::entity> m_entities;
+    std::vector<int32_t> m_parents; // Index of parent entity. -1 for root
+    std::vector<uint32_t> m_localVersions; // Version of transform used for world transform
+    std::vector<uint8_t> m_updated; // Entities updated in current update
+
+    // Range of entities [begin, end) updated by each job. Contains complete root hierarchies
+    std::vector<std::pair<uint32_t, uint32_t>> m_jobRanges;
+    bool m_isHierarchyChanged {true};
+  };
+} // namespace IKan
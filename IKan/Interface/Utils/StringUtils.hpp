@@ -64,6 +64,13 @@ namespace IKan::Utils::String
   /// - Parameter string: String to be upper
   std::string ToUpper(const std::string_view& string);
   
+  /// This function decodes the UTF-8 character starting at offset and moves the offset to next character
+  /// - Parameters:
+  ///   - string: UTF-8 string
+  ///   - offset: offset of character in string
+  /// - Returns: Unicode code point. Returns replacement character (U+FFFD) for invalid byte
+  char32_t DecodeUTF8(std::string_view string, size_t& offset);
+  
   /// This function Removes the extention from file path
   /// - Parameter filePath: File path from which extension to be removed
   std::string RemoveExtension(const std::string& filePath);
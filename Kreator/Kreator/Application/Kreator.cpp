@@ -116,6 +116,7 @@ Scope<Application> CreateApplication([[maybe_unused]] int argc, [[maybe_unused]]
   ApplicationSpecification applicationSpec;
   applicationSpec.name = "Kreator";
   applicationSpec.rendererType = RendererType::OpenGL;
+  applicationSpec.threadingPolicy = ThreadingPolicy::SingleThreaded;
 
   // Window Specification Data
   applicationSpec.windowSpecification.title = "Kreator";
@@ -110,8 +110,9 @@ if (!m_currentScene) return
         return -1;
       }
       
-      const glm::mat4& transform = entity.GetTransform().Transform();
+      const glm::mat4& transform = entity.GetWorldTransform();
       auto& submeshes = mesh->GetSubMeshes();
+      float nearestDistance = -1;
       for (uint32_t i = 0; i < submeshes.size(); i++)
       {
         const auto& submesh = submeshes[i];
@@ -122,20 +123,19 @@ if (!m_currentScene) return
         };
         
         float distance;
-        if (ray.IntersectsAABB(submesh.boundingBox, distance))
+        if (ray.IntersectsAABB(submesh.boundingBox, distance) and mesh->GetBVH(i).Intersect(ray, distance))
         {
-          const auto& triangleCache = mesh->GetTriangleCache(i);
-          for (const auto& triangle : triangleCache)
-          {
-            if (ray.IntersectsTriangle(triangle.V0.position, triangle.V1.position, triangle.V2.position, distance))
-            {
-              return distance;
-            }
-          } // For each triangle cache
+          nearestDistance = nearestDistance == -1 ? distance : glm::min(nearestDistance, distance);
         } // Bounding box intersect
       } // Each Submesh
-      return -1;
+      return nearestDistance;
     };
+    
+    /// This function returns the scene file format of active project
+    static SceneFormat GetSceneFormat()
+    {
+      return Project::GetActive()->GetConfig().binaryScenes ? SceneFormat::Binary : SceneFormat::Yaml;
+    }
   } // namespace KreatorUtils
   
   RendererLayer* RendererLayer::s_instance = nullptr;
@@ -403,8 +403,6 @@ if (!m_currentScene) return
     IK_PROFILE();
     IK_LOG_INFO("Kreator Layer", "Opening scene: {0}", filepath.string());
     
-    CloseCurrentScene();
-    
     if (!std::filesystem::exists(filepath))
     {
       IK_LOG_ERROR("RendererLayer" ,"Tried loading a non-existing scene: {0}", filepath.string());
@@ -414,10 +412,23 @@ if (!m_currentScene) return
       return;
     }
     
+    // Load all the assets used by scene in parallel before first frame, instead of loading each on first use
+    AssetManager::PrefetchDependencies(AssetManager::GetAssetHandleFromFilePath(AssetManager::GetRelativePath(filepath)));
+    
     Ref<Scene> newScene = Scene::Create(Project::GetActive()->GetConfig().sceneType, "New Scene");
     SceneSerializer serializer(newScene);
-    serializer.Deserialize(filepath);
+    if (!serializer.Deserialize(filepath))
+    {
+      // Current scene is kept open. New scene is created only if no scene is open (e.g. corrupted start scene)
+      IK_LOG_ERROR("RendererLayer", "Failed to load scene: {0}. Keeping the current scene", filepath.string());
+      if (!m_currentScene)
+      {
+        NewScene("UntitledScene");
+      }
+      return;
+    }
     
+    CloseCurrentScene();
     m_editorScene = newScene;
     m_currentScene = m_editorScene;
     m_sceneFilePath = filepath;
@@ -527,7 +538,7 @@ if (!m_currentScene) return
             }
             
             Entity selectedEntity = m_selectionContext[0].entity;
-            m_editorCamera.Focus(selectedEntity.GetTransform().Position());
+            m_editorCamera.Focus(glm::vec3(selectedEntity.GetWorldTransform()[3]));
             break;
           }
             
@@ -627,9 +638,10 @@ if (!m_currentScene) return
 
       auto [origin, direction] = CastRay(m_editorCamera);
 
-      // for each mesh entity
-      auto meshEntities = m_currentScene->GetAllEntitiesWith<MeshComponent>();
-      for (auto entityHandle : meshEntities)
+      // for each mesh entity hit by ray in scene hierarchy
+      m_pickingBVH.Update(m_currentScene);
+      m_pickingBVH.Query(Ray(origin, direction), m_pickingCandidates);
+      for (auto entityHandle : m_pickingCandidates)
       {
         Entity entity = { entityHandle, m_currentScene.get() };
         auto& mc = entity.GetComponent<MeshComponent>();
@@ -733,7 +745,7 @@ if (!m_currentScene) return
     {
       IK_LOG_INFO("Kreator Layer", "Saving the scene: {0}", m_sceneFilePath.c_str());
       SceneSerializer serializer(m_editorScene);
-      serializer.Serialize(m_sceneFilePath);
+      serializer.Serialize(m_sceneFilePath, KreatorUtils::GetSceneFormat());
       m_timeSinceLastSave = 0.0f;
     }
     else
@@ -748,7 +760,7 @@ if (!m_currentScene) return
     {
       SceneSerializer serializer(m_editorScene);
       std::string modFilePath = m_sceneFilePath.string() + ".auto";
-      serializer.Serialize(modFilePath);
+      serializer.Serialize(modFilePath, KreatorUtils::GetSceneFormat());
       m_timeSinceLastSave = 0.0f;
     }
   }
@@ -1013,6 +1025,9 @@ if (!m_currentScene) return
       CloseProject();
     }
     
+    // Time from here till start scene is opened is reported as time to editor ready
+    Timer readyTimer;
+    
     // Create new project fill the config with file data
     Ref<Project> project = CreateRef<Project>();
     ProjectSerializer serializer(project);
@@ -1043,6 +1058,8 @@ if (!m_currentScene) return
       NewScene(Project::GetActive()->GetConfig().name);
     }
 
+    IK_LOG_INFO("RendererLayer", "Project '{0}' is ready in {1:.2f} ms", project->GetConfig().name, readyTimer.ElapsedMiliSeconds());
+    
     // Push the current project in recent list
     PushProjectToRecentProjects(projectFilePath);
     
@@ -1321,6 +1338,11 @@ if (!m_currentScene) return
         m_sceneFilePath = explorerOutput;
         m_sceneFilePath += SceneExtension;
         
+        // New scene in asset directory is registered before saving, so that its dependencies are stored on save
+        if (AssetManager::GetRelativePath(m_sceneFilePath).is_relative())
+        {
+          AssetManager::ImportAsset(m_sceneFilePath);
+        }
         SaveScene();
 
         break;
@@ -1564,7 +1586,48 @@ if (!m_currentScene) return
               UI::Property("Lines in this batch   ", std::to_string(stats._2d.lines));
               UI::Property("Max Lines Per Batch   ", std::to_string(stats._2d.maxLines));
               UI::Property("Chars in this batch   ", std::to_string(stats._2d.chars));
-              UI::Property("Max Char Per Batch    ", std::to_string(16));
+              UI::Property("Max Char Per Batch    ", std::to_string(stats._2d.maxChars));
+              UI::Property("Text Layout Hits      ", std::to_string(stats._2d.textLayoutHits));
+              UI::Property("Text Layout Misses    ", std::to_string(stats._2d.textLayoutMisses));
+              UI::EndPropertyGrid();
+              ImGui::EndTabItem();
+            }
+            
+            if (ImGui::BeginTabItem("Command Queue"))
+            {
+              UI::ScopedDisable disable;
+              UI::BeginPropertyGrid(2, 1, 1);
+              UI::Property("Commands            ", std::to_string(stats.commandQueue.frameCommands));
+              UI::Property("Frame Size (KB)     ", std::to_string((uint32_t)(stats.commandQueue.frameBytes / 1000)));
+              UI::Property("High Water Mark (KB)", std::to_string((uint32_t)(stats.commandQueue.highWaterMark / 1000)));
+              UI::Property("Reserved Size (KB)  ", std::to_string((uint32_t)(stats.commandQueue.reservedBytes / 1000)));
+              UI::Property("Pages               ", std::to_string(stats.commandQueue.pages));
+              UI::EndPropertyGrid();
+              ImGui::EndTabItem();
+            }
+            
+            if (ImGui::BeginTabItem("State Changes"))
+            {
+              UI::ScopedDisable disable;
+              UI::BeginPropertyGrid(2, 1, 1);
+              UI::Property("Shader Binds          ", std::to_string(stats.stateChanges.shaderBinds));
+              UI::Property("Material Binds        ", std::to_string(stats.stateChanges.materialBinds));
+              UI::Property("Pipeline Binds        ", std::to_string(stats.stateChanges.pipelineBinds));
+              UI::Property("Texture Binds         ", std::to_string(stats.stateChanges.textureBinds));
+              UI::Property("Skipped Shader Binds  ", std::to_string(stats.stateChanges.skippedShaderBinds));
+              UI::Property("Skipped Material Binds", std::to_string(stats.stateChanges.skippedMaterialBinds));
+              UI::Property("Skipped Pipeline Binds", std::to_string(stats.stateChanges.skippedPipelineBinds));
+              UI::Property("Skipped Texture Binds ", std::to_string(stats.stateChanges.skippedTextureBinds));
+              UI::EndPropertyGrid();
+              ImGui::EndTabItem();
+            }
+            
+            if (ImGui::BeginTabItem("Culling"))
+            {
+              UI::ScopedDisable disable;
+              UI::BeginPropertyGrid(2, 1, 1);
+              UI::Property("Visible Submeshes", std::to_string(stats.culling.visibleSubmeshes));
+              UI::Property("Culled Submeshes ", std::to_string(stats.culling.culledSubmeshes));
               UI::EndPropertyGrid();
               ImGui::EndTabItem();
             }
@@ -1572,6 +1635,44 @@ if (!m_currentScene) return
           }
           ImGui::EndTabItem();
         }
+        
+        if (ImGui::BeginTabItem("Asset Residency"))
+        {
+          {
+            ImGui::PushID("Residency Budget");
+            UI::BeginPropertyGrid(2, 1, 1);
+            uint32_t budgetMB = (uint32_t)(AssetResidency::GetBudget() / (1024 * 1024));
+            if (UI::Property("Budget (MB)", budgetMB, 1))
+            {
+              AssetResidency::SetBudget((uint64_t)budgetMB * 1024 * 1024);
+            }
+            UI::EndPropertyGrid();
+            ImGui::PopID();
+          }
+          
+          UI::ScopedDisable disable;
+          UI::BeginPropertyGrid(2, 1, 1);
+          UI::Property("Resident (KB)     ", std::to_string(AssetResidency::GetResidentBytes() / 1000));
+          UI::Property("Peak Resident (KB)", std::to_string(AssetResidency::GetPeakResidentBytes() / 1000));
+          UI::EndPropertyGrid();
+          
+          for (AssetType type : {AssetType::Image, AssetType::Mesh, AssetType::Font, AssetType::Material, AssetType::Scene})
+          {
+            const AssetResidencyStats& residency = AssetResidency::GetStats(type);
+            if (UI::PropertyGridHeader(AssetUtils::AssetTypeToString(type), false))
+            {
+              UI::BeginPropertyGrid(2, 1, 1);
+              UI::Property("Assets   ", std::to_string(residency.assetCount));
+              UI::Property("CPU (KB) ", std::to_string(residency.cpuBytes / 1000));
+              UI::Property("GPU (KB) ", std::to_string(residency.gpuBytes / 1000));
+              UI::Property("Peak (KB)", std::to_string(residency.peakBytes / 1000));
+              UI::Property("Evicted  ", std::to_string(residency.evictedCount));
+              UI::EndPropertyGrid();
+              UI::PropertyGridHeaderEnd();
+            }
+          }
+          ImGui::EndTabItem();
+        }
         ImGui::EndTabBar();
       }
     }
@@ -2183,10 +2284,11 @@ if (!m_currentScene) return
         m_gizmoMode = 0;
       }
       
+      // Gizmo manipulates the world transform of first selected entity
       auto& selection = m_selectionContext[0];
-      TransformComponent& entityTransform_1 = selection.entity.GetTransform();
+      const glm::mat4 worldTransform = TransformSystem::ComputeWorldTransform(selection.entity);
       
-      glm::mat4 transform = entityTransform_1.Transform();
+      glm::mat4 transform = worldTransform;
       ImGuizmo::Manipulate(glm::value_ptr(m_editorCamera.GetViewMatrix()),
                            glm::value_ptr(m_editorCamera.GetUnReversedProjectionMatrix()),
                            (ImGuizmo::OPERATION)m_gizmoType,
@@ -2195,32 +2297,32 @@ if (!m_currentScene) return
                            nullptr,
                            snap ? snapValues : nullptr);
       
-      glm::vec3 translation, rotation, scale;
-      Utils::Math::DecomposeTransform(transform, translation, rotation, scale);
-      
-      glm::vec3 deltaPosition = glm::vec3(0.0f);
-      if (m_gizmoType == ImGuizmo::OPERATION::TRANSLATE)
+      if (ImGuizmo::IsUsing())
       {
-        deltaPosition = translation - entityTransform_1.Position();
-      }
-      glm::vec3 deltaRotation = glm::vec3(0.0f);
-      if (m_gizmoType == ImGuizmo::OPERATION::ROTATE)
-      {
-        deltaRotation = rotation - entityTransform_1.Rotation();
-      }
-      glm::vec3 deltaScale = glm::vec3(0.0f);
-      if (m_gizmoType == ImGuizmo::OPERATION::SCALE)
-      {
-        deltaScale = scale - entityTransform_1.Scale();
-      }
-      
-      for (auto& selection : m_selectionContext)
-      {
-        if (ImGuizmo::IsUsing())
+        // Same world space change is applied to all selected entities. Children follow their parent, so entities with
+        // selected ancestor are skipped
+        const glm::mat4 deltaTransform = transform * glm::inverse(worldTransform);
+        for (auto& selection : m_selectionContext)
         {
-          IKan::ECS_Utils::UpdateChildrenTransform(m_currentScene, selection.entity, deltaPosition, deltaScale, deltaRotation, selection.entity);
-        } // If Guizmo using
-      } // for each selection context
+          bool isAncestorSelected = false;
+          for (const auto& other : m_selectionContext)
+          {
+            isAncestorSelected = isAncestorSelected or (other.entity != selection.entity and selection.entity.IsDescendantOf(other.entity));
+          }
+          if (isAncestorSelected)
+          {
+            continue;
+          }
+          
+          glm::mat4 parentTransform(1.0f);
+          if (Entity parent = selection.entity.GetParent(); parent)
+          {
+            parentTransform = TransformSystem::ComputeWorldTransform(parent);
+          }
+          const glm::mat4 newWorldTransform = deltaTransform * TransformSystem::ComputeWorldTransform(selection.entity);
+          selection.entity.GetTransform().UpdateTransform(glm::inverse(parentTransform) * newWorldTransform);
+        } // for each selection context
+      } // If Guizmo using
     } // if valid selection and guizmo
   }
 } // namespace Kreator
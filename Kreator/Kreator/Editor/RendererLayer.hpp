@@ -233,6 +233,8 @@ namespace Kreator
       float distance = 0.0f;
     };
     std::vector<SelectedEntity> m_selectionContext;
+    SceneBVH m_pickingBVH;
+    std::vector<entt::entity> m_pickingCandidates;
     float m_timeSinceLastSave = 0.0f;
     Ref<Image> m_stopButtonTex, m_playButtonTex, m_simulateButtonTex, m_pauseButtonTex;
 
@@ -64,6 +64,14 @@ int main(int argc, const char * argv[])
 #endif
   }
   
+  // Headless benchmarks with Null renderer. Usage: Kreator --benchmark [filter]
+  if (argc > 1 and std::string_view(argv[1]) == "--benchmark")
+  {
+    bool passed = Benchmark::Run(argc > 2 ? argv[2] : "");
+    Logger::Shutdown();
+    return passed ? 0 : 1;
+  }
+  
   // Core Application
   {
     Scope<Application> application = CreateApplication(argc, argv);
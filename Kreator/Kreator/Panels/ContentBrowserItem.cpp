@@ -15,6 +15,26 @@ namespace Kreator
 {
   static char s_renameBuffer[MAX_INPUT_BUFFER_LENGTH];
   
+  namespace CBI_Utils
+  {
+    /// This function updates the registry path of all the assets in directory and its sub directories
+    /// - Parameters:
+    ///   - directory: directory info
+    ///   - destination: new path of directory relative to asset directory
+    /// - Note: Should be called inside registry transaction so that registry file is written once
+    static void OnDirectoryMoved(const Ref<DirectoryInfo>& directory, const std::filesystem::path& destination)
+    {
+      for (AssetHandle asset : directory->assets)
+      {
+        AssetManager::OnAssetMoved(asset, destination);
+      }
+      for (const auto& [handle, subDirectory] : directory->subDirectories)
+      {
+        OnDirectoryMoved(subDirectory, destination / subDirectory->filePath.filename());
+      }
+    }
+  } // namespace CBI_Utils
+  
   void CBItemActionResult::Set(ContentBrowserAction flag, bool value)
   {
     if (value)
@@ -366,6 +386,8 @@ namespace Kreator
   
   void ContentBrowserItem::Rename(const std::string& newName)
   {
+    // Registry is written once even if many assets are renamed (Directory)
+    AssetRegistryTransaction registryTransaction;
     OnRenamed(newName);
   }
   
@@ -444,8 +466,15 @@ namespace Kreator
       return;
     }
     
-    Utils::FileSystem::Rename(Project::GetActive()->GetAssetDirectory() / m_directoryInfo->filePath,
-                              Project::GetActive()->GetAssetDirectory() / m_directoryInfo->filePath.parent_path() / newName);
+    const std::filesystem::path newFilePath = m_directoryInfo->filePath.parent_path() / newName;
+    if (!Utils::FileSystem::Rename(Project::GetActive()->GetAssetDirectory() / m_directoryInfo->filePath,
+                                   Project::GetActive()->GetAssetDirectory() / newFilePath))
+    {
+      return;
+    }
+    
+    // Note: Rename() writes the registry once for all the assets in directory
+    CBI_Utils::OnDirectoryMoved(m_directoryInfo, newFilePath);
   }
   
   void ContentBrowserDirectory::UpdateDrop([[maybe_unused]]CBItemActionResult& actionResult)
@@ -471,6 +500,7 @@ namespace Kreator
       return;
     }
     
+    AssetRegistryTransaction registryTransaction;
     for (auto asset : m_directoryInfo->assets)
     {
       AssetManager::OnAssetDeleted(asset);
@@ -485,6 +515,10 @@ namespace Kreator
     {
       return false;
     }
+    
+    // Registry is written once for all the assets in directory
+    AssetRegistryTransaction registryTransaction;
+    CBI_Utils::OnDirectoryMoved(m_directoryInfo, destination / m_directoryInfo->filePath.filename());
     return true;
   }
   
@@ -366,6 +366,8 @@ namespace Kreator
         ImGui::NextColumn();
         if (ImGui::Button("Yes", ImVec2(columnWidth, 0)) or ImGui::IsKeyDown(ImGuiKey::ImGuiKey_Enter))
         {
+          // Registry is written once for all the deleted assets
+          AssetRegistryTransaction registryTransaction;
           for (AssetHandle handle : m_selectionStack)
           {
             size_t index = m_currentItems.FindItem(handle);
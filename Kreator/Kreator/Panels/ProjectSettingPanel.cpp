@@ -69,6 +69,13 @@ namespace Kreator
         s_serializeProject = true;
       }
       
+      bool binaryScenes = m_project->GetConfig().binaryScenes;
+      if (UI::Property("Save scenes in binary format", binaryScenes))
+      {
+        m_project->UpdateBinaryScenes(binaryScenes);
+        s_serializeProject = true;
+      }
+      
       std::filesystem::path startScene = m_project->GetConfig().startScene;
       if (UI::PropertyAssetReference<IKan::Scene>("Startup Scene", m_defaultScene))
       {
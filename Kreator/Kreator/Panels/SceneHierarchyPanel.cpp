@@ -909,7 +909,7 @@ namespace Kreator
     // For Asset Selector
     static UI::PropertyAssetReferenceSettings settings;
     
-    DrawComponent<TransformComponent>("Transform", entity, [this, &entity](TransformComponent& component)
+    DrawComponent<TransformComponent>("Transform", entity, [](TransformComponent& component)
                                       {
       UI::ScopedStyle spacing (ImGuiStyleVar_ItemSpacing, ImVec2(8.0f, 8.0f));
       UI::ScopedStyle padding (ImGuiStyleVar_FramePadding, ImVec2(4.0f, 4.0f));
@@ -939,60 +939,28 @@ namespace Kreator
       UI::ShiftCursorY(-8.0f);
       UI::ShiftCursorY(18.0f);
 #else
+      // Transform is relative to parent. Children follow with transform system
       ImGui::TableNextRow();
-      auto prevPosition = component.Position();
       auto position = component.Position();
       if (DrawVec3Control("Translation", position))
       {
-        IKan::ECS_Utils::UpdateChildrenTransform(m_context, entity, position - prevPosition, Utils::Math::ZeroVec3, Utils::Math::ZeroVec3, entity);
+        component.UpdatePosition(position);
       }
       
       ImGui::TableNextRow();
       auto rotation = glm::degrees(component.Rotation());
-      auto prevRotation = glm::degrees(component.Rotation());
       if (DrawVec3Control("Rotation", rotation))
       {
-        IKan::ECS_Utils::UpdateChildrenTransform(m_context, entity, Utils::Math::ZeroVec3, Utils::Math::ZeroVec3, glm::radians(rotation) - glm::radians(prevRotation), entity);
+        component.UpdateRotation(glm::radians(rotation));
       }
       
       ImGui::TableNextRow();
       auto scale = component.Scale();
-      auto prevScale = component.Scale();
       if (DrawVec3Control("Scale", scale, 1.0f, 0.01f, 100000.0f))
       {
-        IKan::ECS_Utils::UpdateChildrenTransform(m_context, entity, Utils::Math::ZeroVec3, scale - prevScale, Utils::Math::ZeroVec3, entity);
+        component.UpdateScale(scale);
       }
       ImGui::EndTable();
-      
-      if (entity.Children().size())
-      {
-        UI::ScopedColor header(ImGuiCol_Header, UI::Color::PopupBackground);
-        if (UI::PropertyGridHeader("Delta Transform", false, 2, roundingVal))
-        {
-          ImGui::BeginTable("transformComponent", 2, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_NoClip);
-          ImGui::TableSetupColumn("label_column", 0, 100.0f);
-          ImGui::TableSetupColumn("value_column", ImGuiTableColumnFlags_IndentEnable | ImGuiTableColumnFlags_NoClip,
-                                  ImGui::GetContentRegionAvail().x - 100.0f);
-          ImGui::TableNextRow();
-          auto position = component.Position();
-          DrawVec3Control("Translation", position);
-          component.UpdatePosition(position);
-          
-          ImGui::TableNextRow();
-          auto rotation = glm::degrees(component.Rotation());
-          DrawVec3Control("Rotation", rotation);
-          component.UpdateRotation(glm::radians(rotation));
-          
-          ImGui::TableNextRow();
-          auto scale = component.Scale();
-          DrawVec3Control("Scale", scale, 1.0f, 0.1f);
-          component.UpdateScale(scale);
-          
-          ImGui::EndTable();
-          
-          UI::PropertyGridHeaderEnd();
-        }
-      }
 #endif
 
     }, s_gearIcon, searchedString, true, false);